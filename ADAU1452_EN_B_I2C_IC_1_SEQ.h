@@ -0,0 +1,3464 @@
+/*
+ * File:           ADAU1452_EN_B_I2C_IC_1_SEQ.h
+ *
+ * Description:    IC 1 default download sequence, generated by
+ *                 host/sigma_sequence_gen from TxBuffer_IC_1.dat/NumBytes_IC_1.dat.
+ *                 Do not edit; regenerate after re-exporting the project.
+ */
+#ifndef __ADAU1452_EN_B_I2C_IC_1_SEQ_H__
+#define __ADAU1452_EN_B_I2C_IC_1_SEQ_H__
+
+#include "ADAU1452_EN_B_I2C_IC_1.h"
+
+#define SEQUENCE_SIZE_IC_1 73
+#define SEQUENCE_BLOB_SIZE_IC_1 13124
+#define SECTION_COUNT_IC_1 3
+
+/*
+ * Warm-boot signature word and the clock qualification scratch word after it. They
+ * sit past the exported data memory and are written at runtime, so the DSP program
+ * must not use them: every data word the program touches has to be in an exported
+ * section (SigmaStudio exports filter state as well as parameters). A re-export whose
+ * sections cover them stops here; regenerate this file to move them.
+ */
+#define SIGNATURE_ADDR_IC_1 0x61E4
+#define SCRATCH_ADDR_IC_1 0x61E5
+#if SCRATCH_ADDR_IC_1 >= DM1_DATA_ADDR_IC_1 && SIGNATURE_ADDR_IC_1 < DM1_DATA_ADDR_IC_1 + DM1_DATA_SIZE_IC_1 / 4
+#error "SIGNATURE_ADDR_IC_1/SCRATCH_ADDR_IC_1 overlap DM1_DATA, regenerate ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#endif
+#if SCRATCH_ADDR_IC_1 >= PROGRAM_ADDR_IC_1 && SIGNATURE_ADDR_IC_1 < PROGRAM_ADDR_IC_1 + PROGRAM_SIZE_IC_1 / 4
+#error "SIGNATURE_ADDR_IC_1/SCRATCH_ADDR_IC_1 overlap PROGRAM, regenerate ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#endif
+#if SCRATCH_ADDR_IC_1 >= PARAM_ADDR_IC_1 && SIGNATURE_ADDR_IC_1 < PARAM_ADDR_IC_1 + PARAM_SIZE_IC_1 / 4
+#error "SIGNATURE_ADDR_IC_1/SCRATCH_ADDR_IC_1 overlap PARAM, regenerate ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#endif
+
+#if DEFAULT_DOWNLOAD_SIZE_IC_1 != 73
+#error "ADAU1452_EN_B_I2C_IC_1_SEQ.h is out of date, regenerate it with host/sigma_sequence_gen"
+#endif
+
+ADI_REG_TYPE Sequence_Blob_IC_1[SEQUENCE_BLOB_SIZE_IC_1] = {
+0x00, 0x00, 			/* (0) SOFT_RESET */
+0x00, 0x01, 			/* (1) SOFT_RESET */
+0x00, 0xFF, 			/* (2) Reset Delay */
+0x00, 0x00, 			/* (3) HIBERNATE */
+0x00, 0x01, 			/* (4) HIBERNATE */
+0x00, 0xFF, 			/* (5) Hibernate Delay */
+0x00, 0x00, 			/* (6) KILL_CORE */
+0x00, 0x01, 			/* (7) KILL_CORE */
+0x00, 0x00, 			/* (8) PLL_ENABLE */
+0x00, 0x60, 			/* (9) PLL_CTRL0 Register */
+0x00, 0x02, 			/* (10) PLL_CTRL1 Register */
+0x00, 0x01, 			/* (11) PLL_CLK_SRC Register */
+0x00, 0x05, 			/* (12) MCLK_OUT Register */
+0x00, 0x01, 			/* (13) PLL_ENABLE Register */
+0x00, 0xFF, 			/* (14) PLL Lock Delay */
+0x1F, 0xFF, 			/* (15) POWER_ENABLE0 Register */
+0x00, 0x1F, 			/* (16) POWER_ENABLE1 Register */
+0x00, 0x01, 			/* (17) MP6_MODE */
+0x00, 0x01, 			/* (18) MP7_MODE */
+0x00, 0x05, 			/* (19) MP8_MODE */
+0x00, 0x05, 			/* (20) MP9_MODE */
+0x00, 0x01, 			/* (21) MP13_MODE */
+0x00, 0xA3, 			/* (22) ASRC_INPUT0 */
+0x00, 0x03, 			/* (23) ASRC_INPUT1 */
+0x00, 0x05, 			/* (24) ASRC_OUT_RATE0 */
+0x00, 0x05, 			/* (25) ASRC_OUT_RATE1 */
+0x00, 0x02, 			/* (26) SOUT_SOURCE0 */
+0x00, 0x02, 			/* (27) SOUT_SOURCE1 */
+0x00, 0x02, 			/* (28) SOUT_SOURCE2 */
+0x00, 0x02, 			/* (29) SOUT_SOURCE3 */
+0x00, 0x02, 			/* (30) SOUT_SOURCE4 */
+0x00, 0x02, 			/* (31) SOUT_SOURCE5 */
+0x00, 0x02, 			/* (32) SOUT_SOURCE6 */
+0x00, 0x02, 			/* (33) SOUT_SOURCE7 */
+0x00, 0x02, 			/* (34) SOUT_SOURCE8 */
+0x00, 0x02, 			/* (35) SOUT_SOURCE9 */
+0x00, 0x02, 			/* (36) SOUT_SOURCE10 */
+0x00, 0x02, 			/* (37) SOUT_SOURCE11 */
+0x00, 0x02, 			/* (38) SOUT_SOURCE12 */
+0x00, 0x02, 			/* (39) SOUT_SOURCE13 */
+0x00, 0x02, 			/* (40) SOUT_SOURCE14 */
+0x00, 0x02, 			/* (41) SOUT_SOURCE15 */
+0x00, 0x02, 			/* (42) SOUT_SOURCE16 */
+0x00, 0x02, 			/* (43) SOUT_SOURCE17 */
+0x00, 0x02, 			/* (44) SOUT_SOURCE18 */
+0x00, 0x02, 			/* (45) SOUT_SOURCE19 */
+0x00, 0x02, 			/* (46) SOUT_SOURCE20 */
+0x00, 0x02, 			/* (47) SOUT_SOURCE21 */
+0x00, 0x02, 			/* (48) SOUT_SOURCE22 */
+0x00, 0x02, 			/* (49) SOUT_SOURCE23 */
+0x00, 0x01, 			/* (50) SPDIFTX_INPUT */
+0x90, 0x00, 			/* (51) SERIAL_BYTE_0_0 */
+0x90, 0x00, 			/* (52) SERIAL_BYTE_1_0 */
+0x90, 0x00, 			/* (53) SERIAL_BYTE_2_0 */
+0x90, 0x00, 			/* (54) SERIAL_BYTE_3_0 */
+0x90, 0x00, 			/* (55) SERIAL_BYTE_4_0 */
+0x90, 0x00, 			/* (56) SERIAL_BYTE_5_0 */
+0x90, 0x00, 			/* (57) SERIAL_BYTE_6_0 */
+0x90, 0x00, 			/* (58) SERIAL_BYTE_7_0 */
+0x00, 0x08, 			/* (59) SPDIF_RX_CTRL */
+0x00, 0x01, 			/* (60) SPDIF_RESTART */
+0x00, 0x10, 			/* (61) SPDIF_AUX_EN */
+0x00, 0x01, 			/* (62) SPDIF_TX_EN */
+0x00, 0x00, 0x00, 0x02, 			/* (63) Program Data */
+0x0C, 0x00, 0xDC, 0xDC, 
+0x0D, 0x00, 0xFF, 0xD2, 
+0x0D, 0x00, 0xFF, 0xD0, 
+0x0D, 0x00, 0xF4, 0x50, 
+0x0D, 0x00, 0xF4, 0x00, 
+0xC0, 0x00, 0x23, 0x80, 
+0x80, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x23, 0x00, 
+0x80, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x23, 0xC0, 
+0x80, 0x00, 0x00, 0x10, 
+0xC0, 0x00, 0x22, 0x00, 
+0x80, 0x00, 0x00, 0x00, 
+0x08, 0x80, 0xDC, 0xE0, 
+0x0C, 0x00, 0xDC, 0xDC, 
+0x0A, 0x21, 0x00, 0x12, 
+0x08, 0x00, 0x00, 0x10, 
+0x01, 0x00, 0x00, 0x14, 
+0x06, 0x40, 0x40, 0x10, 
+0x0A, 0x21, 0x00, 0x16, 
+0x08, 0x00, 0x00, 0x14, 
+0x01, 0x00, 0x00, 0x18, 
+0x06, 0x40, 0x50, 0x10, 
+0xC0, 0x00, 0x20, 0x00, 
+0x80, 0x00, 0x00, 0x2B, 
+0x0D, 0x00, 0xFF, 0xC1, 
+0xC0, 0x00, 0x20, 0x00, 
+0x80, 0x00, 0x00, 0x01, 
+0x0D, 0x00, 0xF4, 0x62, 
+0xC0, 0x00, 0x20, 0x00, 
+0x80, 0x00, 0x00, 0x00, 
+0x0D, 0x00, 0xF4, 0x62, 
+0xC0, 0x00, 0x20, 0x00, 
+0x80, 0x00, 0x00, 0x02, 
+0x0D, 0x00, 0xFF, 0xD1, 
+0x00, 0x00, 0x00, 0x03, 
+0x0D, 0x00, 0xFF, 0xD2, 
+0x00, 0x00, 0x00, 0x05, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x02, 0x01, 0x00, 0x26, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x08, 0x9E, 0xDC, 0xE0, 
+0x08, 0x9C, 0x00, 0x14, 
+0x08, 0x9A, 0x00, 0x10, 
+0x00, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x4F, 0x00, 0x00, 
+0x08, 0x8A, 0xDC, 0xE0, 
+0x0A, 0x23, 0x00, 0x06, 
+0x00, 0x8C, 0x20, 0x00, 
+0x0A, 0xA7, 0x00, 0x05, 
+0x02, 0x09, 0x00, 0x43, 
+0xC0, 0x00, 0x28, 0x70, 
+0x80, 0x00, 0x60, 0x00, 
+0x00, 0x8C, 0x11, 0x91, 
+0x00, 0x00, 0x00, 0x23, 
+0x00, 0x00, 0x00, 0x00, 
+0x30, 0x00, 0xBC, 0xE9, 
+0x00, 0x00, 0xC2, 0xF1, 
+0x01, 0x00, 0x00, 0x42, 
+0x06, 0x00, 0x50, 0x14, 
+0x36, 0x40, 0x50, 0x15, 
+0x26, 0x40, 0x40, 0x15, 
+0x09, 0x2B, 0x00, 0x06, 
+0x00, 0x00, 0x00, 0x00, 
+0x0C, 0x00, 0x03, 0xDC, 
+0x06, 0x40, 0x12, 0x5E, 
+0x0C, 0x00, 0x03, 0xDD, 
+0x06, 0x40, 0x12, 0x6E, 
+0x0C, 0x00, 0x03, 0xDE, 
+0x06, 0x40, 0x12, 0x7E, 
+0x0C, 0x00, 0x03, 0xDF, 
+0x06, 0x40, 0x12, 0x2E, 
+0x0C, 0x00, 0x03, 0xE0, 
+0x06, 0x40, 0x12, 0x3E, 
+0x0C, 0x00, 0x03, 0xE1, 
+0x06, 0x40, 0x12, 0x4E, 
+0x00, 0x00, 0x00, 0x02, 
+0x0C, 0x00, 0x00, 0x18, 
+0x06, 0x40, 0x15, 0xCE, 
+0x00, 0x00, 0x00, 0x03, 
+0x0C, 0x00, 0x03, 0xE2, 
+0x06, 0x40, 0x12, 0x8E, 
+0x0C, 0x00, 0x03, 0xE3, 
+0x06, 0x40, 0x12, 0x9E, 
+0x0C, 0x00, 0x03, 0xE4, 
+0x06, 0x40, 0x12, 0xAE, 
+0x0C, 0x00, 0x03, 0xE5, 
+0x06, 0x40, 0x14, 0xBE, 
+0x0C, 0x00, 0x03, 0xE6, 
+0x06, 0x40, 0x14, 0xCE, 
+0x0C, 0x00, 0x03, 0xE7, 
+0x06, 0x40, 0x14, 0xDE, 
+0x0C, 0x00, 0x03, 0xE8, 
+0x06, 0x40, 0x12, 0xBE, 
+0x0C, 0x00, 0x03, 0xE9, 
+0x06, 0x40, 0x12, 0xCE, 
+0x0C, 0x00, 0x03, 0xEA, 
+0x06, 0x40, 0x12, 0xDE, 
+0x0C, 0x00, 0x03, 0xEB, 
+0x06, 0x40, 0x14, 0xFE, 
+0x0C, 0x00, 0x03, 0xEC, 
+0x06, 0x40, 0x15, 0x0E, 
+0x0C, 0x00, 0x03, 0xED, 
+0x06, 0x40, 0x15, 0x1E, 
+0x00, 0x00, 0x00, 0x02, 
+0x0C, 0x00, 0xF5, 0xA1, 
+0x06, 0x40, 0x10, 0x0E, 
+0x00, 0x00, 0x00, 0x03, 
+0x0C, 0x00, 0x03, 0xEE, 
+0x06, 0x40, 0x10, 0x1E, 
+0x00, 0x00, 0x00, 0x02, 
+0x0C, 0x00, 0xF5, 0xA0, 
+0x06, 0x40, 0x10, 0x2E, 
+0x00, 0x00, 0x00, 0x03, 
+0x0C, 0x00, 0x03, 0xEF, 
+0x06, 0x40, 0x10, 0x3E, 
+0x0C, 0x00, 0xFC, 0x40, 
+0x06, 0x40, 0x10, 0x8E, 
+0x0C, 0x00, 0xFC, 0x41, 
+0x06, 0x40, 0x10, 0x9E, 
+0x0C, 0x00, 0x03, 0xF0, 
+0x06, 0x40, 0x10, 0x4E, 
+0x00, 0x00, 0x00, 0x02, 
+0x0C, 0x00, 0xF5, 0x37, 
+0x06, 0x40, 0x10, 0xFE, 
+0x00, 0x00, 0x00, 0x03, 
+0x00, 0x00, 0x00, 0x02, 
+0x0C, 0x00, 0xF5, 0x36, 
+0x06, 0x40, 0x11, 0x0E, 
+0x00, 0x00, 0x00, 0x03, 
+0x0C, 0x30, 0xFC, 0x30, 
+0x06, 0x40, 0x10, 0xCE, 
+0x06, 0x40, 0x90, 0xDE, 
+0x00, 0x00, 0x00, 0x02, 
+0x0C, 0x00, 0xF5, 0x3D, 
+0x06, 0x40, 0x10, 0x5E, 
+0x00, 0x00, 0x00, 0x03, 
+0x0C, 0x00, 0xFC, 0x60, 
+0x06, 0x40, 0x10, 0xAE, 
+0x0C, 0x00, 0xFC, 0x61, 
+0x06, 0x40, 0x10, 0xBE, 
+0x05, 0x0C, 0x10, 0x0E, 
+0x06, 0x00, 0x10, 0x1E, 
+0x00, 0x04, 0x45, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x90, 0x6E, 
+0x05, 0x0C, 0x10, 0x2E, 
+0x06, 0x00, 0x10, 0x3E, 
+0x00, 0x04, 0x45, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x90, 0x7E, 
+0x0C, 0x82, 0x03, 0xF1, 
+0x00, 0x00, 0x00, 0x00, 
+0x35, 0x0C, 0x10, 0x5E, 
+0x25, 0x0C, 0x10, 0x4E, 
+0x05, 0x4C, 0x10, 0xEE, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0F, 0x00, 0x1C, 
+0x05, 0x0C, 0x10, 0x6E, 
+0x00, 0xC4, 0x20, 0x00, 
+0x00, 0x00, 0xD8, 0x40, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x0C, 0x88, 0x00, 
+0x05, 0x4C, 0x91, 0x9E, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0F, 0x00, 0x5C, 
+0x05, 0x0C, 0x10, 0x7E, 
+0x00, 0xC4, 0x20, 0x00, 
+0x00, 0x00, 0xD8, 0x40, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x0C, 0x88, 0x00, 
+0x05, 0x4C, 0x91, 0xCE, 
+0x0C, 0x40, 0x03, 0xF2, 
+0x06, 0x00, 0x10, 0x8E, 
+0x00, 0x04, 0x00, 0x80, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x11, 0x1E, 
+0x0C, 0x40, 0x03, 0xF3, 
+0x06, 0x00, 0x10, 0x9E, 
+0x00, 0x04, 0x00, 0x80, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x11, 0x2E, 
+0x0C, 0x40, 0x03, 0xF4, 
+0x06, 0x00, 0x10, 0xAE, 
+0x00, 0x04, 0x00, 0x80, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x11, 0x3E, 
+0x0C, 0x40, 0x03, 0xF5, 
+0x06, 0x00, 0x10, 0xBE, 
+0x00, 0x04, 0x00, 0x80, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x11, 0x4E, 
+0x0C, 0x40, 0x03, 0xF6, 
+0x06, 0x00, 0x10, 0xCE, 
+0x00, 0x04, 0x00, 0x80, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x11, 0x5E, 
+0x0C, 0x40, 0x03, 0xF7, 
+0x06, 0x00, 0x10, 0xDE, 
+0x00, 0x04, 0x00, 0x80, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x11, 0x6E, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x80, 0x00, 0x9C, 
+0xC0, 0x00, 0x08, 0x8F, 
+0x8D, 0x84, 0x03, 0xCC, 
+0xC0, 0x00, 0x08, 0x8F, 
+0x8D, 0x94, 0x03, 0xCE, 
+0x06, 0x00, 0x10, 0xEE, 
+0x06, 0x02, 0x10, 0xEE, 
+0x06, 0x00, 0x90, 0xFE, 
+0x06, 0x02, 0x91, 0x0E, 
+0x0C, 0x51, 0xFD, 0xA0, 
+0xE0, 0x00, 0x00, 0x03, 
+0x88, 0x00, 0x00, 0x00, 
+0x0D, 0x50, 0x03, 0xCE, 
+0x05, 0x4C, 0x11, 0x7E, 
+0x05, 0x6C, 0x11, 0x8E, 
+0x0C, 0x82, 0x03, 0xF8, 
+0x0A, 0x21, 0xDC, 0xDC, 
+0x35, 0x0C, 0x11, 0x1E, 
+0x05, 0x4C, 0x11, 0xDE, 
+0x35, 0x0C, 0x11, 0x2E, 
+0x05, 0x4C, 0x11, 0xEE, 
+0x0C, 0x82, 0x03, 0xF9, 
+0x0A, 0x21, 0xDC, 0xDC, 
+0x35, 0x0C, 0x11, 0x3E, 
+0x05, 0x4C, 0x11, 0xAE, 
+0x35, 0x0C, 0x11, 0x4E, 
+0x05, 0x4C, 0x11, 0xBE, 
+0x0C, 0x82, 0x03, 0xFA, 
+0x0A, 0x21, 0xDC, 0xDC, 
+0x35, 0x0C, 0x11, 0x5E, 
+0x05, 0x4C, 0x15, 0xDE, 
+0x35, 0x0C, 0x11, 0x6E, 
+0x05, 0x4C, 0x15, 0xEE, 
+0x06, 0x20, 0x90, 0xFE, 
+0x0C, 0x01, 0x00, 0x07, 
+0x36, 0x00, 0x11, 0x0E, 
+0x0D, 0x01, 0x00, 0x07, 
+0x06, 0x40, 0x11, 0xFE, 
+0x06, 0x20, 0x91, 0x0E, 
+0x0C, 0x01, 0x00, 0x08, 
+0x36, 0x00, 0x10, 0xFE, 
+0x0D, 0x01, 0x00, 0x08, 
+0x06, 0x40, 0x12, 0x0E, 
+0x06, 0x20, 0x91, 0x7E, 
+0x0D, 0x82, 0xF5, 0x29, 
+0x06, 0x20, 0x91, 0x8E, 
+0x0D, 0x82, 0xF5, 0x28, 
+0xC0, 0x00, 0x08, 0x1F, 
+0x8D, 0x80, 0x00, 0x0A, 
+0x05, 0x0C, 0x11, 0x9E, 
+0x0B, 0x21, 0xFD, 0x84, 
+0xC0, 0x00, 0x08, 0x1F, 
+0x8D, 0x94, 0x00, 0x09, 
+0x06, 0x10, 0x11, 0xAE, 
+0x06, 0x10, 0x91, 0xBE, 
+0x0C, 0x00, 0xFD, 0xA0, 
+0x00, 0x10, 0x00, 0x08, 
+0x0D, 0x01, 0x00, 0x09, 
+0x05, 0x4C, 0x13, 0x3E, 
+0x05, 0x6C, 0x13, 0x5E, 
+0xC0, 0x00, 0x08, 0x1F, 
+0x8D, 0x80, 0x00, 0x0C, 
+0x05, 0x0C, 0x11, 0xCE, 
+0x0B, 0x21, 0xFD, 0x84, 
+0xC0, 0x00, 0x08, 0x1F, 
+0x8D, 0x94, 0x00, 0x0B, 
+0x06, 0x10, 0x11, 0xDE, 
+0x06, 0x10, 0x91, 0xEE, 
+0x0C, 0x00, 0xFD, 0xA0, 
+0x00, 0x10, 0x00, 0x08, 
+0x0D, 0x01, 0x00, 0x0B, 
+0x05, 0x4C, 0x12, 0xFE, 
+0x05, 0x6C, 0x13, 0x1E, 
+0x05, 0x0C, 0x10, 0xFE, 
+0x00, 0x00, 0xF0, 0x88, 
+0x0A, 0x21, 0xDC, 0xDC, 
+0x30, 0x85, 0xA0, 0x00, 
+0x05, 0x0C, 0x91, 0x0E, 
+0x00, 0x00, 0xF0, 0x89, 
+0x0A, 0x29, 0xDC, 0xDC, 
+0x30, 0x85, 0xA2, 0x00, 
+0x00, 0xC4, 0x40, 0x02, 
+0x05, 0x0C, 0x91, 0xFE, 
+0x00, 0x00, 0xF0, 0x89, 
+0x0A, 0x29, 0xDC, 0xDC, 
+0x30, 0x85, 0xA2, 0x00, 
+0x00, 0xC4, 0x80, 0x02, 
+0x05, 0x0C, 0x92, 0x0E, 
+0x00, 0x00, 0xF0, 0x89, 
+0x0A, 0x29, 0xDC, 0xDC, 
+0x30, 0x85, 0xA2, 0x00, 
+0x00, 0xC4, 0xC0, 0x02, 
+0x05, 0x4C, 0x12, 0x1E, 
+0x05, 0x0C, 0x12, 0x1E, 
+0x05, 0x0C, 0x92, 0x2E, 
+0x00, 0x88, 0x10, 0x10, 
+0x05, 0x0D, 0x12, 0x3E, 
+0x05, 0x0D, 0x92, 0x4E, 
+0x00, 0x20, 0x06, 0x43, 
+0x05, 0x4D, 0x14, 0x0E, 
+0x05, 0x0C, 0x12, 0x1E, 
+0x05, 0x0C, 0x92, 0x5E, 
+0x00, 0x88, 0x10, 0x10, 
+0x05, 0x0D, 0x12, 0x6E, 
+0x05, 0x0D, 0x92, 0x7E, 
+0x00, 0x20, 0x06, 0x43, 
+0x05, 0x4D, 0x13, 0xEE, 
+0x05, 0x0C, 0x12, 0x1E, 
+0x05, 0x0C, 0x92, 0x8E, 
+0x00, 0x88, 0x10, 0x10, 
+0x05, 0x0D, 0x12, 0x9E, 
+0x05, 0x0D, 0x92, 0xAE, 
+0x00, 0x20, 0x06, 0x43, 
+0x05, 0x4D, 0x14, 0x1E, 
+0x05, 0x0C, 0x12, 0x1E, 
+0x05, 0x0C, 0x92, 0xBE, 
+0x00, 0x88, 0x10, 0x10, 
+0x05, 0x0D, 0x12, 0xCE, 
+0x05, 0x0D, 0x92, 0xDE, 
+0x00, 0x20, 0x06, 0x43, 
+0x05, 0x4D, 0x13, 0xFE, 
+0x06, 0x04, 0x12, 0xEE, 
+0x06, 0x01, 0x13, 0x6E, 
+0x0C, 0x60, 0x00, 0x19, 
+0x00, 0x06, 0x40, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x13, 0x7E, 
+0x06, 0x04, 0x13, 0x0E, 
+0x06, 0x01, 0x13, 0x8E, 
+0x0C, 0x60, 0x00, 0x9D, 
+0x00, 0x06, 0x40, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x13, 0x9E, 
+0x06, 0x04, 0x13, 0x2E, 
+0x06, 0x01, 0x13, 0xAE, 
+0x0C, 0x60, 0x00, 0xA0, 
+0x00, 0x06, 0x40, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x13, 0xBE, 
+0x06, 0x04, 0x13, 0x4E, 
+0x06, 0x01, 0x13, 0xCE, 
+0x0C, 0x60, 0x00, 0xA3, 
+0x00, 0x06, 0x40, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x13, 0xDE, 
+0x06, 0x04, 0x13, 0x6E, 
+0x06, 0x01, 0x14, 0x2E, 
+0x0C, 0x60, 0x00, 0xA6, 
+0x00, 0x06, 0x40, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x14, 0x3E, 
+0x06, 0x04, 0x13, 0x8E, 
+0x06, 0x01, 0x14, 0x4E, 
+0x0C, 0x60, 0x00, 0xA9, 
+0x00, 0x06, 0x40, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x14, 0x5E, 
+0x06, 0x04, 0x13, 0xAE, 
+0x06, 0x01, 0x14, 0x6E, 
+0x0C, 0x60, 0x00, 0xAC, 
+0x00, 0x06, 0x40, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x14, 0x7E, 
+0x06, 0x04, 0x13, 0xCE, 
+0x06, 0x01, 0x14, 0x8E, 
+0x0C, 0x60, 0x00, 0xAF, 
+0x00, 0x06, 0x40, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x14, 0x9E, 
+0x05, 0x0C, 0x13, 0xEE, 
+0x05, 0x2C, 0x13, 0xFE, 
+0x00, 0x84, 0x00, 0x08, 
+0x05, 0x4C, 0x14, 0xEE, 
+0x05, 0x0C, 0x14, 0x0E, 
+0x05, 0x2C, 0x14, 0x1E, 
+0x00, 0x84, 0x00, 0x08, 
+0x05, 0x4C, 0x14, 0xAE, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0E, 0x00, 0x9D, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x1D, 0x00, 0x00, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x6F, 0x00, 0xB2, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x7F, 0x00, 0x0D, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x2F, 0x00, 0x26, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x3F, 0x00, 0xCB, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x80, 0x00, 0xE4, 
+0x03, 0x05, 0x01, 0x9D, 
+0xC0, 0x00, 0x0D, 0x91, 
+0x80, 0x42, 0xFD, 0x84, 
+0xC0, 0x00, 0x0D, 0x81, 
+0x80, 0x06, 0xFD, 0x94, 
+0x00, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x0B, 0x91, 
+0x80, 0x46, 0xFD, 0xA0, 
+0xC0, 0x00, 0x0C, 0x11, 
+0x80, 0x12, 0xFD, 0x84, 
+0xC0, 0x00, 0x0C, 0x01, 
+0x80, 0x06, 0xFD, 0x94, 
+0x00, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x0A, 0x11, 
+0x80, 0x16, 0xFD, 0xA0, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x6F, 0x00, 0xB2, 
+0x03, 0x05, 0x01, 0xAE, 
+0xC0, 0x00, 0x0D, 0x81, 
+0x80, 0x43, 0xFD, 0x84, 
+0xC0, 0x00, 0x0D, 0x91, 
+0x80, 0x07, 0xFD, 0x94, 
+0x00, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x0B, 0x81, 
+0x80, 0x47, 0xFD, 0xA0, 
+0xC0, 0x00, 0x0C, 0x01, 
+0x80, 0x13, 0xFD, 0x84, 
+0xC0, 0x00, 0x0C, 0x11, 
+0x80, 0x07, 0xFD, 0x94, 
+0x00, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x0A, 0x01, 
+0x80, 0x17, 0xFD, 0xA0, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x7F, 0x00, 0x0D, 
+0x05, 0x0C, 0x14, 0x3E, 
+0x05, 0x2C, 0x14, 0x5E, 
+0xFC, 0x74, 0x80, 0x00, 
+0x80, 0x02, 0x09, 0xC3, 
+0xE0, 0x3A, 0x80, 0x00, 
+0x80, 0x00, 0x01, 0x22, 
+0xF0, 0x68, 0x80, 0x0B, 
+0x88, 0x02, 0x3D, 0xC2, 
+0x03, 0x05, 0x01, 0xC5, 
+0xE0, 0xA1, 0x00, 0x07, 
+0x8C, 0x0A, 0x05, 0x22, 
+0xFA, 0x64, 0xE8, 0x4F, 
+0x88, 0x83, 0xC7, 0x22, 
+0xF4, 0x66, 0xE8, 0xC3, 
+0x88, 0x83, 0xC5, 0x3E, 
+0xE2, 0xA5, 0x00, 0x07, 
+0x8C, 0x8A, 0x05, 0x22, 
+0xF1, 0x74, 0xE0, 0x4F, 
+0x88, 0x02, 0x05, 0xC3, 
+0xF0, 0x68, 0xE0, 0xCB, 
+0x88, 0x02, 0x3D, 0xC2, 
+0xE0, 0xA1, 0x00, 0x00, 
+0x80, 0x00, 0x00, 0x20, 
+0x05, 0x4C, 0x15, 0x2E, 
+0x05, 0x6C, 0x15, 0x3E, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0E, 0x00, 0xB4, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x1D, 0x00, 0x17, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x6F, 0x00, 0xE5, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x7F, 0x00, 0x3F, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x2F, 0x00, 0x58, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x3F, 0x00, 0xFE, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x80, 0x01, 0x17, 
+0x03, 0x05, 0x01, 0xE6, 
+0xC0, 0x00, 0x0D, 0x91, 
+0x80, 0x42, 0xFD, 0x84, 
+0xC0, 0x00, 0x0D, 0x81, 
+0x80, 0x06, 0xFD, 0x94, 
+0x00, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x0B, 0x91, 
+0x80, 0x46, 0xFD, 0xA0, 
+0xC0, 0x00, 0x0C, 0x11, 
+0x80, 0x12, 0xFD, 0x84, 
+0xC0, 0x00, 0x0C, 0x01, 
+0x80, 0x06, 0xFD, 0x94, 
+0x00, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x0A, 0x11, 
+0x80, 0x16, 0xFD, 0xA0, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x6F, 0x00, 0xE5, 
+0x03, 0x05, 0x01, 0xF7, 
+0xC0, 0x00, 0x0D, 0x81, 
+0x80, 0x43, 0xFD, 0x84, 
+0xC0, 0x00, 0x0D, 0x91, 
+0x80, 0x07, 0xFD, 0x94, 
+0x00, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x0B, 0x81, 
+0x80, 0x47, 0xFD, 0xA0, 
+0xC0, 0x00, 0x0C, 0x01, 
+0x80, 0x13, 0xFD, 0x84, 
+0xC0, 0x00, 0x0C, 0x11, 
+0x80, 0x07, 0xFD, 0x94, 
+0x00, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x0A, 0x01, 
+0x80, 0x17, 0xFD, 0xA0, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x7F, 0x00, 0x3F, 
+0x05, 0x0C, 0x14, 0x7E, 
+0x05, 0x2C, 0x14, 0x9E, 
+0xFC, 0x74, 0x80, 0x00, 
+0x80, 0x02, 0x09, 0xC3, 
+0xE0, 0x3A, 0x80, 0x00, 
+0x80, 0x00, 0x01, 0x22, 
+0xF0, 0x68, 0x80, 0x0B, 
+0x88, 0x02, 0x3D, 0xC2, 
+0x03, 0x05, 0x02, 0x0E, 
+0xE0, 0xA1, 0x00, 0x07, 
+0x8C, 0x0A, 0x05, 0x22, 
+0xFA, 0x64, 0xE8, 0x4F, 
+0x88, 0x83, 0xC7, 0x22, 
+0xF4, 0x66, 0xE8, 0xC3, 
+0x88, 0x83, 0xC5, 0x3E, 
+0xE2, 0xA5, 0x00, 0x07, 
+0x8C, 0x8A, 0x05, 0x22, 
+0xF1, 0x74, 0xE0, 0x4F, 
+0x88, 0x02, 0x05, 0xC3, 
+0xF0, 0x68, 0xE0, 0xCB, 
+0x88, 0x02, 0x3D, 0xC2, 
+0xE0, 0xA1, 0x00, 0x00, 
+0x80, 0x00, 0x00, 0x20, 
+0x05, 0x4C, 0x15, 0x4E, 
+0x05, 0x6C, 0x15, 0x5E, 
+0x05, 0x0C, 0x14, 0xAE, 
+0x05, 0x0C, 0x94, 0xBE, 
+0x00, 0x88, 0x10, 0x10, 
+0x05, 0x0D, 0x14, 0xCE, 
+0x05, 0x0D, 0x94, 0xDE, 
+0x00, 0x20, 0x06, 0x43, 
+0x05, 0x4D, 0x15, 0xBE, 
+0x05, 0x0C, 0x14, 0xEE, 
+0x05, 0x0C, 0x94, 0xFE, 
+0x00, 0x88, 0x10, 0x10, 
+0x05, 0x0D, 0x15, 0x0E, 
+0x05, 0x0D, 0x95, 0x1E, 
+0x00, 0x20, 0x06, 0x43, 
+0x05, 0x4D, 0x15, 0xAE, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0F, 0x01, 0x18, 
+0x0C, 0x0E, 0x03, 0xFE, 
+0x05, 0x0C, 0x95, 0x2E, 
+0x05, 0x2C, 0x95, 0x3E, 
+0x00, 0x84, 0x01, 0x19, 
+0x00, 0xF7, 0xE1, 0x01, 
+0x00, 0x04, 0x45, 0x17, 
+0x0A, 0xE1, 0x03, 0xFF, 
+0x00, 0x00, 0xE0, 0x69, 
+0x00, 0x04, 0x41, 0x10, 
+0x0C, 0x40, 0x03, 0xFB, 
+0x00, 0x1C, 0x80, 0x40, 
+0x00, 0x84, 0x08, 0x81, 
+0x00, 0x8C, 0x18, 0x89, 
+0x0A, 0xBD, 0xDC, 0x02, 
+0x00, 0x00, 0x00, 0x2D, 
+0xC0, 0x00, 0x29, 0xF3, 
+0x88, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x2D, 0xB0, 
+0x8A, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x25, 0xC0, 
+0x81, 0x00, 0x00, 0x00, 
+0x30, 0xE6, 0x68, 0x0F, 
+0x0B, 0xE1, 0xFD, 0x20, 
+0x0B, 0xE1, 0x03, 0xFF, 
+0x0B, 0xA1, 0x01, 0x4D, 
+0x00, 0xD6, 0x2D, 0x08, 
+0x0B, 0xB5, 0x01, 0x4E, 
+0x0A, 0xA1, 0xFD, 0x2A, 
+0x00, 0x84, 0x08, 0x87, 
+0x00, 0x84, 0x18, 0x8E, 
+0x00, 0x04, 0x61, 0x8F, 
+0x0C, 0x82, 0x04, 0x01, 
+0x0A, 0x29, 0x04, 0x02, 
+0x0A, 0xA9, 0x03, 0xFD, 
+0x20, 0xC5, 0x52, 0x2A, 
+0x00, 0x88, 0x10, 0x28, 
+0x0A, 0x2D, 0x04, 0x01, 
+0x0A, 0x31, 0x03, 0xFC, 
+0x00, 0x20, 0x02, 0x48, 
+0x00, 0x20, 0x02, 0x64, 
+0x30, 0x85, 0x93, 0x30, 
+0x00, 0xEE, 0x20, 0x02, 
+0x00, 0x20, 0x01, 0x10, 
+0x00, 0x00, 0xD8, 0x60, 
+0x0A, 0x21, 0xDC, 0xAE, 
+0x00, 0x94, 0x00, 0x20, 
+0x00, 0x00, 0xE8, 0x68, 
+0x00, 0x00, 0x20, 0x80, 
+0x07, 0x04, 0x40, 0x00, 
+0x00, 0x84, 0x19, 0x80, 
+0x00, 0x04, 0x61, 0x98, 
+0x00, 0x84, 0x00, 0x08, 
+0x0B, 0x21, 0x01, 0x50, 
+0x00, 0x04, 0x41, 0x07, 
+0x06, 0x00, 0x15, 0x2E, 
+0x0B, 0x21, 0x01, 0x4F, 
+0x00, 0x04, 0x45, 0x00, 
+0x06, 0x00, 0x15, 0x3E, 
+0x05, 0x4C, 0x95, 0x6E, 
+0x00, 0x04, 0x45, 0x00, 
+0x0B, 0x29, 0x04, 0x02, 
+0x0B, 0x2D, 0x04, 0x01, 
+0x05, 0x4C, 0x95, 0x7E, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0F, 0x01, 0x51, 
+0x0C, 0x0E, 0x04, 0x06, 
+0x05, 0x0C, 0x95, 0x4E, 
+0x05, 0x2C, 0x95, 0x5E, 
+0x00, 0x84, 0x01, 0x19, 
+0x00, 0xF7, 0xE1, 0x01, 
+0x00, 0x04, 0x45, 0x17, 
+0x0A, 0xE1, 0x04, 0x07, 
+0x00, 0x00, 0xE0, 0x69, 
+0x00, 0x04, 0x41, 0x10, 
+0x0C, 0x40, 0x04, 0x03, 
+0x00, 0x1C, 0x80, 0x40, 
+0x00, 0x84, 0x08, 0x81, 
+0x00, 0x8C, 0x18, 0x89, 
+0x0A, 0xBD, 0xDC, 0x02, 
+0x00, 0x00, 0x00, 0x2D, 
+0xC0, 0x00, 0x29, 0xF3, 
+0x88, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x2D, 0xB0, 
+0x8A, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x25, 0xC0, 
+0x81, 0x00, 0x00, 0x00, 
+0x30, 0xE6, 0x68, 0x0F, 
+0x0B, 0xE1, 0xFD, 0x20, 
+0x0B, 0xE1, 0x04, 0x07, 
+0x0B, 0xA1, 0x01, 0x86, 
+0x00, 0xD6, 0x2D, 0x08, 
+0x0B, 0xB5, 0x01, 0x87, 
+0x0A, 0xA1, 0xFD, 0x2A, 
+0x00, 0x84, 0x08, 0x87, 
+0x00, 0x84, 0x18, 0x8E, 
+0x00, 0x04, 0x61, 0x8F, 
+0x0C, 0x82, 0x04, 0x09, 
+0x0A, 0x29, 0x04, 0x0A, 
+0x0A, 0xA9, 0x04, 0x05, 
+0x20, 0xC5, 0x52, 0x2A, 
+0x00, 0x88, 0x10, 0x28, 
+0x0A, 0x2D, 0x04, 0x09, 
+0x0A, 0x31, 0x04, 0x04, 
+0x00, 0x20, 0x02, 0x48, 
+0x00, 0x20, 0x02, 0x64, 
+0x30, 0x85, 0x93, 0x30, 
+0x00, 0xEE, 0x20, 0x02, 
+0x00, 0x20, 0x01, 0x10, 
+0x00, 0x00, 0xD8, 0x60, 
+0x0A, 0x21, 0xDC, 0xAE, 
+0x00, 0x94, 0x00, 0x20, 
+0x00, 0x00, 0xE8, 0x68, 
+0x00, 0x00, 0x20, 0x80, 
+0x07, 0x04, 0x40, 0x00, 
+0x00, 0x84, 0x19, 0x80, 
+0x00, 0x04, 0x61, 0x98, 
+0x00, 0x84, 0x00, 0x08, 
+0x0B, 0x21, 0x01, 0x89, 
+0x00, 0x04, 0x41, 0x07, 
+0x06, 0x00, 0x15, 0x4E, 
+0x0B, 0x21, 0x01, 0x88, 
+0x00, 0x04, 0x45, 0x00, 
+0x06, 0x00, 0x15, 0x5E, 
+0x05, 0x4C, 0x95, 0x8E, 
+0x00, 0x04, 0x45, 0x00, 
+0x0B, 0x29, 0x04, 0x0A, 
+0x0B, 0x2D, 0x04, 0x09, 
+0x05, 0x4C, 0x95, 0x9E, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0F, 0x01, 0x8A, 
+0x05, 0x0C, 0x95, 0x6E, 
+0x05, 0x2C, 0x95, 0x7E, 
+0x00, 0x84, 0x01, 0x19, 
+0x00, 0xF7, 0xE1, 0x01, 
+0x0A, 0xE1, 0x04, 0x0E, 
+0x00, 0x00, 0xE0, 0x69, 
+0x00, 0x04, 0x41, 0x10, 
+0x0C, 0x40, 0x04, 0x0B, 
+0x00, 0x1C, 0x80, 0x40, 
+0x00, 0x84, 0x08, 0x81, 
+0x00, 0x8C, 0x18, 0x89, 
+0x0A, 0xBD, 0xDC, 0x02, 
+0x00, 0x00, 0x00, 0x2D, 
+0xC0, 0x00, 0x29, 0xF3, 
+0x88, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x2D, 0xB0, 
+0x8A, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x25, 0xC0, 
+0x81, 0x00, 0x00, 0x00, 
+0x30, 0xE6, 0x68, 0x0F, 
+0x0B, 0xE1, 0xFD, 0x20, 
+0x0B, 0xE1, 0x04, 0x0E, 
+0x0A, 0xA1, 0xFD, 0x2A, 
+0x00, 0x84, 0x08, 0x87, 
+0x00, 0x84, 0x18, 0x8E, 
+0x00, 0x04, 0x61, 0x8F, 
+0x0C, 0x82, 0x04, 0x10, 
+0x0A, 0x29, 0x04, 0x11, 
+0x0A, 0xA9, 0x04, 0x0D, 
+0x20, 0xC5, 0x52, 0x2A, 
+0x00, 0x88, 0x10, 0x28, 
+0x0A, 0x2D, 0x04, 0x10, 
+0x0A, 0x31, 0x04, 0x0C, 
+0x00, 0x20, 0x02, 0x48, 
+0x00, 0x20, 0x02, 0x64, 
+0x30, 0x85, 0x93, 0x30, 
+0x00, 0xEE, 0x20, 0x02, 
+0x00, 0x20, 0x01, 0x10, 
+0x00, 0x00, 0xD8, 0x60, 
+0x0A, 0x21, 0xDC, 0xAE, 
+0x00, 0x94, 0x00, 0x20, 
+0x00, 0x00, 0xE8, 0x68, 
+0x00, 0x00, 0x20, 0x80, 
+0x07, 0x04, 0x40, 0x00, 
+0x00, 0x84, 0x19, 0x80, 
+0x00, 0x04, 0x61, 0x98, 
+0x00, 0x84, 0x00, 0x08, 
+0x06, 0x00, 0x15, 0x6E, 
+0x00, 0x04, 0x45, 0x00, 
+0x06, 0x00, 0x15, 0x7E, 
+0x05, 0x4C, 0x95, 0xFE, 
+0x00, 0x04, 0x45, 0x00, 
+0x0B, 0x29, 0x04, 0x11, 
+0x0B, 0x2D, 0x04, 0x10, 
+0x05, 0x4C, 0x96, 0x0E, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0F, 0x01, 0xC0, 
+0x05, 0x0C, 0x95, 0x8E, 
+0x05, 0x2C, 0x95, 0x9E, 
+0x00, 0x84, 0x01, 0x19, 
+0x00, 0xF7, 0xE1, 0x01, 
+0x0A, 0xE1, 0x04, 0x15, 
+0x00, 0x00, 0xE0, 0x69, 
+0x00, 0x04, 0x41, 0x10, 
+0x0C, 0x40, 0x04, 0x12, 
+0x00, 0x1C, 0x80, 0x40, 
+0x00, 0x84, 0x08, 0x81, 
+0x00, 0x8C, 0x18, 0x89, 
+0x0A, 0xBD, 0xDC, 0x02, 
+0x00, 0x00, 0x00, 0x2D, 
+0xC0, 0x00, 0x29, 0xF3, 
+0x88, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x2D, 0xB0, 
+0x8A, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x25, 0xC0, 
+0x81, 0x00, 0x00, 0x00, 
+0x30, 0xE6, 0x68, 0x0F, 
+0x0B, 0xE1, 0xFD, 0x20, 
+0x0B, 0xE1, 0x04, 0x15, 
+0x0A, 0xA1, 0xFD, 0x2A, 
+0x00, 0x84, 0x08, 0x87, 
+0x00, 0x84, 0x18, 0x8E, 
+0x00, 0x04, 0x61, 0x8F, 
+0x0C, 0x82, 0x04, 0x17, 
+0x0A, 0x29, 0x04, 0x18, 
+0x0A, 0xA9, 0x04, 0x14, 
+0x20, 0xC5, 0x52, 0x2A, 
+0x00, 0x88, 0x10, 0x28, 
+0x0A, 0x2D, 0x04, 0x17, 
+0x0A, 0x31, 0x04, 0x13, 
+0x00, 0x20, 0x02, 0x48, 
+0x00, 0x20, 0x02, 0x64, 
+0x30, 0x85, 0x93, 0x30, 
+0x00, 0xEE, 0x20, 0x02, 
+0x00, 0x20, 0x01, 0x10, 
+0x00, 0x00, 0xD8, 0x60, 
+0x0A, 0x21, 0xDC, 0xAE, 
+0x00, 0x94, 0x00, 0x20, 
+0x00, 0x00, 0xE8, 0x68, 
+0x00, 0x00, 0x20, 0x80, 
+0x07, 0x04, 0x40, 0x00, 
+0x00, 0x84, 0x19, 0x80, 
+0x00, 0x04, 0x61, 0x98, 
+0x00, 0x84, 0x00, 0x08, 
+0x06, 0x00, 0x15, 0x8E, 
+0x00, 0x04, 0x45, 0x00, 
+0x06, 0x00, 0x15, 0x9E, 
+0x05, 0x4C, 0x96, 0x1E, 
+0x00, 0x04, 0x45, 0x00, 
+0x0B, 0x29, 0x04, 0x18, 
+0x0B, 0x2D, 0x04, 0x17, 
+0x05, 0x4C, 0x96, 0x2E, 
+0x05, 0x0C, 0x15, 0xAE, 
+0x05, 0x2C, 0x15, 0xBE, 
+0x0A, 0x3D, 0xDC, 0xDC, 
+0x0A, 0xBD, 0xDC, 0xDC, 
+0x00, 0x85, 0xA6, 0x00, 
+0x00, 0x85, 0xAE, 0x00, 
+0xC0, 0x00, 0x23, 0x40, 
+0x80, 0x00, 0x00, 0x18, 
+0x0E, 0x05, 0x02, 0x34, 
+0x00, 0xA8, 0x20, 0x00, 
+0x00, 0x36, 0x5D, 0x9F, 
+0x00, 0x30, 0x9C, 0x2F, 
+0x00, 0x46, 0xC5, 0xB1, 
+0x00, 0x34, 0x4D, 0x1B, 
+0x00, 0xA8, 0x20, 0x00, 
+0x00, 0x3C, 0x1F, 0x0F, 
+0x00, 0x20, 0x05, 0x18, 
+0x00, 0x20, 0x0D, 0x18, 
+0x00, 0x58, 0x1E, 0x07, 
+0x0E, 0x0D, 0x02, 0x32, 
+0x0F, 0x11, 0x02, 0x32, 
+0x00, 0xA8, 0x10, 0x43, 
+0x00, 0xA5, 0x23, 0x06, 
+0x00, 0x34, 0xDD, 0x3F, 
+0x0A, 0x31, 0x01, 0xF6, 
+0x00, 0x88, 0x10, 0x14, 
+0x00, 0x88, 0x18, 0x94, 
+0x0E, 0x11, 0x02, 0x36, 
+0x00, 0x48, 0xD2, 0x34, 
+0x00, 0x38, 0x92, 0x2C, 
+0x00, 0x00, 0xF2, 0x07, 
+0x00, 0xA8, 0x10, 0x26, 
+0x00, 0x20, 0x05, 0x98, 
+0x00, 0x20, 0x0D, 0x98, 
+0x00, 0x94, 0x10, 0x43, 
+0x00, 0x94, 0x18, 0xCB, 
+0x0A, 0x2D, 0x01, 0xF7, 
+0x00, 0x88, 0x10, 0x23, 
+0x00, 0x88, 0x18, 0xA3, 
+0x00, 0x38, 0x9E, 0x2F, 
+0x0F, 0x05, 0x02, 0x34, 
+0x0F, 0x09, 0x02, 0x36, 
+0x00, 0x84, 0x10, 0x08, 
+0x00, 0x84, 0xA1, 0x00, 
+0x0A, 0x29, 0x02, 0x38, 
+0x0B, 0x25, 0x02, 0x38, 
+0x00, 0x88, 0x10, 0x12, 
+0x05, 0x0C, 0x95, 0xCE, 
+0x00, 0xE6, 0x02, 0x10, 
+0x00, 0x20, 0x02, 0x41, 
+0x00, 0x88, 0x20, 0x02, 
+0x00, 0x20, 0x01, 0x50, 
+0x0A, 0x21, 0x01, 0xF8, 
+0x00, 0x88, 0x10, 0x20, 
+0x00, 0x20, 0x04, 0x40, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0F, 0x01, 0xFA, 
+0x00, 0x00, 0xD8, 0x42, 
+0x05, 0x4D, 0x16, 0x7E, 
+0x05, 0x0C, 0x08, 0x00, 
+0x0A, 0x65, 0x02, 0x39, 
+0x00, 0x84, 0x12, 0x01, 
+0x0C, 0x40, 0x01, 0xF9, 
+0x00, 0x04, 0x49, 0x28, 
+0x00, 0x84, 0x01, 0x12, 
+0x06, 0x10, 0x15, 0xDE, 
+0x00, 0x04, 0x41, 0x18, 
+0x0B, 0x65, 0x02, 0x39, 
+0x05, 0x4C, 0x16, 0xDE, 
+0x06, 0x10, 0x15, 0xEE, 
+0x00, 0x04, 0x41, 0x18, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x16, 0xFE, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x80, 0x02, 0x3D, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x84, 0x02, 0x3C, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x94, 0x02, 0x3B, 
+0x06, 0x10, 0x15, 0xFE, 
+0x06, 0x10, 0x96, 0x0E, 
+0x0C, 0x01, 0xFD, 0xA0, 
+0x00, 0x10, 0x00, 0x08, 
+0x0D, 0x00, 0x02, 0x3B, 
+0x05, 0x4C, 0x16, 0x3E, 
+0x05, 0x6C, 0x16, 0x4E, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x80, 0x02, 0x40, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x84, 0x02, 0x3F, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x94, 0x02, 0x3E, 
+0x06, 0x10, 0x16, 0x1E, 
+0x06, 0x10, 0x96, 0x2E, 
+0x0C, 0x01, 0xFD, 0xA0, 
+0x00, 0x10, 0x00, 0x08, 
+0x0D, 0x00, 0x02, 0x3E, 
+0x05, 0x4C, 0x16, 0x5E, 
+0x05, 0x6C, 0x16, 0x6E, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x80, 0x02, 0x41, 
+0xC0, 0x00, 0x08, 0x8F, 
+0x8D, 0x84, 0x03, 0xD0, 
+0xC0, 0x00, 0x08, 0x8F, 
+0x8D, 0x94, 0x03, 0xD2, 
+0x06, 0x00, 0x10, 0x8E, 
+0x06, 0x02, 0x10, 0x9E, 
+0x06, 0x00, 0x96, 0x3E, 
+0x06, 0x02, 0x96, 0x4E, 
+0x0C, 0x51, 0xFD, 0xA0, 
+0xE0, 0x00, 0x00, 0x03, 
+0x88, 0x00, 0x00, 0x00, 
+0x0D, 0x50, 0x03, 0xD2, 
+0x05, 0x4C, 0x16, 0x8E, 
+0x05, 0x6C, 0x16, 0x9E, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x80, 0x02, 0x42, 
+0xC0, 0x00, 0x08, 0x8F, 
+0x8D, 0x84, 0x03, 0xD4, 
+0xC0, 0x00, 0x08, 0x8F, 
+0x8D, 0x94, 0x03, 0xD6, 
+0x06, 0x00, 0x10, 0xAE, 
+0x06, 0x02, 0x10, 0xBE, 
+0x06, 0x00, 0x96, 0x5E, 
+0x06, 0x02, 0x96, 0x6E, 
+0x0C, 0x51, 0xFD, 0xA0, 
+0xE0, 0x00, 0x00, 0x03, 
+0x88, 0x00, 0x00, 0x00, 
+0x0D, 0x50, 0x03, 0xD6, 
+0x05, 0x4C, 0x16, 0xAE, 
+0x05, 0x6C, 0x16, 0xBE, 
+0x06, 0x00, 0x16, 0x7E, 
+0x0D, 0x00, 0x00, 0x18, 
+0x05, 0x0C, 0x16, 0x8E, 
+0x00, 0x84, 0xA8, 0x00, 
+0x0C, 0x00, 0x02, 0x43, 
+0x0A, 0x25, 0x02, 0x44, 
+0x00, 0x00, 0xE8, 0x69, 
+0x00, 0x86, 0x41, 0x10, 
+0x00, 0x00, 0xE8, 0xE9, 
+0x00, 0x06, 0x21, 0x08, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x18, 0x2E, 
+0x0B, 0xA1, 0x02, 0x43, 
+0x05, 0x0C, 0x16, 0x9E, 
+0x00, 0x84, 0xA8, 0x00, 
+0x0C, 0x00, 0x02, 0x45, 
+0x0A, 0x25, 0x02, 0x46, 
+0x00, 0x00, 0xE8, 0x69, 
+0x00, 0x86, 0x41, 0x10, 
+0x00, 0x00, 0xE8, 0xE9, 
+0x00, 0x06, 0x21, 0x08, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x18, 0x5E, 
+0x0B, 0xA1, 0x02, 0x45, 
+0x05, 0x0C, 0x16, 0xAE, 
+0x00, 0x84, 0xA8, 0x00, 
+0x0C, 0x00, 0x02, 0x47, 
+0x0A, 0x25, 0x02, 0x48, 
+0x00, 0x00, 0xE8, 0x69, 
+0x00, 0x86, 0x41, 0x10, 
+0x00, 0x00, 0xE8, 0xE9, 
+0x00, 0x06, 0x21, 0x08, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x18, 0x3E, 
+0x0B, 0xA1, 0x02, 0x47, 
+0x05, 0x0C, 0x16, 0xBE, 
+0x00, 0x84, 0xA8, 0x00, 
+0x0C, 0x00, 0x02, 0x49, 
+0x0A, 0x25, 0x02, 0x4A, 
+0x00, 0x00, 0xE8, 0x69, 
+0x00, 0x86, 0x41, 0x10, 
+0x00, 0x00, 0xE8, 0xE9, 
+0x00, 0x06, 0x21, 0x08, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x18, 0x6E, 
+0x0B, 0xA1, 0x02, 0x49, 
+0x06, 0x04, 0x16, 0xCE, 
+0x06, 0x01, 0x17, 0x2E, 
+0x0C, 0x60, 0x02, 0x4B, 
+0x00, 0x06, 0x40, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x17, 0x3E, 
+0x06, 0x04, 0x16, 0xEE, 
+0x06, 0x01, 0x17, 0x0E, 
+0x0C, 0x60, 0x02, 0x4E, 
+0x00, 0x06, 0x40, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x17, 0x1E, 
+0x06, 0x04, 0x17, 0x0E, 
+0x06, 0x01, 0x17, 0x6E, 
+0x0C, 0x60, 0x02, 0x51, 
+0x00, 0x06, 0x40, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x17, 0x7E, 
+0x06, 0x04, 0x17, 0x2E, 
+0x06, 0x01, 0x17, 0x4E, 
+0x0C, 0x60, 0x02, 0x54, 
+0x00, 0x06, 0x40, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x05, 0x4C, 0x17, 0x5E, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0E, 0x00, 0xCB, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x1D, 0x00, 0x2E, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x6F, 0x02, 0x57, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x7F, 0x00, 0x71, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x2F, 0x00, 0x8A, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x3F, 0x02, 0x70, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x80, 0x02, 0x89, 
+0x03, 0x05, 0x03, 0xFA, 
+0xC0, 0x00, 0x0D, 0x91, 
+0x80, 0x42, 0xFD, 0x84, 
+0xC0, 0x00, 0x0D, 0x81, 
+0x80, 0x06, 0xFD, 0x94, 
+0x00, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x0B, 0x91, 
+0x80, 0x46, 0xFD, 0xA0, 
+0xC0, 0x00, 0x0C, 0x11, 
+0x80, 0x12, 0xFD, 0x84, 
+0xC0, 0x00, 0x0C, 0x01, 
+0x80, 0x06, 0xFD, 0x94, 
+0x00, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x0A, 0x11, 
+0x80, 0x16, 0xFD, 0xA0, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x6F, 0x02, 0x57, 
+0x03, 0x05, 0x04, 0x0B, 
+0xC0, 0x00, 0x0D, 0x81, 
+0x80, 0x43, 0xFD, 0x84, 
+0xC0, 0x00, 0x0D, 0x91, 
+0x80, 0x07, 0xFD, 0x94, 
+0x00, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x0B, 0x81, 
+0x80, 0x47, 0xFD, 0xA0, 
+0xC0, 0x00, 0x0C, 0x01, 
+0x80, 0x13, 0xFD, 0x84, 
+0xC0, 0x00, 0x0C, 0x11, 
+0x80, 0x07, 0xFD, 0x94, 
+0x00, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x0A, 0x01, 
+0x80, 0x17, 0xFD, 0xA0, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x7F, 0x00, 0x71, 
+0x05, 0x0C, 0x17, 0x5E, 
+0x05, 0x2C, 0x17, 0x7E, 
+0xFC, 0x74, 0x80, 0x00, 
+0x80, 0x02, 0x09, 0xC3, 
+0xE0, 0x3A, 0x80, 0x00, 
+0x80, 0x00, 0x01, 0x22, 
+0xF0, 0x68, 0x80, 0x0B, 
+0x88, 0x02, 0x3D, 0xC2, 
+0x03, 0x05, 0x04, 0x22, 
+0xE0, 0xA1, 0x00, 0x07, 
+0x8C, 0x0A, 0x05, 0x22, 
+0xFA, 0x64, 0xE8, 0x4F, 
+0x88, 0x83, 0xC7, 0x22, 
+0xF4, 0x66, 0xE8, 0xC3, 
+0x88, 0x83, 0xC5, 0x3E, 
+0xE2, 0xA5, 0x00, 0x07, 
+0x8C, 0x8A, 0x05, 0x22, 
+0xF1, 0x74, 0xE0, 0x4F, 
+0x88, 0x02, 0x05, 0xC3, 
+0xF0, 0x68, 0xE0, 0xCB, 
+0x88, 0x02, 0x3D, 0xC2, 
+0xE0, 0xA1, 0x00, 0x00, 
+0x80, 0x00, 0x00, 0x20, 
+0x05, 0x4C, 0x17, 0x8E, 
+0x05, 0x6C, 0x17, 0x9E, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0F, 0x02, 0x8A, 
+0x0C, 0x0E, 0x04, 0x1C, 
+0x05, 0x0C, 0x97, 0x8E, 
+0x05, 0x2C, 0x97, 0x9E, 
+0x00, 0x84, 0x01, 0x19, 
+0x00, 0xF7, 0xE1, 0x01, 
+0x00, 0x04, 0x45, 0x17, 
+0x0A, 0xE1, 0x04, 0x1D, 
+0x00, 0x00, 0xE0, 0x69, 
+0x00, 0x04, 0x41, 0x10, 
+0x0C, 0x40, 0x04, 0x19, 
+0x00, 0x1C, 0x80, 0x40, 
+0x00, 0x84, 0x08, 0x81, 
+0x00, 0x8C, 0x18, 0x89, 
+0x0A, 0xBD, 0xDC, 0x02, 
+0x00, 0x00, 0x00, 0x2D, 
+0xC0, 0x00, 0x29, 0xF3, 
+0x88, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x2D, 0xB0, 
+0x8A, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x25, 0xC0, 
+0x81, 0x00, 0x00, 0x00, 
+0x30, 0xE6, 0x68, 0x0F, 
+0x0B, 0xE1, 0xFD, 0x20, 
+0x0B, 0xE1, 0x04, 0x1D, 
+0x0B, 0xA1, 0x02, 0xBF, 
+0x00, 0xD6, 0x2D, 0x08, 
+0x0B, 0xB5, 0x02, 0xC0, 
+0x0A, 0xA1, 0xFD, 0x2A, 
+0x00, 0x84, 0x08, 0x87, 
+0x00, 0x84, 0x18, 0x8E, 
+0x00, 0x04, 0x61, 0x8F, 
+0x0C, 0x82, 0x04, 0x1F, 
+0x0A, 0x29, 0x04, 0x20, 
+0x0A, 0xA9, 0x04, 0x1B, 
+0x20, 0xC5, 0x52, 0x2A, 
+0x00, 0x88, 0x10, 0x28, 
+0x0A, 0x2D, 0x04, 0x1F, 
+0x0A, 0x31, 0x04, 0x1A, 
+0x00, 0x20, 0x02, 0x48, 
+0x00, 0x20, 0x02, 0x64, 
+0x30, 0x85, 0x93, 0x30, 
+0x00, 0xEE, 0x20, 0x02, 
+0x00, 0x20, 0x01, 0x10, 
+0x00, 0x00, 0xD8, 0x60, 
+0x0A, 0x21, 0xDC, 0xAE, 
+0x00, 0x94, 0x00, 0x20, 
+0x00, 0x00, 0xE8, 0x68, 
+0x00, 0x00, 0x20, 0x80, 
+0x07, 0x04, 0x40, 0x00, 
+0x00, 0x84, 0x19, 0x80, 
+0x00, 0x04, 0x61, 0x98, 
+0x00, 0x84, 0x00, 0x08, 
+0x0B, 0x21, 0x02, 0xC2, 
+0x00, 0x04, 0x41, 0x07, 
+0x06, 0x00, 0x17, 0x8E, 
+0x0B, 0x21, 0x02, 0xC1, 
+0x00, 0x04, 0x45, 0x00, 
+0x06, 0x00, 0x17, 0x9E, 
+0x05, 0x4C, 0x97, 0xAE, 
+0x00, 0x04, 0x45, 0x00, 
+0x0B, 0x29, 0x04, 0x20, 
+0x0B, 0x2D, 0x04, 0x1F, 
+0x05, 0x4C, 0x97, 0xBE, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0F, 0x02, 0xC3, 
+0x05, 0x0C, 0x97, 0xAE, 
+0x05, 0x2C, 0x97, 0xBE, 
+0x00, 0x84, 0x01, 0x19, 
+0x00, 0xF7, 0xE1, 0x01, 
+0x0A, 0xE1, 0x04, 0x24, 
+0x00, 0x00, 0xE0, 0x69, 
+0x00, 0x04, 0x41, 0x10, 
+0x0C, 0x40, 0x04, 0x21, 
+0x00, 0x1C, 0x80, 0x40, 
+0x00, 0x84, 0x08, 0x81, 
+0x00, 0x8C, 0x18, 0x89, 
+0x0A, 0xBD, 0xDC, 0x02, 
+0x00, 0x00, 0x00, 0x2D, 
+0xC0, 0x00, 0x29, 0xF3, 
+0x88, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x2D, 0xB0, 
+0x8A, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x25, 0xC0, 
+0x81, 0x00, 0x00, 0x00, 
+0x30, 0xE6, 0x68, 0x0F, 
+0x0B, 0xE1, 0xFD, 0x20, 
+0x0B, 0xE1, 0x04, 0x24, 
+0x0A, 0xA1, 0xFD, 0x2A, 
+0x00, 0x84, 0x08, 0x87, 
+0x00, 0x84, 0x18, 0x8E, 
+0x00, 0x04, 0x61, 0x8F, 
+0x0C, 0x82, 0x04, 0x26, 
+0x0A, 0x29, 0x04, 0x27, 
+0x0A, 0xA9, 0x04, 0x23, 
+0x20, 0xC5, 0x52, 0x2A, 
+0x00, 0x88, 0x10, 0x28, 
+0x0A, 0x2D, 0x04, 0x26, 
+0x0A, 0x31, 0x04, 0x22, 
+0x00, 0x20, 0x02, 0x48, 
+0x00, 0x20, 0x02, 0x64, 
+0x30, 0x85, 0x93, 0x30, 
+0x00, 0xEE, 0x20, 0x02, 
+0x00, 0x20, 0x01, 0x10, 
+0x00, 0x00, 0xD8, 0x60, 
+0x0A, 0x21, 0xDC, 0xAE, 
+0x00, 0x94, 0x00, 0x20, 
+0x00, 0x00, 0xE8, 0x68, 
+0x00, 0x00, 0x20, 0x80, 
+0x07, 0x04, 0x40, 0x00, 
+0x00, 0x84, 0x19, 0x80, 
+0x00, 0x04, 0x61, 0x98, 
+0x00, 0x84, 0x00, 0x08, 
+0x06, 0x00, 0x17, 0xAE, 
+0x00, 0x04, 0x45, 0x00, 
+0x06, 0x00, 0x17, 0xBE, 
+0x05, 0x4C, 0x97, 0xCE, 
+0x00, 0x04, 0x45, 0x00, 
+0x0B, 0x29, 0x04, 0x27, 
+0x0B, 0x2D, 0x04, 0x26, 
+0x05, 0x4C, 0x97, 0xDE, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x80, 0x02, 0xFB, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x84, 0x02, 0xFA, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x94, 0x02, 0xF9, 
+0x06, 0x10, 0x17, 0xCE, 
+0x06, 0x10, 0x97, 0xDE, 
+0x0C, 0x01, 0xFD, 0xA0, 
+0x00, 0x10, 0x00, 0x08, 
+0x0D, 0x00, 0x02, 0xF9, 
+0x05, 0x4C, 0x17, 0xEE, 
+0x05, 0x6C, 0x17, 0xFE, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x80, 0x02, 0xFC, 
+0xC0, 0x00, 0x08, 0x8F, 
+0x8D, 0x84, 0x03, 0xD8, 
+0xC0, 0x00, 0x08, 0x8F, 
+0x8D, 0x94, 0x03, 0xDA, 
+0x06, 0x00, 0x17, 0xEE, 
+0x06, 0x02, 0x17, 0xFE, 
+0x06, 0x00, 0x90, 0xCE, 
+0x06, 0x02, 0x90, 0xDE, 
+0x0C, 0x51, 0xFD, 0xA0, 
+0xE0, 0x00, 0x00, 0x03, 
+0x88, 0x00, 0x00, 0x00, 
+0x0D, 0x50, 0x03, 0xDA, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x18, 0x0E, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x6C, 0x18, 0x1E, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x0C, 0x18, 0x0E, 
+0x00, 0x84, 0xA8, 0x00, 
+0x0C, 0x00, 0x02, 0xFD, 
+0x0A, 0x25, 0x02, 0xFE, 
+0x00, 0x00, 0xE8, 0x69, 
+0x00, 0x86, 0x41, 0x10, 
+0x00, 0x00, 0xE8, 0xE9, 
+0x00, 0x06, 0x21, 0x08, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x18, 0x4E, 
+0x0B, 0xA1, 0x02, 0xFD, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x0C, 0x18, 0x1E, 
+0x00, 0x84, 0xA8, 0x00, 
+0x0C, 0x00, 0x02, 0xFF, 
+0x0A, 0x25, 0x03, 0x00, 
+0x00, 0x00, 0xE8, 0x69, 
+0x00, 0x86, 0x41, 0x10, 
+0x00, 0x00, 0xE8, 0xE9, 
+0x00, 0x06, 0x21, 0x08, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x18, 0x7E, 
+0x0B, 0xA1, 0x02, 0xFF, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x0C, 0x18, 0x2E, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x2C, 0x18, 0x3E, 
+0x00, 0x84, 0x00, 0x08, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x2C, 0x18, 0x4E, 
+0x00, 0x84, 0x00, 0x08, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x18, 0x8E, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x0C, 0x18, 0x5E, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x2C, 0x18, 0x6E, 
+0x00, 0x84, 0x00, 0x08, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x2C, 0x18, 0x7E, 
+0x00, 0x84, 0x00, 0x08, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x18, 0x9E, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x0C, 0x18, 0x8E, 
+0x00, 0x84, 0xA1, 0x00, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x60, 0x03, 0x01, 
+0x0A, 0xE1, 0x03, 0x02, 
+0x0C, 0x40, 0x04, 0x28, 
+0x00, 0x1C, 0x82, 0x40, 
+0x00, 0x84, 0x08, 0x81, 
+0x00, 0x84, 0x18, 0x89, 
+0x0B, 0xA1, 0xFD, 0x64, 
+0x0B, 0xE1, 0x03, 0x02, 
+0x0A, 0x25, 0x03, 0x01, 
+0x00, 0x88, 0x10, 0x81, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x2C, 0x1E, 0x4E, 
+0x00, 0x00, 0x00, 0x23, 
+0x0C, 0x40, 0x04, 0x29, 
+0x00, 0x00, 0xE0, 0x28, 
+0x0A, 0x21, 0xDC, 0x30, 
+0x3A, 0x21, 0xFD, 0x68, 
+0x00, 0x88, 0x10, 0x08, 
+0x00, 0x1D, 0x00, 0x80, 
+0x00, 0x84, 0x11, 0x2A, 
+0x00, 0x84, 0x01, 0x18, 
+0x00, 0x20, 0x03, 0x01, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x1E, 0x5E, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x1E, 0x3E, 
+0x00, 0x04, 0x41, 0x00, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x60, 0x9E, 0x2E, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x18, 0xAE, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x0C, 0x18, 0x9E, 
+0x00, 0x84, 0xA1, 0x00, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x60, 0x03, 0x04, 
+0x0A, 0xE1, 0x03, 0x05, 
+0x0C, 0x40, 0x04, 0x2A, 
+0x00, 0x1C, 0x82, 0x40, 
+0x00, 0x84, 0x08, 0x81, 
+0x00, 0x84, 0x18, 0x89, 
+0x0B, 0xA1, 0xFD, 0x64, 
+0x0B, 0xE1, 0x03, 0x05, 
+0x0A, 0x25, 0x03, 0x04, 
+0x00, 0x88, 0x10, 0x81, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x2C, 0x1E, 0x8E, 
+0x00, 0x00, 0x00, 0x23, 
+0x0C, 0x40, 0x04, 0x2B, 
+0x00, 0x00, 0xE0, 0x28, 
+0x0A, 0x21, 0xDC, 0x30, 
+0x3A, 0x21, 0xFD, 0x68, 
+0x00, 0x88, 0x10, 0x08, 
+0x00, 0x1D, 0x00, 0x80, 
+0x00, 0x84, 0x11, 0x2A, 
+0x00, 0x84, 0x01, 0x18, 
+0x00, 0x20, 0x03, 0x01, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x1E, 0x9E, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x1E, 0x7E, 
+0x00, 0x04, 0x41, 0x00, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x60, 0x9E, 0x6E, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x18, 0xBE, 
+0x0C, 0x10, 0x04, 0x2C, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x10, 0x18, 0x8E, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x10, 0x98, 0x9E, 
+0x00, 0x06, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x18, 0xCE, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x0C, 0x18, 0xAE, 
+0x00, 0x84, 0xA8, 0x00, 
+0x0C, 0x00, 0x03, 0x07, 
+0x0A, 0x25, 0x03, 0x08, 
+0x00, 0x00, 0xE8, 0x69, 
+0x00, 0x86, 0x41, 0x10, 
+0x00, 0x00, 0xE8, 0xE9, 
+0x00, 0x06, 0x21, 0x08, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x19, 0x1E, 
+0x0B, 0xA1, 0x03, 0x07, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x0C, 0x18, 0xBE, 
+0x00, 0x84, 0xA8, 0x00, 
+0x0C, 0x00, 0x03, 0x09, 
+0x0A, 0x25, 0x03, 0x0A, 
+0x00, 0x00, 0xE8, 0x69, 
+0x00, 0x86, 0x41, 0x10, 
+0x00, 0x00, 0xE8, 0xE9, 
+0x00, 0x06, 0x21, 0x08, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x19, 0x0E, 
+0x0B, 0xA1, 0x03, 0x09, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x0C, 0x18, 0xCE, 
+0x00, 0x84, 0xA1, 0x00, 
+0xC0, 0x00, 0x08, 0x0F, 
+0x8D, 0x60, 0x03, 0x0B, 
+0x0A, 0xE1, 0x03, 0x0C, 
+0x0C, 0x40, 0x04, 0x2E, 
+0x00, 0x1C, 0x82, 0x40, 
+0x00, 0x84, 0x08, 0x81, 
+0x00, 0x84, 0x18, 0x89, 
+0x0B, 0xA1, 0xFD, 0x64, 
+0x0B, 0xE1, 0x03, 0x0C, 
+0x0A, 0x25, 0x03, 0x0B, 
+0x00, 0x88, 0x10, 0x81, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x2C, 0x1E, 0xCE, 
+0x00, 0x00, 0x00, 0x23, 
+0x0C, 0x40, 0x04, 0x2F, 
+0x00, 0x00, 0xE0, 0x28, 
+0x0A, 0x21, 0xDC, 0x30, 
+0x3A, 0x21, 0xFD, 0x68, 
+0x00, 0x88, 0x10, 0x08, 
+0x00, 0x1D, 0x00, 0x80, 
+0x00, 0x84, 0x11, 0x2A, 
+0x00, 0x84, 0x01, 0x18, 
+0x00, 0x20, 0x03, 0x01, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x1E, 0xDE, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x1E, 0xBE, 
+0x00, 0x04, 0x41, 0x00, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x60, 0x9E, 0xAE, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x18, 0xFE, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x0F, 0x98, 0xFE, 
+0x05, 0x4F, 0x84, 0x7D, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x0F, 0x18, 0xFE, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4F, 0x1F, 0x6E, 
+0x0C, 0x4E, 0x04, 0x30, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0E, 0x00, 0xF7, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x1F, 0x03, 0x0E, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x08, 0x18, 0xDE, 
+0x06, 0x18, 0x40, 0x31, 
+0xF1, 0x6C, 0x80, 0x01, 
+0x88, 0x00, 0x01, 0x22, 
+0xF0, 0x6C, 0x80, 0x21, 
+0x81, 0x82, 0x04, 0x23, 
+0x00, 0x04, 0x41, 0x0F, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x04, 0x9E, 0xEE, 
+0xE0, 0x34, 0xA2, 0x05, 
+0x81, 0x80, 0x00, 0x20, 
+0xE0, 0x80, 0x00, 0x25, 
+0x8C, 0x00, 0x00, 0x00, 
+0x00, 0x84, 0x01, 0x19, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x9F, 0x0E, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0D, 0x00, 0x48, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x1F, 0x00, 0xA3, 
+0x06, 0x08, 0x04, 0x5D, 
+0x06, 0x18, 0x50, 0x31, 
+0xF6, 0x62, 0x80, 0x01, 
+0x88, 0x02, 0x44, 0x00, 
+0xF6, 0x78, 0x80, 0x21, 
+0x81, 0x80, 0x47, 0x02, 
+0xFA, 0x7A, 0xA2, 0x05, 
+0x81, 0x82, 0x4A, 0x00, 
+0xF6, 0x41, 0x00, 0x25, 
+0x8C, 0x00, 0x47, 0x02, 
+0xFA, 0x78, 0xA6, 0x41, 
+0x83, 0x82, 0x4A, 0x00, 
+0xF6, 0x43, 0x00, 0x21, 
+0x8E, 0x04, 0x47, 0x02, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x04, 0x99, 0x2E, 
+0xFA, 0x40, 0x22, 0x05, 
+0x81, 0x80, 0x40, 0x00, 
+0xE0, 0x01, 0x00, 0x25, 
+0x8C, 0x00, 0x00, 0x00, 
+0x00, 0x84, 0x01, 0x19, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x99, 0x4E, 
+0x0C, 0x4C, 0x04, 0x31, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0E, 0x00, 0xFA, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x1F, 0x03, 0x18, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x08, 0x1F, 0x4E, 
+0x06, 0x18, 0x40, 0x31, 
+0xF1, 0x6C, 0x80, 0x01, 
+0x88, 0x00, 0x01, 0x22, 
+0xF0, 0x6C, 0x80, 0x21, 
+0x81, 0x82, 0x04, 0x23, 
+0x00, 0x04, 0x41, 0x0E, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x04, 0x9F, 0x1E, 
+0xE0, 0x34, 0xA2, 0x05, 
+0x81, 0x80, 0x00, 0x20, 
+0xE0, 0x80, 0x00, 0x25, 
+0x8C, 0x00, 0x00, 0x00, 
+0x00, 0x84, 0x01, 0x19, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x9F, 0x3E, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x0F, 0x98, 0xFE, 
+0x05, 0x4F, 0x85, 0x1D, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x0F, 0x18, 0xFE, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0xCF, 0x10, 0x5E, 
+0x0C, 0x4E, 0x04, 0x32, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0E, 0x01, 0x06, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x1F, 0x03, 0x22, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x08, 0x18, 0xDE, 
+0x06, 0x18, 0x40, 0x31, 
+0xF1, 0x6C, 0x80, 0x01, 
+0x88, 0x00, 0x01, 0x22, 
+0xF0, 0x6C, 0x80, 0x21, 
+0x81, 0x82, 0x04, 0x23, 
+0x00, 0x04, 0x41, 0x0F, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x04, 0x99, 0x5E, 
+0xE0, 0x34, 0xA2, 0x05, 
+0x81, 0x80, 0x00, 0x20, 
+0xE0, 0x80, 0x00, 0x25, 
+0x8C, 0x00, 0x00, 0x00, 
+0x00, 0x84, 0x01, 0x19, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x99, 0x7E, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0D, 0x00, 0x52, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x1F, 0x00, 0xB7, 
+0x06, 0x08, 0x04, 0xFD, 
+0x06, 0x18, 0x50, 0x31, 
+0xF6, 0x62, 0x80, 0x01, 
+0x88, 0x02, 0x44, 0x00, 
+0xF6, 0x78, 0x80, 0x21, 
+0x81, 0x80, 0x47, 0x02, 
+0xFA, 0x7A, 0xA2, 0x05, 
+0x81, 0x82, 0x4A, 0x00, 
+0xF6, 0x41, 0x00, 0x25, 
+0x8C, 0x00, 0x47, 0x02, 
+0xFA, 0x78, 0xA6, 0x41, 
+0x83, 0x82, 0x4A, 0x00, 
+0xF6, 0x43, 0x00, 0x21, 
+0x8E, 0x04, 0x47, 0x02, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x04, 0x9F, 0xDE, 
+0xFA, 0x40, 0x22, 0x05, 
+0x81, 0x80, 0x40, 0x00, 
+0xE0, 0x01, 0x00, 0x25, 
+0x8C, 0x00, 0x00, 0x00, 
+0x00, 0x84, 0x01, 0x19, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x9F, 0xFE, 
+0x0C, 0x4C, 0x04, 0x33, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0E, 0x01, 0x09, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x1F, 0x03, 0x2C, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x88, 0x10, 0x3E, 
+0x06, 0x18, 0x40, 0x31, 
+0xF1, 0x6C, 0x80, 0x01, 
+0x88, 0x00, 0x01, 0x22, 
+0xF0, 0x6C, 0x80, 0x21, 
+0x81, 0x82, 0x04, 0x23, 
+0x00, 0x04, 0x41, 0x0E, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x84, 0x90, 0x0E, 
+0xE0, 0x34, 0xA2, 0x05, 
+0x81, 0x80, 0x00, 0x20, 
+0xE0, 0x80, 0x00, 0x25, 
+0x8C, 0x00, 0x00, 0x00, 
+0x00, 0x84, 0x01, 0x19, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0xCC, 0x90, 0x2E, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x00, 0x19, 0x0E, 
+0x0D, 0x00, 0xFC, 0xC1, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x00, 0x19, 0x1E, 
+0x0D, 0x00, 0xFC, 0xC0, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x00, 0x19, 0x1E, 
+0x0D, 0x00, 0xFC, 0xF0, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x00, 0x19, 0x0E, 
+0x0D, 0x00, 0xFC, 0xF1, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x00, 0x19, 0x1E, 
+0x0D, 0x00, 0xFC, 0xE8, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x00, 0x19, 0x0E, 
+0x0D, 0x00, 0xFC, 0xE9, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x0C, 0x19, 0x4E, 
+0x00, 0x84, 0xA8, 0x00, 
+0x0C, 0x00, 0x03, 0x36, 
+0x0A, 0x25, 0x03, 0x37, 
+0x00, 0x00, 0xE8, 0x69, 
+0x00, 0x86, 0x41, 0x10, 
+0x00, 0x00, 0xE8, 0xE9, 
+0x00, 0x06, 0x21, 0x08, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x19, 0x9E, 
+0x0B, 0xA1, 0x03, 0x36, 
+0x0C, 0x60, 0x03, 0x3A, 
+0x0C, 0x00, 0x03, 0x39, 
+0x0A, 0x29, 0x03, 0x38, 
+0x00, 0x10, 0x90, 0x50, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x2C, 0x19, 0x7E, 
+0x00, 0x42, 0x44, 0x48, 
+0x00, 0x84, 0x18, 0x81, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0F, 0x03, 0x3D, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x1E, 0x01, 0x0C, 
+0xF1, 0x40, 0x00, 0x25, 
+0x84, 0x20, 0x40, 0x00, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x6C, 0x19, 0x8E, 
+0x0F, 0x05, 0x03, 0x38, 
+0xF0, 0x7C, 0x80, 0x00, 
+0x80, 0x00, 0x46, 0x01, 
+0xE0, 0x08, 0x80, 0x02, 
+0x80, 0x00, 0x00, 0x00, 
+0x00, 0x04, 0x45, 0x84, 
+0x00, 0x84, 0x00, 0x01, 
+0x00, 0x00, 0xE0, 0x68, 
+0x00, 0x04, 0x45, 0x00, 
+0x0C, 0x20, 0x03, 0x42, 
+0xE0, 0x80, 0x00, 0x1A, 
+0x88, 0x08, 0x44, 0x00, 
+0xF0, 0x80, 0x00, 0x3A, 
+0x8C, 0x48, 0x4A, 0x00, 
+0x00, 0x00, 0xB5, 0x00, 
+0x00, 0x00, 0xA5, 0x01, 
+0x00, 0x84, 0x11, 0xE6, 
+0x00, 0x84, 0x01, 0x12, 
+0x0A, 0x21, 0xDC, 0x00, 
+0x00, 0x84, 0x02, 0x10, 
+0x0B, 0x29, 0xFD, 0x20, 
+0xC0, 0x00, 0x00, 0x00, 
+0x82, 0x0F, 0x03, 0x66, 
+0x0A, 0x21, 0xFD, 0x28, 
+0x00, 0x00, 0xD8, 0x40, 
+0x0C, 0x00, 0xFD, 0x29, 
+0x0B, 0x65, 0x03, 0x42, 
+0x07, 0x06, 0x88, 0x00, 
+0x00, 0x84, 0x17, 0xD5, 
+0x00, 0x04, 0x59, 0x70, 
+0x00, 0x84, 0x00, 0x56, 
+0x0B, 0x21, 0x03, 0x3C, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x0C, 0x19, 0x8E, 
+0x00, 0x84, 0xA8, 0x00, 
+0x0C, 0x00, 0x03, 0x6E, 
+0x0A, 0x25, 0x03, 0x6F, 
+0x00, 0x00, 0xE8, 0x69, 
+0x00, 0x86, 0x41, 0x10, 
+0x00, 0x00, 0xE8, 0xE9, 
+0x00, 0x06, 0x21, 0x08, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x19, 0xBE, 
+0x0B, 0xA1, 0x03, 0x6E, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x00, 0x19, 0x9E, 
+0x0D, 0x00, 0xFC, 0xD0, 
+0x0C, 0x82, 0x04, 0x34, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x0C, 0x19, 0x9E, 
+0x30, 0x84, 0x30, 0x00, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x19, 0xAE, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x00, 0x19, 0xAE, 
+0x0D, 0x00, 0xFC, 0xD1, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x00, 0x19, 0xBE, 
+0x0D, 0x00, 0xFC, 0xE0, 
+0x0C, 0x82, 0x04, 0x35, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x0C, 0x19, 0xBE, 
+0x30, 0x84, 0x30, 0x00, 
+0xC0, 0x00, 0x00, 0x10, 
+0x80, 0x4C, 0x19, 0xCE, 
+0xC0, 0x00, 0x00, 0x18, 
+0x80, 0x00, 0x19, 0xCE, 
+0x0D, 0x00, 0xFC, 0xE1, 
+0x08, 0x80, 0x00, 0x10, 
+0x08, 0x82, 0x00, 0x14, 
+0x00, 0x00, 0x20, 0x01, 
+0x00, 0x00, 0x21, 0x01, 
+0x09, 0x80, 0x00, 0x10, 
+0x09, 0x82, 0x00, 0x14, 
+0x00, 0x00, 0x00, 0x02, 
+0x0C, 0x10, 0xF4, 0x60, 
+0x02, 0xC2, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 			/* (64) DM0 Data */
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x03, 0x70, 
+0x00, 0x00, 0x03, 0x70, 
+0x00, 0x00, 0x00, 0x5C, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xCC, 
+0x00, 0x00, 0x00, 0xCC, 
+0x00, 0x00, 0x01, 0x14, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0xFE, 0x98, 0xB9, 0xD7, 
+0x01, 0x67, 0x46, 0x29, 
+0x00, 0xFC, 0xB1, 0x71, 
+0x00, 0x00, 0x00, 0x35, 
+0x00, 0x00, 0x67, 0xDE, 
+0x00, 0x00, 0x92, 0xB8, 
+0x00, 0x00, 0xCF, 0x3E, 
+0x00, 0x01, 0x24, 0xBD, 
+0x00, 0x01, 0x9D, 0x81, 
+0x00, 0x02, 0x48, 0x17, 
+0x00, 0x03, 0x39, 0x0D, 
+0x00, 0x04, 0x8D, 0x6A, 
+0x00, 0x06, 0x6E, 0x31, 
+0x00, 0x09, 0x15, 0x4E, 
+0x00, 0x0B, 0x6F, 0x63, 
+0x00, 0x0C, 0xD4, 0x95, 
+0x00, 0x0E, 0x65, 0x5C, 
+0x00, 0x10, 0x27, 0x0B, 
+0x00, 0x12, 0x1F, 0x98, 
+0x00, 0x14, 0x55, 0xB6, 
+0x00, 0x16, 0xD0, 0xE7, 
+0x00, 0x19, 0x99, 0x9A, 
+0x00, 0x1C, 0xB9, 0x43, 
+0x00, 0x20, 0x3A, 0x7E, 
+0x00, 0x24, 0x29, 0x35, 
+0x00, 0x28, 0x92, 0xC2, 
+0x00, 0x2D, 0x86, 0x22, 
+0x00, 0x33, 0x14, 0x27, 
+0x00, 0x39, 0x4F, 0xAF, 
+0x00, 0x40, 0x4D, 0xE6, 
+0x00, 0x48, 0x26, 0x8E, 
+0x00, 0x50, 0xF4, 0x4E, 
+0x00, 0x5A, 0xD5, 0x0D, 
+0x00, 0x65, 0xEA, 0x5A, 
+0x00, 0x72, 0x59, 0xDB, 
+0x00, 0x80, 0x4D, 0xCE, 
+0x00, 0x81, 0xCA, 0x25, 
+0x00, 0x83, 0x4A, 0xE2, 
+0x00, 0x86, 0x59, 0xC8, 
+0x00, 0x89, 0x7A, 0xEA, 
+0x00, 0x8C, 0xAE, 0xB6, 
+0x00, 0x8F, 0xF5, 0x9A, 
+0x00, 0x93, 0x50, 0x08, 
+0x00, 0x96, 0xBE, 0x75, 
+0x00, 0x9A, 0x41, 0x58, 
+0x00, 0x9D, 0xD9, 0x2C, 
+0x00, 0xA1, 0x86, 0x6C, 
+0x00, 0xA5, 0x49, 0x98, 
+0x00, 0xA9, 0x23, 0x35, 
+0x00, 0xAD, 0x13, 0xC6, 
+0x00, 0xB1, 0x1B, 0xD6, 
+0x00, 0xB5, 0x3B, 0xEF, 
+0x00, 0xB9, 0x74, 0xA3, 
+0x00, 0xBD, 0xC6, 0x82, 
+0x00, 0xC2, 0x32, 0x24, 
+0x00, 0xC6, 0xB8, 0x22, 
+0x00, 0xCB, 0x59, 0x18, 
+0x00, 0xD0, 0x15, 0xA9, 
+0x00, 0xD4, 0xEE, 0x78, 
+0x00, 0xD9, 0xE4, 0x2F, 
+0x00, 0xDE, 0xF7, 0x78, 
+0x00, 0xE4, 0x29, 0x05, 
+0x00, 0xE9, 0x79, 0x8B, 
+0x00, 0xEE, 0xE9, 0xC1, 
+0x00, 0xF4, 0x7A, 0x65, 
+0x00, 0xFA, 0x2C, 0x38, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x35, 
+0x00, 0x00, 0x67, 0xDE, 
+0x00, 0x00, 0x92, 0xB8, 
+0x00, 0x00, 0xCF, 0x3E, 
+0x00, 0x01, 0x24, 0xBD, 
+0x00, 0x01, 0x9D, 0x81, 
+0x00, 0x02, 0x48, 0x17, 
+0x00, 0x03, 0x39, 0x0D, 
+0x00, 0x04, 0x8D, 0x6A, 
+0x00, 0x06, 0x6E, 0x31, 
+0x00, 0x09, 0x15, 0x4E, 
+0x00, 0x0B, 0x6F, 0x63, 
+0x00, 0x0C, 0xD4, 0x95, 
+0x00, 0x0E, 0x65, 0x5C, 
+0x00, 0x10, 0x27, 0x0B, 
+0x00, 0x12, 0x1F, 0x98, 
+0x00, 0x14, 0x55, 0xB6, 
+0x00, 0x16, 0xD0, 0xE7, 
+0x00, 0x19, 0x99, 0x9A, 
+0x00, 0x1C, 0xB9, 0x43, 
+0x00, 0x20, 0x3A, 0x7E, 
+0x00, 0x24, 0x29, 0x35, 
+0x00, 0x28, 0x92, 0xC2, 
+0x00, 0x2D, 0x86, 0x22, 
+0x00, 0x33, 0x14, 0x27, 
+0x00, 0x39, 0x4F, 0xAF, 
+0x00, 0x40, 0x4D, 0xE6, 
+0x00, 0x48, 0x26, 0x8E, 
+0x00, 0x50, 0xF4, 0x4E, 
+0x00, 0x5A, 0xD5, 0x0D, 
+0x00, 0x65, 0xEA, 0x5A, 
+0x00, 0x72, 0x59, 0xDB, 
+0x00, 0x80, 0x4D, 0xCE, 
+0x00, 0x81, 0xCA, 0x25, 
+0x00, 0x83, 0x4A, 0xE2, 
+0x00, 0x86, 0x59, 0xC8, 
+0x00, 0x89, 0x7A, 0xEA, 
+0x00, 0x8C, 0xAE, 0xB6, 
+0x00, 0x8F, 0xF5, 0x9A, 
+0x00, 0x93, 0x50, 0x08, 
+0x00, 0x96, 0xBE, 0x75, 
+0x00, 0x9A, 0x41, 0x58, 
+0x00, 0x9D, 0xD9, 0x2C, 
+0x00, 0xA1, 0x86, 0x6C, 
+0x00, 0xA5, 0x49, 0x98, 
+0x00, 0xA9, 0x23, 0x35, 
+0x00, 0xAD, 0x13, 0xC6, 
+0x00, 0xB1, 0x1B, 0xD6, 
+0x00, 0xB5, 0x3B, 0xEF, 
+0x00, 0xB9, 0x74, 0xA3, 
+0x00, 0xBD, 0xC6, 0x82, 
+0x00, 0xC2, 0x32, 0x24, 
+0x00, 0xC6, 0xB8, 0x22, 
+0x00, 0xCB, 0x59, 0x18, 
+0x00, 0xD0, 0x15, 0xA9, 
+0x00, 0xD4, 0xEE, 0x78, 
+0x00, 0xD9, 0xE4, 0x2F, 
+0x00, 0xDE, 0xF7, 0x78, 
+0x00, 0xE4, 0x29, 0x05, 
+0x00, 0xE9, 0x79, 0x8B, 
+0x00, 0xEE, 0xE9, 0xC1, 
+0x00, 0xF4, 0x7A, 0x65, 
+0x00, 0xFA, 0x2C, 0x38, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x20, 0x8A, 
+0xFE, 0x98, 0xB9, 0xD7, 
+0x01, 0x67, 0x46, 0x29, 
+0x00, 0xFC, 0xB1, 0x71, 
+0xFE, 0x98, 0xB9, 0xD7, 
+0x01, 0x67, 0x46, 0x29, 
+0x00, 0xFC, 0xB1, 0x71, 
+0xFE, 0x98, 0xB9, 0xD7, 
+0x01, 0x67, 0x46, 0x29, 
+0x00, 0xFC, 0xB1, 0x71, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x16, 0x71, 0x08, 
+0x00, 0x13, 0x02, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x16, 0x71, 0x08, 
+0x00, 0x13, 0x02, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x16, 0x71, 0x08, 
+0x00, 0x13, 0x02, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x16, 0x71, 0x08, 
+0x00, 0x13, 0x02, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3D, 0x8B, 0x64, 
+0x00, 0x9E, 0xC5, 0xB2, 
+0x01, 0x00, 0x00, 0x00, 
+0xFF, 0xC2, 0x74, 0x9C, 
+0xFF, 0x61, 0x3A, 0x4E, 
+0x00, 0x00, 0x20, 0x8A, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3D, 0x8B, 0x64, 
+0x00, 0x9E, 0xC5, 0xB2, 
+0x01, 0x00, 0x00, 0x00, 
+0xFF, 0xC2, 0x74, 0x9C, 
+0xFF, 0x61, 0x3A, 0x4E, 
+0x00, 0x00, 0x20, 0x8A, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x0A, 0x58, 
+0x00, 0xB5, 0x3B, 0xEF, 
+0x00, 0x80, 0x4D, 0xCE, 
+0x00, 0x5A, 0xD5, 0x0D, 
+0x00, 0x40, 0x4D, 0xE6, 
+0x00, 0x2D, 0x86, 0x22, 
+0x00, 0x20, 0x3A, 0x7E, 
+0x00, 0x16, 0xD0, 0xE7, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x0A, 0x58, 
+0x00, 0xB5, 0x3B, 0xEF, 
+0x00, 0x80, 0x4D, 0xCE, 
+0x00, 0x5A, 0xD5, 0x0D, 
+0x00, 0x40, 0x4D, 0xE6, 
+0x00, 0x2D, 0x86, 0x22, 
+0x00, 0x20, 0x3A, 0x7E, 
+0x00, 0x16, 0xD0, 0xE7, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0xB5, 0x04, 0xF3, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0xB5, 0x04, 0xF3, 
+0x00, 0x00, 0x05, 0xA0, 
+0x00, 0x00, 0x05, 0xA0, 
+0x00, 0x00, 0x00, 0x37, 
+0x00, 0x00, 0x40, 0x00, 
+0x00, 0x00, 0x00, 0x35, 
+0x00, 0x00, 0x00, 0xA8, 
+0x00, 0x00, 0x01, 0x2A, 
+0x00, 0x00, 0x02, 0x13, 
+0x00, 0x00, 0x02, 0xED, 
+0x00, 0x00, 0x04, 0x23, 
+0x00, 0x00, 0x05, 0xD7, 
+0x00, 0x00, 0x08, 0x40, 
+0x00, 0x00, 0x0B, 0xA7, 
+0x00, 0x00, 0x10, 0x76, 
+0x00, 0x00, 0x17, 0x41, 
+0x00, 0x00, 0x20, 0xD9, 
+0x00, 0x00, 0x2E, 0x65, 
+0x00, 0x00, 0x41, 0x89, 
+0x00, 0x00, 0x52, 0x81, 
+0x00, 0x00, 0x67, 0xDE, 
+0x00, 0x00, 0x82, 0xC3, 
+0x00, 0x00, 0xA4, 0x9E, 
+0x00, 0x00, 0xCF, 0x3E, 
+0x00, 0x01, 0x04, 0xE7, 
+0x00, 0x01, 0x48, 0x75, 
+0x00, 0x01, 0x9D, 0x81, 
+0x00, 0x02, 0x08, 0x92, 
+0x00, 0x02, 0x8F, 0x5C, 
+0x00, 0x03, 0x39, 0x0D, 
+0x00, 0x04, 0x0E, 0xAD, 
+0x00, 0x05, 0x1B, 0x9D, 
+0x00, 0x06, 0x6E, 0x31, 
+0x00, 0x07, 0xA4, 0x80, 
+0x00, 0x09, 0x15, 0x4E, 
+0x00, 0x0A, 0xCB, 0xA1, 
+0x00, 0x0C, 0xD4, 0x95, 
+0x00, 0x0F, 0x3F, 0xBB, 
+0x00, 0x12, 0x1F, 0x98, 
+0x00, 0x15, 0x8A, 0x2B, 
+0x00, 0x19, 0x99, 0x9A, 
+0x00, 0x1C, 0xB9, 0x43, 
+0x00, 0x20, 0x3A, 0x7E, 
+0x00, 0x24, 0x29, 0x35, 
+0x00, 0x28, 0x92, 0xC2, 
+0x00, 0x2D, 0x86, 0x22, 
+0x00, 0x33, 0x14, 0x27, 
+0x00, 0x39, 0x4F, 0xAF, 
+0x00, 0x40, 0x4D, 0xE6, 
+0x00, 0x48, 0x26, 0x8E, 
+0x00, 0x50, 0xF4, 0x4E, 
+0x00, 0x5A, 0xD5, 0x0D, 
+0x00, 0x65, 0xEA, 0x5A, 
+0x00, 0x72, 0x59, 0xDB, 
+0x00, 0x80, 0x4D, 0xCE, 
+0x00, 0x8F, 0xF5, 0x9A, 
+0x00, 0xA1, 0x86, 0x6C, 
+0x00, 0xB5, 0x3B, 0xEF, 
+0x00, 0xCB, 0x59, 0x18, 
+0x00, 0xE4, 0x29, 0x05, 
+0x01, 0x1F, 0x3C, 0x9A, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x50, 0xF4, 0x4E, 
+0x00, 0x00, 0x20, 0x8A, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x20, 0x8A, 
+0x00, 0x00, 0x20, 0x8A, 
+0x00, 0x00, 0x20, 0x8A, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xBE, 0x77, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xBE, 0x77, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xBE, 0x77, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xBE, 0x77, 
+0xFE, 0x98, 0xB9, 0xD7, 
+0x01, 0x67, 0x46, 0x29, 
+0x00, 0xFC, 0xB1, 0x71, 
+0xFE, 0x98, 0xB9, 0xD7, 
+0x01, 0x67, 0x46, 0x29, 
+0x00, 0xFC, 0xB1, 0x71, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x16, 0x71, 0x08, 
+0x00, 0x13, 0x02, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x16, 0x71, 0x08, 
+0x00, 0x13, 0x02, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x3D, 0x8B, 0x64, 
+0x00, 0x9E, 0xC5, 0xB2, 
+0x01, 0x00, 0x00, 0x00, 
+0xFF, 0xC2, 0x74, 0x9C, 
+0xFF, 0x61, 0x3A, 0x4E, 
+0x00, 0x00, 0x20, 0x8A, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x0A, 0x58, 
+0x00, 0xB5, 0x3B, 0xEF, 
+0x00, 0x80, 0x4D, 0xCE, 
+0x00, 0x5A, 0xD5, 0x0D, 
+0x00, 0x40, 0x4D, 0xE6, 
+0x00, 0x2D, 0x86, 0x22, 
+0x00, 0x20, 0x3A, 0x7E, 
+0x00, 0x16, 0xD0, 0xE7, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0xB5, 0x04, 0xF3, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x50, 0xF4, 0x4E, 
+0x00, 0x00, 0x20, 0x8A, 
+0x00, 0x00, 0x20, 0x8A, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xBE, 0x77, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xBE, 0x77, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xBE, 0x77, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xBE, 0x77, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x11, 0x26, 
+0x00, 0x00, 0x22, 0x4C, 
+0x00, 0x00, 0x11, 0x26, 
+0xFF, 0x0B, 0x93, 0xE5, 
+0x01, 0xF4, 0x27, 0x84, 
+0x00, 0x00, 0x11, 0x26, 
+0x00, 0x00, 0x22, 0x4C, 
+0x00, 0x00, 0x11, 0x26, 
+0xFF, 0x0B, 0x93, 0xE5, 
+0x01, 0xF4, 0x27, 0x84, 
+0x00, 0xC1, 0xCF, 0xC2, 
+0xFE, 0x7C, 0x60, 0x7C, 
+0x00, 0xC1, 0xCF, 0xC2, 
+0xFF, 0x6D, 0x0A, 0x47, 
+0x01, 0x74, 0x49, 0x4F, 
+0x00, 0xC1, 0xCF, 0xC2, 
+0xFE, 0x7C, 0x60, 0x7C, 
+0x00, 0xC1, 0xCF, 0xC2, 
+0xFF, 0x6D, 0x0A, 0x47, 
+0x01, 0x74, 0x49, 0x4F, 
+0x00, 0x00, 0x11, 0x26, 
+0x00, 0x00, 0x22, 0x4C, 
+0x00, 0x00, 0x11, 0x26, 
+0xFF, 0x0B, 0x93, 0xE5, 
+0x01, 0xF4, 0x27, 0x84, 
+0x00, 0x00, 0x11, 0x26, 
+0x00, 0x00, 0x22, 0x4C, 
+0x00, 0x00, 0x11, 0x26, 
+0xFF, 0x0B, 0x93, 0xE5, 
+0x01, 0xF4, 0x27, 0x84, 
+0x00, 0xC1, 0xCF, 0xC2, 
+0xFE, 0x7C, 0x60, 0x7C, 
+0x00, 0xC1, 0xCF, 0xC2, 
+0xFF, 0x6D, 0x0A, 0x47, 
+0x01, 0x74, 0x49, 0x4F, 
+0x00, 0xC1, 0xCF, 0xC2, 
+0xFE, 0x7C, 0x60, 0x7C, 
+0x00, 0xC1, 0xCF, 0xC2, 
+0xFF, 0x6D, 0x0A, 0x47, 
+0x01, 0x74, 0x49, 0x4F, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xBE, 0x77, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0x59, 0xDC, 
+0x01, 0x69, 0xFB, 0xE7, 
+0x00, 0x00, 0x11, 0x26, 
+0x00, 0x00, 0x11, 0x26, 
+0x00, 0x00, 0x22, 0x4C, 
+0xFF, 0x0B, 0x94, 0x55, 
+0x01, 0xF4, 0x27, 0x14, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0D, 0xA7, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x7A, 0x87, 0x80, 
+0x00, 0x9A, 0x41, 0x58, 
+0x01, 0x33, 0xC7, 0x9A, 
+0x01, 0xC7, 0x3D, 0x52, 
+0x01, 0xC7, 0x3D, 0x52, 
+0x01, 0xC7, 0x3D, 0x52, 
+0x01, 0xC7, 0x3D, 0x52, 
+0x01, 0xC7, 0x3D, 0x52, 
+0x01, 0xC7, 0x3D, 0x52, 
+0x01, 0xC7, 0x3D, 0x52, 
+0x01, 0xC7, 0x3D, 0x52, 
+0x01, 0xC7, 0x3D, 0x52, 
+0x01, 0xC7, 0x3D, 0x52, 
+0x01, 0xC7, 0x3D, 0x52, 
+0x01, 0xC7, 0x3D, 0x52, 
+0x01, 0xC7, 0x3D, 0x52, 
+0x01, 0xC7, 0x3D, 0x52, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0xBE, 0x77, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x06, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 
+0x00, 0x00, 0x00, 0x09, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 
+0x00, 0x00, 0x00, 0x02, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 
+0x00, 0x00, 0x00, 0x01, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 
+0x00, 0x00, 0x00, 0x01, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 
+0x00, 0x00, 0x00, 0x01, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 
+0x00, 0x10, 0x00, 0x00, 
+0x00, 0x10, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x03, 0x29, 0x8B, 0x07, 
+0x03, 0x29, 0x8B, 0x07, 
+0x03, 0x29, 0x8B, 0x07, 
+0x03, 0x29, 0x8B, 0x07, 
+0x03, 0x29, 0x8B, 0x07, 
+0x03, 0x29, 0x8B, 0x07, 
+0x00, 0x00, 0x00, 0x01, 
+0x00, 0x00, 0x00, 0x01, 
+0x00, 0x00, 0x00, 0x01, 
+0x00, 0x00, 0x25, 0xF0, 
+0x00, 0x00, 0x0D, 0x80, 
+0x00, 0x00, 0x00, 0x24, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x25, 0xF0, 
+0x00, 0x00, 0x0D, 0x80, 
+0x00, 0x00, 0x00, 0x24, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x26, 0x0D, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x24, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x26, 0x0D, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x24, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x25, 0xF0, 
+0x00, 0x00, 0x0D, 0x80, 
+0x00, 0x00, 0x00, 0x24, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x26, 0x0D, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x24, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xB9, 
+0x00, 0x00, 0x10, 0x00, 
+0x00, 0x00, 0x0F, 0xB9, 
+0x00, 0x00, 0x10, 0x00, 
+0x00, 0x80, 0x00, 0x00, 
+0x00, 0x80, 0x00, 0x00, 
+0x00, 0x00, 0x0F, 0xB9, 
+0x00, 0x00, 0x10, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 			/* (65) DM1 Data */
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3C, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x3C, 0xF0, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFE, 0x88, 0xFC, 
+0xFE, 0x01, 0x78, 0x18, 
+0x01, 0x00, 0x00, 0x00, 
+0xFF, 0x01, 0x77, 0x04, 
+0x01, 0xFE, 0x87, 0xE8, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFE, 0x88, 0xFC, 
+0xFE, 0x01, 0x78, 0x18, 
+0x01, 0x00, 0x00, 0x00, 
+0xFF, 0x01, 0x77, 0x04, 
+0x01, 0xFE, 0x87, 0xE8, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFE, 0x88, 0xFC, 
+0xFE, 0x01, 0x78, 0x18, 
+0x01, 0x00, 0x00, 0x00, 
+0xFF, 0x01, 0x77, 0x04, 
+0x01, 0xFE, 0x87, 0xE8, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFA, 0x24, 0xE8, 
+0xFE, 0x0B, 0xB6, 0x31, 
+0x00, 0xFA, 0x24, 0xE8, 
+0xFF, 0x0B, 0x93, 0xE5, 
+0x01, 0xF4, 0x27, 0x84, 
+0x00, 0xFA, 0x24, 0xE8, 
+0xFE, 0x0B, 0xB6, 0x31, 
+0x00, 0xFA, 0x24, 0xE8, 
+0xFF, 0x0B, 0x93, 0xE5, 
+0x01, 0xF4, 0x27, 0x84, 
+0x00, 0x07, 0xAB, 0x1A, 
+0x00, 0x0F, 0x56, 0x35, 
+0x00, 0x07, 0xAB, 0x1A, 
+0xFF, 0x6D, 0x0A, 0x47, 
+0x01, 0x74, 0x49, 0x4F, 
+0x00, 0x07, 0xAB, 0x1A, 
+0x00, 0x0F, 0x56, 0x35, 
+0x00, 0x07, 0xAB, 0x1A, 
+0xFF, 0x6D, 0x0A, 0x47, 
+0x01, 0x74, 0x49, 0x4F, 
+0x00, 0xFA, 0x24, 0xE8, 
+0xFE, 0x0B, 0xB6, 0x31, 
+0x00, 0xFA, 0x24, 0xE8, 
+0xFF, 0x0B, 0x93, 0xE5, 
+0x01, 0xF4, 0x27, 0x84, 
+0x00, 0xFA, 0x24, 0xE8, 
+0xFE, 0x0B, 0xB6, 0x31, 
+0x00, 0xFA, 0x24, 0xE8, 
+0xFF, 0x0B, 0x93, 0xE5, 
+0x01, 0xF4, 0x27, 0x84, 
+0x00, 0x07, 0xAB, 0x1A, 
+0x00, 0x0F, 0x56, 0x35, 
+0x00, 0x07, 0xAB, 0x1A, 
+0xFF, 0x6D, 0x0A, 0x47, 
+0x01, 0x74, 0x49, 0x4F, 
+0x00, 0x07, 0xAB, 0x1A, 
+0x00, 0x0F, 0x56, 0x35, 
+0x00, 0x07, 0xAB, 0x1A, 
+0xFF, 0x6D, 0x0A, 0x47, 
+0x01, 0x74, 0x49, 0x4F, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 			/* (66) KILL_CORE */
+0x00, 0x00, 			/* (67) START_ADDRESS */
+0x00, 0x02, 			/* (68) START_PULSE */
+0x00, 0x00, 			/* (69) START_CORE */
+0x00, 0x01, 			/* (70) START_CORE */
+0x00, 0x01, 			/* (71) Start Delay */
+0x00, 0x00, 			/* (72) HIBERNATE */
+};
+
+const SigmaSeqEntry Sequence_IC_1[SEQUENCE_SIZE_IC_1] PROGMEM = {
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CONTROL, 0xF890, 2, 0 },	/* (0) SOFT_RESET */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CONTROL, 0xF890, 2, 2 },	/* (1) SOFT_RESET */
+	{ SIGMA_SEQ_DELAY, SIGMA_GROUP_CONTROL, 0x0000, 2, 4 },	/* (2) Reset Delay */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CONTROL, 0xF400, 2, 6 },	/* (3) HIBERNATE */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CONTROL, 0xF400, 2, 8 },	/* (4) HIBERNATE */
+	{ SIGMA_SEQ_DELAY, SIGMA_GROUP_CONTROL, 0x0000, 2, 10 },	/* (5) Hibernate Delay */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CONTROL, 0xF403, 2, 12 },	/* (6) KILL_CORE */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CONTROL, 0xF403, 2, 14 },	/* (7) KILL_CORE */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CLOCK, 0xF003, 2, 16 },	/* (8) PLL_ENABLE */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CLOCK, 0xF000, 2, 18 },	/* (9) PLL_CTRL0 Register */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CLOCK, 0xF001, 2, 20 },	/* (10) PLL_CTRL1 Register */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CLOCK, 0xF002, 2, 22 },	/* (11) PLL_CLK_SRC Register */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CLOCK, 0xF005, 2, 24 },	/* (12) MCLK_OUT Register */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CLOCK, 0xF003, 2, 26 },	/* (13) PLL_ENABLE Register */
+	{ SIGMA_SEQ_DELAY, SIGMA_GROUP_CONTROL, 0x0000, 2, 28 },	/* (14) PLL Lock Delay */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CLOCK, 0xF050, 2, 30 },	/* (15) POWER_ENABLE0 Register */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CLOCK, 0xF051, 2, 32 },	/* (16) POWER_ENABLE1 Register */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF516, 2, 34 },	/* (17) MP6_MODE */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF517, 2, 36 },	/* (18) MP7_MODE */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF518, 2, 38 },	/* (19) MP8_MODE */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF519, 2, 40 },	/* (20) MP9_MODE */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF51D, 2, 42 },	/* (21) MP13_MODE */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF100, 2, 44 },	/* (22) ASRC_INPUT0 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF101, 2, 46 },	/* (23) ASRC_INPUT1 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF140, 2, 48 },	/* (24) ASRC_OUT_RATE0 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF141, 2, 50 },	/* (25) ASRC_OUT_RATE1 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF180, 2, 52 },	/* (26) SOUT_SOURCE0 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF181, 2, 54 },	/* (27) SOUT_SOURCE1 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF182, 2, 56 },	/* (28) SOUT_SOURCE2 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF183, 2, 58 },	/* (29) SOUT_SOURCE3 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF184, 2, 60 },	/* (30) SOUT_SOURCE4 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF185, 2, 62 },	/* (31) SOUT_SOURCE5 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF186, 2, 64 },	/* (32) SOUT_SOURCE6 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF187, 2, 66 },	/* (33) SOUT_SOURCE7 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF188, 2, 68 },	/* (34) SOUT_SOURCE8 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF189, 2, 70 },	/* (35) SOUT_SOURCE9 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF18A, 2, 72 },	/* (36) SOUT_SOURCE10 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF18B, 2, 74 },	/* (37) SOUT_SOURCE11 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF18C, 2, 76 },	/* (38) SOUT_SOURCE12 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF18D, 2, 78 },	/* (39) SOUT_SOURCE13 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF18E, 2, 80 },	/* (40) SOUT_SOURCE14 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF18F, 2, 82 },	/* (41) SOUT_SOURCE15 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF190, 2, 84 },	/* (42) SOUT_SOURCE16 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF191, 2, 86 },	/* (43) SOUT_SOURCE17 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF192, 2, 88 },	/* (44) SOUT_SOURCE18 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF193, 2, 90 },	/* (45) SOUT_SOURCE19 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF194, 2, 92 },	/* (46) SOUT_SOURCE20 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF195, 2, 94 },	/* (47) SOUT_SOURCE21 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF196, 2, 96 },	/* (48) SOUT_SOURCE22 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF197, 2, 98 },	/* (49) SOUT_SOURCE23 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF1C0, 2, 100 },	/* (50) SPDIFTX_INPUT */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF200, 2, 102 },	/* (51) SERIAL_BYTE_0_0 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF204, 2, 104 },	/* (52) SERIAL_BYTE_1_0 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF208, 2, 106 },	/* (53) SERIAL_BYTE_2_0 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF20C, 2, 108 },	/* (54) SERIAL_BYTE_3_0 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF210, 2, 110 },	/* (55) SERIAL_BYTE_4_0 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF214, 2, 112 },	/* (56) SERIAL_BYTE_5_0 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF218, 2, 114 },	/* (57) SERIAL_BYTE_6_0 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF21C, 2, 116 },	/* (58) SERIAL_BYTE_7_0 */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF601, 2, 118 },	/* (59) SPDIF_RX_CTRL */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF604, 2, 120 },	/* (60) SPDIF_RESTART */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF608, 2, 122 },	/* (61) SPDIF_AUX_EN */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_IO, 0xF690, 2, 124 },	/* (62) SPDIF_TX_EN */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_PROGRAM, 0xC000, 6720, 126 },	/* (63) Program Data */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_DM0, 0x0000, 4328, 6846 },	/* (64) DM0 Data */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_DM1, 0x6000, 1936, 11174 },	/* (65) DM1 Data */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CONTROL, 0xF403, 2, 13110 },	/* (66) KILL_CORE */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CONTROL, 0xF404, 2, 13112 },	/* (67) START_ADDRESS */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CONTROL, 0xF401, 2, 13114 },	/* (68) START_PULSE */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CONTROL, 0xF402, 2, 13116 },	/* (69) START_CORE */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CONTROL, 0xF402, 2, 13118 },	/* (70) START_CORE */
+	{ SIGMA_SEQ_DELAY, SIGMA_GROUP_CONTROL, 0x0000, 2, 13120 },	/* (71) Start Delay */
+	{ SIGMA_SEQ_WRITE, SIGMA_GROUP_CONTROL, 0xF400, 2, 13122 },	/* (72) HIBERNATE */
+};
+
+/*
+ * Table-driven counterpart of default_download_IC_1(); returns the SIGMA_RUN_SEQUENCE() result.
+ */
+template <typename Bus = SigmaDefaultTransport>
+uint8_t sequence_download_IC_1(byte devAddress = DEVICE_ADDR_IC_1) {
+	return SIGMA_RUN_SEQUENCE<Bus>( devAddress, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1 );
+}
+
+const SigmaSeqSection Sections_IC_1[SECTION_COUNT_IC_1] PROGMEM = {
+	{ 0xC000, 6720, 0xAA3CD269u },	/* (63) Program Data */
+	{ 0x0000, 4328, 0x3FCF3083u },	/* (64) DM0 Data */
+	{ 0x6000, 1936, 0x39CA93F2u },	/* (65) DM1 Data */
+};
+
+const SigmaSignature Signature_IC_1 PROGMEM = {
+	SIGNATURE_ADDR_IC_1, 0x674E7395u,	/* CRC32 of all non-control entries */
+	{ 0xC000, 0xC0EF, 0xC1DF, 0xC2CF, 0xC3BF, 0xC4AF, 0xC59F, 0xC68F },
+	{ 0x00000002u, 0x054C15EEu, 0xC0000C11u, 0x07044000u, 0x00864110u, 0xC000088Fu, 0x8C004702u, 0x00000000u }
+};
+
+const uint32_t GroupHash_IC_1[SIGMA_GROUP_COUNT] PROGMEM = {
+	0x5F7246E8u,	/* SIGMA_GROUP_CONTROL */
+	0x0426D4C2u,	/* SIGMA_GROUP_CLOCK */
+	0x51546877u,	/* SIGMA_GROUP_IO */
+	0xF6708F98u,	/* SIGMA_GROUP_PROGRAM */
+	0x212BEC8Du,	/* SIGMA_GROUP_DM0 */
+	0xAE836021u,	/* SIGMA_GROUP_DM1 */
+};
+
+#endif
@@ -3,9 +3,19 @@
 #include <Arduino.h>
 #include "USER_SETTINGS.h"
 
-#if USE_SPI
+// 编译进固件的传输（见"传输策略"）：默认只有 USE_SPI 选中的一种，I2C和SPI的DSP
+// 共存时在包含此头文件前把两个都定义为 true
+#ifndef SIGMA_WITH_SPI
+  #define SIGMA_WITH_SPI USE_SPI
+#endif
+#ifndef SIGMA_WITH_I2C
+  #define SIGMA_WITH_I2C (USE_SPI == false)
+#endif
+
+#if SIGMA_WITH_SPI
 #include <SPI.h>
-#else
+#endif
+#if SIGMA_WITH_I2C
 #include <Wire.h>
 #endif
 
@@ -20,6 +30,11 @@
 #define SIGMA_ERROR_I2C_DATA    3
 #define SIGMA_ERROR_BUFFER_SIZE 4
 #define SIGMA_ERROR_INVALID_PARAM 5
+#define SIGMA_ERROR_DSP_TIMEOUT 6     // 轮询状态寄存器超时
+#define SIGMA_ERROR_VERIFY      7     // 读回的内存与构建时的CRC不符
+#define SIGMA_ERROR_IMAGE       8     // 镜像文件格式错误、被截断或CRC不符（SIGMA_RUN_IMAGE）
+#define SIGMA_ERROR_BUS_CLOCK   9     // 最慢一档时钟也不能可靠读写（SIGMA_QUALIFY_CLOCK）
+#define SIGMA_ERROR_DSP_RUNNING 10    // DSP正在运行，SPI上不能鉴定时钟（SIGMA_QUALIFY_CLOCK）
 
 // 配置参数
 #ifndef I2C_TIMEOUT_MS
@@ -58,17 +73,312 @@ void SIGMA_CLEAR_ERROR() {
     g_sigma_last_error = SIGMA_SUCCESS;
 }
 
-// I2C初始化函数
-void SIGMA_I2C_INIT() {
-#if USE_SPI == false
-    Wire.begin();
-    Wire.setClock(I2C_CLOCK_SPEED);
-    
-    #if defined(WIRE_HAS_TIMEOUT)
-    Wire.setWireTimeout(I2C_TIMEOUT_MS * 1000, true); // 转换为微秒
-    #endif
-    
-    SIGMA_DEBUG_PRINTLN("I2C initialized");
+// ========== 分块重试 ==========
+// I2C每块写入失败（NACK、超时）后原地重试，等待时间每次加倍。
+// SPI没有应答，无法检测写入失败，不重试。
+#ifndef SIGMA_RETRY_COUNT
+  #define SIGMA_RETRY_COUNT 3         // 每块最多重试次数
+#endif
+
+#ifndef SIGMA_RETRY_BACKOFF_MS
+  #define SIGMA_RETRY_BACKOFF_MS 1    // 第一次重试前的等待(毫秒)，此后每次加倍
+#endif
+
+static uint32_t g_sigma_retries = 0;           // 累计重试次数
+static uint32_t g_sigma_retry_failures = 0;    // 重试用尽仍失败的块数
+
+uint32_t SIGMA_GET_RETRY_COUNT() {
+    return g_sigma_retries;
+}
+
+uint32_t SIGMA_GET_RETRY_FAILURES() {
+    return g_sigma_retry_failures;
+}
+
+void SIGMA_CLEAR_RETRY_COUNTS() {
+    g_sigma_retries = 0;
+    g_sigma_retry_failures = 0;
+}
+
+// ========== 多DSP：设备表 ==========
+// 导出文件的每个调用都带设备地址（DEVICE_ADDR_IC_x，SigmaStudio的8位写地址）。没有登记设备时
+// 地址被忽略，所有访问发往传输的地址（I2C为 DSP_I2C_ADDR），与单DSP板子原来的行为相同。
+// 登记之后，带设备地址的调用先切换到该设备：
+//   - I2C传输发往该设备的7位地址（只给导出地址时见 SIGMA_ADD_DEVICE(byte)）；
+//   - 最后的错误、重试计数、热启动/增量重载的结果、总线时钟和EEPROM中的记录各设备一份；
+//   - 切换前先发出计划器中待发的合并写入（它们属于原来的设备）。
+// 不带设备地址的调用（SIGMA_WRITE_REGISTER_INTEGER(地址, 值)、SIGMA_READ_REGISTER_* 等）作用于
+// 当前设备，也可以用带设备地址的重载。未登记的地址按没有登记时的方式访问，
+// 但没有EEPROM记录（增量重载按冷启动处理，时钟每次重新鉴定）。
+//
+//   SIGMA_ADD_DEVICE(DEVICE_ADDR_IC_1, 0x39);     // ADDR0/ADDR1 引脚决定的7位I2C地址
+//   SIGMA_ADD_DEVICE(0x74, 0x3A);                 // 同一导出镜像的第二片DSP
+//   sequence_download_IC_1(DEVICE_ADDR_IC_1);
+//   sequence_download_IC_1(0x74);
+//   SIGMA_WRITE_REGISTER_FLOAT(0x74, MOD_GAIN_ADDR, 0.5);
+//   if (SIGMA_GET_LAST_ERROR(0x74) != SIGMA_SUCCESS) ...
+//
+// SPI的DSP各有片选，用各自的传输（见"传输策略"）区分，设备表只决定I2C地址和各设备的状态。
+#ifndef SIGMA_MAX_DEVICES
+  #define SIGMA_MAX_DEVICES 4
+#endif
+
+#define SIGMA_CURRENT_DEVICE 0xFF    // 不带设备地址的调用：不切换设备
+
+struct SigmaDevice {
+    byte devAddress;          // 导出文件中的设备地址
+    uint8_t i2cAddress;       // 7位I2C地址，0 表示用传输的地址
+    uint32_t clock;           // 该设备的总线时钟，0 表示不改变
+    uint8_t lastError;
+    uint32_t retries;
+    uint32_t retryFailures;
+    bool warmBoot;            // SIGMA_BOOT_SEQUENCE()/SIGMA_BOOT_INCREMENTAL() 的结果
+    uint8_t bootMode;
+    uint8_t bootGroups;
+    uint32_t transactions;    // 总线事务数
+    uint32_t bytes;           // 数据字节数
+};
+
+static SigmaDevice g_sigma_devices[SIGMA_MAX_DEVICES];
+static uint8_t g_sigma_device_count = 0;
+static SigmaDevice g_sigma_default_device = {};    // 未登记的地址
+static SigmaDevice* g_sigma_device = &g_sigma_default_device;    // 当前设备，状态在全局变量中
+
+// 已登记的设备，未登记时返回 nullptr
+SigmaDevice* SIGMA_FIND_DEVICE(byte devAddress) {
+    for (uint8_t i = 0; i < g_sigma_device_count; i++) {
+        if (g_sigma_devices[i].devAddress == devAddress) {
+            return &g_sigma_devices[i];
+        }
+    }
+    return nullptr;
+}
+
+#define SIGMA_NO_DEVICE_INDEX (-1)    // 登记了设备后的未登记地址：没有自己的EEPROM记录
+
+// 当前设备在设备表中的位置（EEPROM记录按它分开）。没有登记设备时为 0（单DSP板子），
+// 登记了设备后未登记的地址返回 SIGMA_NO_DEVICE_INDEX，不与第一个设备共用记录
+int SIGMA_DEVICE_INDEX() {
+    if (g_sigma_device != &g_sigma_default_device) {
+        return int(g_sigma_device - g_sigma_devices);
+    }
+    return g_sigma_device_count == 0 ? 0 : SIGMA_NO_DEVICE_INDEX;
+}
+
+// 切换设备（定义在"增量重载"之后，与 SIGMA_ADD_DEVICE() 等在一起）
+template <typename Bus> void SIGMA_SELECT_DEVICE(byte devAddress);
+
+// ========== 启动阶段计时 ==========
+// 按阶段统计一次下载的耗时、总线事务数和数据字节数，用来比较不同板子上启动时间花在哪里。
+// 执行序列（sequence_download_IC_x()、SIGMA_RUN_SEQUENCE() 等）时从 SIGMA_SEQ_START() 自动记录到
+// 序列结束；逐条展开的导出函数或多个DSP的下载用 SIGMA_TIMING_BEGIN()/SIGMA_TIMING_END() 包起来，
+// 期间的序列不再单独开始/结束计时。结果由 SIGMA_GET_BOOT_TIMING() 取得，保留到下一次下载。
+//
+// 阶段按写入的地址划分，延迟和状态轮询算在前一次写入所在的阶段：
+//   RESET      SOFT_RESET 及复位延迟
+//   HIBERNATE  内存写入之前的 HIBERNATE、KILL_CORE 等内核控制寄存器
+//   PLL        PLL_CTRL0..PLL_WATCHDOG 及锁定等待
+//   CONFIG     其余控制寄存器（电源、时钟、ASRC、串口、SPDIF、引脚）
+//   PROGRAM    程序内存
+//   PARAM      DM0（参数）
+//   DM1        DM1 数据
+//   START      内存写入之后的内核控制寄存器（KILL_CORE、START_ADDRESS、START_CORE、HIBERNATE）及启动等待
+#ifndef SIGMA_BOOT_TIMING
+  #define SIGMA_BOOT_TIMING true          // false: 不记录，省下约150字节RAM
+#endif
+
+#ifndef SIGMA_BOOT_TIMING_PRINT
+  #define SIGMA_BOOT_TIMING_PRINT false   // true: 第一次下载结束时用 Serial 打印一次
+#endif
+
+#define SIGMA_PHASE_RESET      0
+#define SIGMA_PHASE_HIBERNATE  1
+#define SIGMA_PHASE_PLL        2
+#define SIGMA_PHASE_CONFIG     3
+#define SIGMA_PHASE_PROGRAM    4
+#define SIGMA_PHASE_PARAM      5
+#define SIGMA_PHASE_DM1        6
+#define SIGMA_PHASE_START      7
+#define SIGMA_PHASE_COUNT      8
+#define SIGMA_PHASE_NONE       0xFF
+
+#define SIGMA_TIMING_IDLE      0
+#define SIGMA_TIMING_AUTO      1    // 由序列开始，序列结束时结束
+#define SIGMA_TIMING_MANUAL    2    // SIGMA_TIMING_BEGIN() 到 SIGMA_TIMING_END()
+
+struct SigmaPhaseStats {
+    uint32_t startUs;         // 第一次进入该阶段的时间（相对于计时开始）
+    uint32_t us;              // 累计耗时
+    uint32_t bytes;           // 数据字节（写入和读回，不含设备地址/子地址/SPI命令）
+    uint32_t transactions;    // 总线事务（I2C读取的子地址阶段单独算一个）
+};
+
+struct SigmaBootTiming {
+    SigmaPhaseStats phase[SIGMA_PHASE_COUNT];
+    uint32_t totalUs;
+    uint32_t startUs;         // micros()
+    uint32_t enteredUs;       // 进入当前阶段的 micros()
+    uint8_t current;          // 当前阶段，SIGMA_PHASE_NONE 表示还没有写入
+    uint8_t seen;             // 进入过的阶段（位）
+    uint8_t state;            // SIGMA_TIMING_*
+};
+
+template <typename Bus> uint8_t SIGMA_PLAN_FLUSH();
+
+const char* SIGMA_PHASE_NAME(uint8_t phase) {
+    switch (phase) {
+        case SIGMA_PHASE_RESET:     return "RESET";
+        case SIGMA_PHASE_HIBERNATE: return "HIBERNATE";
+        case SIGMA_PHASE_PLL:       return "PLL";
+        case SIGMA_PHASE_CONFIG:    return "CONFIG";
+        case SIGMA_PHASE_PROGRAM:   return "PROGRAM";
+        case SIGMA_PHASE_PARAM:     return "PARAM";
+        case SIGMA_PHASE_DM1:       return "DM1";
+        case SIGMA_PHASE_START:     return "START";
+        default:                    return "?";
+    }
+}
+
+// ADAU145x 地址映射；内核控制寄存器按所处位置分给 HIBERNATE 或 START
+uint8_t SIGMA_PHASE_OF(uint32_t address, uint8_t current) {
+    if (address == 0xF890) {
+        return SIGMA_PHASE_RESET;
+    }
+    if (address >= 0xF400 && address <= 0xF404) {
+        return current == SIGMA_PHASE_NONE || current <= SIGMA_PHASE_HIBERNATE ? SIGMA_PHASE_HIBERNATE
+                                                                               : SIGMA_PHASE_START;
+    }
+    if (address >= 0xF000 && address <= 0xF006) {
+        return SIGMA_PHASE_PLL;
+    }
+    if (address >= 0xF000) {
+        return SIGMA_PHASE_CONFIG;
+    }
+    if (address >= 0xC000) {
+        return SIGMA_PHASE_PROGRAM;
+    }
+    return address >= 0x6000 ? SIGMA_PHASE_DM1 : SIGMA_PHASE_PARAM;
+}
+
+#if SIGMA_BOOT_TIMING
+static SigmaBootTiming g_sigma_timing;
+static bool g_sigma_timing_printed = false;
+#endif
+
+void SIGMA_PRINT_BOOT_TIMING();
+
+// 开始计时；手动计时期间序列的开始不重新计时
+void SIGMA_TIMING_START(uint8_t state) {
+#if SIGMA_BOOT_TIMING
+    if (state == SIGMA_TIMING_AUTO && g_sigma_timing.state == SIGMA_TIMING_MANUAL) {
+        return;
+    }
+    memset(&g_sigma_timing, 0, sizeof(g_sigma_timing));
+    g_sigma_timing.current = SIGMA_PHASE_NONE;
+    g_sigma_timing.state = state;
+    g_sigma_timing.startUs = micros();
+#else
+    (void)state;
+#endif
+}
+
+// 结束 state 方式开始的计时（序列不会结束手动开始的计时）
+void SIGMA_TIMING_FINISH(uint8_t state) {
+#if SIGMA_BOOT_TIMING
+    if (g_sigma_timing.state != state) {
+        return;
+    }
+    uint32_t now = micros();
+    if (g_sigma_timing.current != SIGMA_PHASE_NONE) {
+        g_sigma_timing.phase[g_sigma_timing.current].us += now - g_sigma_timing.enteredUs;
+    }
+    g_sigma_timing.totalUs = now - g_sigma_timing.startUs;
+    g_sigma_timing.state = SIGMA_TIMING_IDLE;
+    if (SIGMA_BOOT_TIMING_PRINT && !g_sigma_timing_printed) {
+        g_sigma_timing_printed = true;
+        SIGMA_PRINT_BOOT_TIMING();
+    }
+#else
+    (void)state;
+#endif
+}
+
+void SIGMA_TIMING_BEGIN() {
+    SIGMA_TIMING_START(SIGMA_TIMING_MANUAL);
+}
+
+void SIGMA_TIMING_END() {
+    SIGMA_TIMING_FINISH(SIGMA_TIMING_MANUAL);
+}
+
+// 经 Bus 写入 address 之前调用：进入它所属的阶段。计划器中积累的写入属于上一个阶段，先发出
+template <typename Bus>
+void SIGMA_TIMING_PHASE(uint32_t address) {
+#if SIGMA_BOOT_TIMING
+    if (g_sigma_timing.state == SIGMA_TIMING_IDLE) {
+        return;
+    }
+    uint8_t phase = SIGMA_PHASE_OF(address, g_sigma_timing.current);
+    if (phase == g_sigma_timing.current) {
+        return;
+    }
+    SIGMA_PLAN_FLUSH<Bus>();
+    uint32_t now = micros();
+    if (g_sigma_timing.current != SIGMA_PHASE_NONE) {
+        g_sigma_timing.phase[g_sigma_timing.current].us += now - g_sigma_timing.enteredUs;
+    }
+    if (!(g_sigma_timing.seen & (1 << phase))) {
+        g_sigma_timing.seen |= uint8_t(1 << phase);
+        g_sigma_timing.phase[phase].startUs = now - g_sigma_timing.startUs;
+    }
+    g_sigma_timing.current = phase;
+    g_sigma_timing.enteredUs = now;
+#else
+    (void)address;
+#endif
+}
+
+// 每个总线事务调用一次，bytes 为数据字节数
+void SIGMA_TIMING_BUS(int bytes) {
+    g_sigma_device->transactions++;
+    g_sigma_device->bytes += uint32_t(bytes);
+#if SIGMA_BOOT_TIMING
+    if (g_sigma_timing.state != SIGMA_TIMING_IDLE && g_sigma_timing.current != SIGMA_PHASE_NONE) {
+        g_sigma_timing.phase[g_sigma_timing.current].transactions++;
+        g_sigma_timing.phase[g_sigma_timing.current].bytes += uint32_t(bytes);
+    }
+#endif
+}
+
+// 上一次（或正在进行的）下载的各阶段统计；SIGMA_BOOT_TIMING 为 false 时返回 nullptr
+const SigmaBootTiming* SIGMA_GET_BOOT_TIMING() {
+#if SIGMA_BOOT_TIMING
+    return &g_sigma_timing;
+#else
+    return nullptr;
+#endif
+}
+
+void SIGMA_PRINT_BOOT_TIMING() {
+#if SIGMA_BOOT_TIMING
+    Serial.println("phase\tstart_us\tus\tbytes\ttxns");
+    for (uint8_t i = 0; i < SIGMA_PHASE_COUNT; i++) {
+        const SigmaPhaseStats& p = g_sigma_timing.phase[i];
+        if (!(g_sigma_timing.seen & (1 << i))) {
+            continue;
+        }
+        Serial.print(SIGMA_PHASE_NAME(i));
+        Serial.print('\t');
+        Serial.print((unsigned long)p.startUs);
+        Serial.print('\t');
+        Serial.print((unsigned long)p.us);
+        Serial.print('\t');
+        Serial.print((unsigned long)p.bytes);
+        Serial.print('\t');
+        Serial.println((unsigned long)p.transactions);
+    }
+    Serial.print("total\t\t");
+    Serial.println((unsigned long)g_sigma_timing.totalUs);
 #endif
 }
 
@@ -102,6 +412,11 @@ void SIGMA_PRINT_ERROR() {
         case SIGMA_ERROR_I2C_DATA: Serial0.println("I2C_DATA"); break;
         case SIGMA_ERROR_BUFFER_SIZE: Serial0.println("BUFFER_SIZE"); break;
         case SIGMA_ERROR_INVALID_PARAM: Serial0.println("INVALID_PARAM"); break;
+        case SIGMA_ERROR_DSP_TIMEOUT: Serial0.println("DSP_TIMEOUT"); break;
+        case SIGMA_ERROR_VERIFY: Serial0.println("VERIFY"); break;
+        case SIGMA_ERROR_IMAGE: Serial0.println("IMAGE"); break;
+        case SIGMA_ERROR_BUS_CLOCK: Serial0.println("BUS_CLOCK"); break;
+        case SIGMA_ERROR_DSP_RUNNING: Serial0.println("DSP_RUNNING"); break;
         default: Serial0.println("UNKNOWN"); break;
     }
 }
@@ -134,380 +449,2208 @@ void SIGMASTUDIOTYPE_REGISTER_CONVERT(int32_t fixpt_val, byte dest[4]) {
     dest[3] = (fixpt_val) & 0xFF;
 }
 
-// Arduino声明的I2C缓冲区默认长度为32字节。请根据您的处理器进行调整。
-// 更长的缓冲区会使用更多的微控制器RAM，但允许更快的编程
-// 因为I2C开销更低。
+// ========== 总线特性（编译期） ==========
+// 各平台Wire库的发送缓冲区长度不同：AVR为32字节，ESP32为128字节，
+// Teensy 4为136字节，RP2040/SAMD为256字节。更长的缓冲区允许更长的
+// I2C突发，事务数和寻址开销都随之减少。
+#define SIGMA_PLATFORM_GENERIC  0
+#define SIGMA_PLATFORM_AVR      1
+#define SIGMA_PLATFORM_ESP32    2
+#define SIGMA_PLATFORM_ESP8266  3
+#define SIGMA_PLATFORM_TEENSY4  4
+#define SIGMA_PLATFORM_RP2040   5
+#define SIGMA_PLATFORM_SAMD     6
+#define SIGMA_PLATFORM_HOST     7
+
+#ifndef SIGMA_PLATFORM
+  #if defined(SIGMA_HOST)
+    #define SIGMA_PLATFORM SIGMA_PLATFORM_HOST
+  #elif defined(ARDUINO_ARCH_ESP32)
+    #define SIGMA_PLATFORM SIGMA_PLATFORM_ESP32
+  #elif defined(ARDUINO_ARCH_ESP8266)
+    #define SIGMA_PLATFORM SIGMA_PLATFORM_ESP8266
+  #elif defined(__IMXRT1062__)
+    #define SIGMA_PLATFORM SIGMA_PLATFORM_TEENSY4
+  #elif defined(ARDUINO_ARCH_RP2040)
+    #define SIGMA_PLATFORM SIGMA_PLATFORM_RP2040
+  #elif defined(ARDUINO_ARCH_SAMD)
+    #define SIGMA_PLATFORM SIGMA_PLATFORM_SAMD
+  #elif defined(ARDUINO_ARCH_AVR)
+    #define SIGMA_PLATFORM SIGMA_PLATFORM_AVR
+  #else
+    #define SIGMA_PLATFORM SIGMA_PLATFORM_GENERIC
+  #endif
+#endif
+
+template <int Platform> struct SigmaBusTraits {
+    static constexpr int I2C_BUFFER_SIZE = 32;     // Arduino Wire默认值
+};
+template <> struct SigmaBusTraits<SIGMA_PLATFORM_ESP32> {
+    static constexpr int I2C_BUFFER_SIZE = 128;    // I2C_BUFFER_LENGTH
+};
+template <> struct SigmaBusTraits<SIGMA_PLATFORM_ESP8266> {
+    static constexpr int I2C_BUFFER_SIZE = 128;    // BUFFER_LENGTH
+};
+template <> struct SigmaBusTraits<SIGMA_PLATFORM_TEENSY4> {
+    static constexpr int I2C_BUFFER_SIZE = 136;    // WireIMXRT BUFFER_LENGTH
+};
+template <> struct SigmaBusTraits<SIGMA_PLATFORM_RP2040> {
+    static constexpr int I2C_BUFFER_SIZE = 256;    // WIRE_BUFFER_SIZE
+};
+template <> struct SigmaBusTraits<SIGMA_PLATFORM_SAMD> {
+    static constexpr int I2C_BUFFER_SIZE = 256;    // RingBuffer SERIAL_BUFFER_SIZE
+};
+#if defined(WIRE_BUFFER_SIZE)
+template <> struct SigmaBusTraits<SIGMA_PLATFORM_HOST> {
+    static constexpr int I2C_BUFFER_SIZE = WIRE_BUFFER_SIZE;    // host/Wire.h
+};
+#endif
+
+// 可在包含此头文件前定义 SIGMA_I2C_BUFFER_SIZE 覆盖平台默认值
+#ifndef SIGMA_I2C_BUFFER_SIZE
+  #define SIGMA_I2C_BUFFER_SIZE (SigmaBusTraits<SIGMA_PLATFORM>::I2C_BUFFER_SIZE)
+#endif
+
 // 两个地址字节将数据突发大小缩短2字节。
-const int MAX_I2C_DATA_LENGTH = 30;
+#ifndef MAX_I2C_DATA_LENGTH
+const int MAX_I2C_DATA_LENGTH = SIGMA_I2C_BUFFER_SIZE - 2;
+#endif
+static_assert(MAX_I2C_DATA_LENGTH >= 5, "I2C buffer must hold at least one DSP word");
 
 /** 返回某个DSP内存位置的深度（以字节为单位）。
  * 目前此函数仅针对数据内存和程序内存实现。
  * 不包括控制寄存器。
- * 此函数仅在I2C时需要；它的存在是因为Teensy I2C库中的缓冲区大小限制。
+ * 此函数最初只为I2C分块而存在（Teensy I2C库的缓冲区大小限制），
+ * 现在下载计划器合并写入时也用它判断字宽，所以SPI构建同样需要。
  */
 
-
-#if USE_SPI == false
-byte getMemoryDepth(uint32_t address) {
+// constexpr 以便分块计划在参数为常量时于编译期求值（单一return语句，兼容C++11）
+constexpr byte getMemoryDepth(uint32_t address) {
 #if DSP_TYPE == DSP_TYPE_SIGMA100
-    if (address < 0x0400)
-        return 4;    // 参数RAM深度为4字节
-    else {
-        return 5;    // 程序RAM深度为5字节
-    }
+    return address < 0x0400 ? 4     // 参数RAM深度为4字节
+                            : 5;    // 程序RAM深度为5字节
 #elif DSP_TYPE == DSP_TYPE_SIGMA200
     // Based on ADAU1761
-    if (address < 0x0800) {
-        return 4;    // 参数RAM深度为4字节
-    }
-    else {
-        return 5;
-    }
+    return address < 0x0800 ? 4     // 参数RAM深度为4字节
+                            : 5;
 #elif (DSP_TYPE == DSP_TYPE_SIGMA300_350)
-    if (address < 0xF000) {
-        return 4;    // 程序内存、DM0和DM1都存储4字节（ADAU1463数据手册
-                     // 第90页）
-    }
-    else {
-        return 2;    // 控制寄存器都存储2字节（ADAU1463数据手册第93页）
-    }
+    return address < 0xF000 ? 4     // 程序内存、DM0和DM1都存储4字节（ADAU1463数据手册
+                                    // 第90页）
+                            : 2;    // 控制寄存器都存储2字节（ADAU1463数据手册第93页）
 #else
     return 0;    // 我们永远不应该到达这个返回值
 #endif
 }
+
+// 字宽发生变化的地址（参数RAM/程序RAM或数据内存/控制寄存器的分界）
+#if DSP_TYPE == DSP_TYPE_SIGMA100
+#define SIGMA_MEMORY_DEPTH_BOUNDARY 0x0400
+#elif DSP_TYPE == DSP_TYPE_SIGMA200
+#define SIGMA_MEMORY_DEPTH_BOUNDARY 0x0800
+#else
+#define SIGMA_MEMORY_DEPTH_BOUNDARY 0xF000
 #endif
 
+// ========== 分块计划 ==========
+// 分块只取决于起始地址所在区域的字宽，所以每块只需计算一次，
+// 不必像以前那样逐字节调用 getMemoryDepth()。
 
-// ========== 优化的SIGMA_WRITE_REGISTER_BLOCK函数 ==========
-uint8_t SIGMA_WRITE_REGISTER_BLOCK(byte devAddress, int address, int length, byte pData[]) {
-    // 参数验证
-    if (length <= 0 || !pData) {
-        g_sigma_last_error = SIGMA_ERROR_INVALID_PARAM;
-        return g_sigma_last_error;
+// 一个I2C突发中能容纳的最大字对齐数据字节数
+constexpr int SIGMA_CHUNK_BYTES(uint32_t address) {
+    return (MAX_I2C_DATA_LENGTH / getMemoryDepth(address)) * getMemoryDepth(address);
+}
+
+// address 到字宽分界处还能写入的字节数
+constexpr uint32_t SIGMA_BYTES_TO_BOUNDARY(uint32_t address) {
+    return address < SIGMA_MEMORY_DEPTH_BOUNDARY ? (SIGMA_MEMORY_DEPTH_BOUNDARY - address) * getMemoryDepth(address)
+                                                 : 0xFFFFFFFF;
+}
+
+constexpr int SIGMA_MIN_LENGTH(int a, uint32_t b) {
+    return uint32_t(a) < b ? a : int(b);
+}
+
+// 从 address 开始的一块写入的数据字节数：不超过一个突发，也不跨越字宽分界
+constexpr int SIGMA_CHUNK_LENGTH(uint32_t address, int remaining) {
+    return SIGMA_MIN_LENGTH(SIGMA_MIN_LENGTH(remaining, SIGMA_CHUNK_BYTES(address)),
+                            SIGMA_BYTES_TO_BOUNDARY(address));
+}
+
+// 一次 requestFrom() 能读回的最大字对齐字节数：读取没有子地址开销，只受Wire接收缓冲区限制
+constexpr int SIGMA_READ_CHUNK_BYTES(uint32_t address) {
+    return (SIGMA_I2C_BUFFER_SIZE / getMemoryDepth(address)) * getMemoryDepth(address);
+}
+
+// 同一区域内的一次块写入需要的I2C事务数（与 SIGMA_WRITE_REGISTER_BLOCK 的分块一致）
+constexpr int SIGMA_CHUNK_COUNT(uint32_t address, int length) {
+    return length < MAX_I2C_DATA_LENGTH ? 1
+                                        : (length + SIGMA_CHUNK_BYTES(address) - 1) / SIGMA_CHUNK_BYTES(address);
+}
+
+// ========== 传输策略（编译期） ==========
+// 总线访问集中在传输类里，写入/读取引擎（SIGMA_WRITE_REGISTER_BLOCK、SIGMA_READ_REGISTER_BYTES、
+// 计划器、序列和镜像执行）以模板参数 Bus 选择其一。传输类只有静态成员和编译期常量，
+// 每个实例只内联自己的一条路径，没有函数指针或虚函数。
+//
+// 不指定 Bus 的调用使用 SigmaDefaultTransport（按 USE_SPI 选择），导出文件和已有代码不变。
+// 同一固件里的另一个DSP用自己的传输，例如I2C板上再接一片SPI的DSP：
+//   #define SIGMA_WITH_SPI true                  // 在包含此头文件之前
+//   typedef SigmaSpiTransport<7> DspB;           // 片选为7脚
+//   DspB::begin();
+//   SIGMA_RUN_SEQUENCE<DspB>(DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1);
+//   SIGMA_WRITE_REGISTER_INTEGER<DspB>(MOD_GAIN_ADDR, 0x00800000);
+// 每个传输有自己的下载计划器（SIGMA_DOWNLOAD_BEGIN<DspB>()），错误状态和启动计时仍是全局的一份。
+//
+// 传输类提供：
+//   ACKED                                 写入有应答：失败可以检测和重试，要重发的数据先暂存
+//   PLAN_BYTES                            计划器合并缓冲区长度
+//   begin()                               初始化总线
+//   setClock(频率)、clock()               运行时的总线时钟
+//   clockStep(i)                          时钟鉴定的第i档（从慢到快），没有更多时为0（见"总线时钟鉴定"）
+//   chunkLength(地址, 剩余, 总长, 上限)   下一个写事务的数据字节数，不超过上限（暂存区、非阻塞每步）
+//   write(地址, 数据, 长度, progmem)      一个写事务，失败时按传输的方式重试
+//   writeZeros(地址, 长度)                一个写入零的事务
+//   open(地址)、put(数据, 长度)、close(长度)  分段给出数据的一个写事务（边解压、边读文件），不重试
+//   read(地址, 数据, 长度)                读取，需要时分成多个事务
+// 主机测试用的记录型和模型传输见 host/SigmaTransports.h。
+
+#define SIGMA_STEP_UNLIMITED 0xFFFF    // chunkLength() 不限制事务长度
+
+// 没有突发长度限制的传输：不超过 limit 时一个事务写完，否则按字对齐切分，且不跨越字宽分界
+constexpr int SIGMA_STEP_LENGTH(uint32_t address, int remaining, int limit) {
+    return remaining <= limit ? remaining
+                              : SIGMA_MIN_LENGTH((limit / getMemoryDepth(address)) * getMemoryDepth(address),
+                                                 SIGMA_BYTES_TO_BOUNDARY(address));
+}
+
+// 没有突发长度限制的传输（SPI、主机模拟）的合并缓冲区长度；I2C受单个突发限制，为 MAX_I2C_DATA_LENGTH
+#ifndef SIGMA_PLAN_BUFFER_SIZE
+  #define SIGMA_PLAN_BUFFER_SIZE 64
+#endif
+
+// 时钟鉴定依次尝试的各档时钟（从慢到快）：I2C标准、快速、快速+模式；SPI到DSP的上限
+#ifndef SIGMA_I2C_CLOCK_STEPS
+  #define SIGMA_I2C_CLOCK_STEPS 100000, 400000, 1000000
+#endif
+#ifndef SIGMA_SPI_CLOCK_STEPS
+  #define SIGMA_SPI_CLOCK_STEPS 1000000, 4000000, 8000000, 12000000, 16000000, 20000000, SIGMA_SPI_CLOCK_MAX
+#endif
+
+#if SIGMA_WITH_I2C
+static const uint8_t g_sigma_zeros[MAX_I2C_DATA_LENGTH] = {0};
+
+// I2C：每个突发不超过Wire发送缓冲区（分块计划见上），写入失败时按
+// SIGMA_RETRY_COUNT/SIGMA_RETRY_BACKOFF_MS 重试
+template <int Address = DSP_I2C_ADDR, TwoWire* Port = &Wire>
+struct SigmaI2cTransport {
+    static constexpr bool ACKED = true;
+    static constexpr int PLAN_BYTES = MAX_I2C_DATA_LENGTH;
+
+    static uint32_t speed;    // 当前时钟，初始为 I2C_CLOCK_SPEED
+
+    static void begin() {
+        Port->begin();
+        Port->setClock(speed);
+
+        #if defined(WIRE_HAS_TIMEOUT)
+        Port->setWireTimeout(I2C_TIMEOUT_MS * 1000, true); // 转换为微秒
+        #endif
+
+        SIGMA_DEBUG_PRINTLN("I2C initialized");
     }
-    
-    g_sigma_last_error = SIGMA_SUCCESS;
-    
-#if USE_SPI    // SPI写入函数开始
-    digitalWrite(DSP_SS_PIN, LOW);
-    SPI.beginTransaction(settingsA);
-    SPI.transfer(0x0);
-    SPI.transfer(address >> 8);
-    SPI.transfer(address & 0xff);
-    for (int i = 0; i < length; i++) {
-        SPI.transfer(pData[i]);
+
+    static void setClock(uint32_t hz) {
+        speed = hz;
+        Port->setClock(hz);
     }
-    SPI.endTransaction();
-    digitalWrite(DSP_SS_PIN, HIGH);
-    return SIGMA_SUCCESS;
-    
-#else     // I2C写入函数开始 - 优化版本
-    // 如果数据可以放入一个I2C缓冲区，则一次性发送
-    if (length < MAX_I2C_DATA_LENGTH) {
-        Wire.beginTransmission(DSP_I2C_ADDR);
-        Wire.write(address >> 8);
-        Wire.write(address & 0xff);
-        Wire.write(pData, length);
-        uint8_t error = Wire.endTransmission();
+
+    static uint32_t clock() {
+        return speed;
+    }
+
+    static uint32_t clockStep(int i) {
+        static const uint32_t steps[] = {SIGMA_I2C_CLOCK_STEPS};
+        return i < int(sizeof(steps) / sizeof(steps[0])) ? steps[i] : 0;
+    }
+
+    // 短数据一次发送，保持与原实现相同的事务划分；分块计划本身不超过一个突发
+    static int chunkLength(uint32_t address, int remaining, int total, int limit = SIGMA_STEP_UNLIMITED) {
+        (void)limit;
+        return total < MAX_I2C_DATA_LENGTH ? remaining : SIGMA_CHUNK_LENGTH(address, remaining);
+    }
+
+    // 当前设备登记的地址，否则为模板参数（见"多DSP：设备表"）
+    static int target() {
+        return g_sigma_device->i2cAddress ? g_sigma_device->i2cAddress : Address;
+    }
+
+    static void open(uint32_t address) {
+        Port->beginTransmission(target());
+        Port->write(byte(address >> 8));
+        Port->write(byte(address & 0xff));
+    }
+
+    static void put(const uint8_t* data, int length) {
+        Port->write(data, length);
+    }
+
+    static uint8_t close(int length) {
+        uint8_t error = Port->endTransmission();
+        SIGMA_TIMING_BUS(length);
         return checkI2CError(error);
     }
-    else {
-        // 分块传输 - 优化版本
-        int currentByte = 0;
-        int currentAddr = address;
 
-        while (currentByte < length) {
-            Wire.beginTransmission(DSP_I2C_ADDR);
-            Wire.write(currentAddr >> 8);
-            Wire.write(currentAddr & 0xff);
-
-            int bytesTransmitted = 0;
-            while ((bytesTransmitted + getMemoryDepth(uint32_t(currentAddr)) <= MAX_I2C_DATA_LENGTH) &&
-                (currentByte < length)) {
-                for (byte i = 0; i < getMemoryDepth(uint32_t(currentAddr)) && currentByte < length; i++) {
-                    Wire.write(pData[currentByte++]);
-                    bytesTransmitted++;
-                }
-                currentAddr++;
+    // 发送一个突发。progmem 为 true 时 data 位于闪存，先用一次 memcpy_P 复制到暂存区
+    static uint8_t write(uint32_t address, const uint8_t* data, int length, bool progmem) {
+        uint8_t staging[MAX_I2C_DATA_LENGTH];
+        if (progmem) {
+            memcpy_P(staging, data, length);
+            data = staging;
+        }
+        uint8_t previous = g_sigma_last_error;
+        uint32_t backoff = SIGMA_RETRY_BACKOFF_MS;
+        for (int attempt = 0; ; attempt++) {
+            open(address);
+            put(data, length);
+            uint8_t error = Port->endTransmission();
+            SIGMA_TIMING_BUS(length);
+            if (error == 0) {
+                g_sigma_last_error = previous;    // 重试成功不留下错误
+                return SIGMA_SUCCESS;
+            }
+            checkI2CError(error);
+            // 数据超出Wire缓冲区（1）是调用错误，重试无用
+            if (error == 1 || attempt >= SIGMA_RETRY_COUNT) {
+                g_sigma_retry_failures++;
+                return g_sigma_last_error;
             }
-            
-            uint8_t error = Wire.endTransmission();
+            g_sigma_retries++;
+            delay(backoff);
+            backoff *= 2;
+        }
+    }
+
+    static uint8_t writeZeros(uint32_t address, int length) {
+        return write(address, g_sigma_zeros, length, false);
+    }
+
+    // 按字对齐分块读取，每块重新发送子地址，长度不受接收缓冲区限制
+    static uint8_t read(uint32_t address, uint8_t* data, int length) {
+        uint32_t currentAddr = address;
+        int currentByte = 0;
+        while (currentByte < length) {
+            int chunk = SIGMA_MIN_LENGTH(SIGMA_MIN_LENGTH(length - currentByte, SIGMA_READ_CHUNK_BYTES(currentAddr)),
+                                         SIGMA_BYTES_TO_BOUNDARY(currentAddr));
+            Port->beginTransmission(target());
+            Port->write(byte(currentAddr >> 8));
+            Port->write(byte(currentAddr & 0xff));
+            uint8_t error = Port->endTransmission(false);
+            SIGMA_TIMING_BUS(0);
+
             if (checkI2CError(error) != SIGMA_SUCCESS) {
                 return g_sigma_last_error;
             }
+
+            int received = Port->requestFrom(target(), chunk);
+            SIGMA_TIMING_BUS(received);
+            if (received != chunk) {
+                g_sigma_last_error = SIGMA_ERROR_I2C_DATA;
+                return g_sigma_last_error;
+            }
+
+            for (int i = 0; i < chunk; i++) {
+                if (Port->available()) {
+                    data[currentByte + i] = Port->read();
+                } else {
+                    g_sigma_last_error = SIGMA_ERROR_I2C_DATA;
+                    return g_sigma_last_error;
+                }
+            }
+
+            byte depth = getMemoryDepth(currentAddr);
+            currentAddr += (chunk + depth - 1) / depth;
+            currentByte += chunk;
         }
         return SIGMA_SUCCESS;
     }
+};
+
+template <int Address, TwoWire* Port>
+uint32_t SigmaI2cTransport<Address, Port>::speed = I2C_CLOCK_SPEED;
 #endif
-}
 
+#if SIGMA_WITH_SPI
+// ADAU145x SPI从机的最高SCLK；MCU的SPI库把时钟向下取整到自己能分出的频率
+#define SIGMA_SPI_CLOCK_MAX 22000000L
 
-// 用于progmem类型
-void SIGMA_WRITE_REGISTER_BLOCK(byte devAddress, int address, int length, const uint8_t pData[], int addrOffset) {
-#if USE_SPI    // SPI写入函数开始
-    // 断言SPI从设备选择线
-    digitalWrite(DSP_SS_PIN, LOW);        // 断言SPI从设备选择线（低电平有效）
-    SPI.beginTransaction(settingsA);      // 初始化SPI
-    SPI.transfer(0x0);                    // SPI读取地址 + 读/!写位
-    SPI.transfer(address >> 8);           // 地址高字节
-    SPI.transfer(address & 0xff);         // 地址低字节
-    for (int i = 0; i < length; i++) {    // 对于数据包中的每个数据字节...
-        SPI.transfer(pgm_read_byte_near(pData+i+addrOffset));           // 将数据字节写入DSP
-    }
-    SPI.endTransaction();              // 释放SPI总线
-    digitalWrite(DSP_SS_PIN, HIGH);    // 拉高从设备选择线
-// SPI写入函数结束
-#else     // I2C写入函数开始
-
-
-     // 如果数据可以放入一个I2C缓冲区，则一次性发送。
-    if (length < MAX_I2C_DATA_LENGTH) {
-        Wire.beginTransmission(DSP_I2C_ADDR);    // 初始化新的I2C传输
-        Wire.write(address >> 8);                // 将地址高字节添加到I2C缓冲区
-        Wire.write(address & 0xff);              // 将地址低字节添加到I2C缓冲区
-        for (int i=0;i<length;i++){
-            Wire.write(pgm_read_byte_near(pData+i+addrOffset));               // 将整个数据包添加到I2C缓冲区
-        }
-        Wire.endTransmission();                  // 将整个I2C传输发送到DSP
+// SPI块传输的暂存区：数据（含闪存中的）按块复制后一次 SPI.transfer(buf, n) 发出，
+// 字节之间没有逐字节调用和 pgm_read 的间隙
+#ifndef SIGMA_SPI_STAGE
+  #define SIGMA_SPI_STAGE 32
+#endif
+
+// SPI：没有应答（写入失败无法检测，不重试），也没有缓冲区限制，一次写入一个事务。
+// 地址前的命令字节：0x00 写，0x01 读。
+// ADAU145x 上电和硬件复位后处于I2C模式，片选拉低三次后才切换到SPI：begin() 先做三次
+// 空写，复位脚拉过之后要再调用一次 begin()（或 latch()）
+template <uint8_t SsPin = DSP_SS_PIN, uint32_t Clock = SPI_SPEED, SPIClass* Port = &SPI>
+struct SigmaSpiTransport {
+    static_assert(Clock <= SIGMA_SPI_CLOCK_MAX, "SPI clock above the ADAU145x maximum");
+
+    static constexpr bool ACKED = false;
+    static constexpr int PLAN_BYTES = SIGMA_PLAN_BUFFER_SIZE;
+
+    static uint32_t speed;    // 当前时钟，初始为 Clock
+
+    static void begin() {
+        pinMode(SsPin, OUTPUT);
+        digitalWrite(SsPin, HIGH);
+        Port->begin();
+        latch();
     }
-    else {
-        // 逐字节进行传输。
-        int currentByte = 0;
 
-        while (currentByte < length) {
-            // 开始新的I2C事务。
-            Wire.beginTransmission(DSP_I2C_ADDR);
-            Wire.write(address >> 8);
-            Wire.write(address & 0xff);
-            
-            int bytesTransmitted = 0;
-            // 对于每个字节，找出它是否适合当前事务，并
-            // 确保仍有数据要发送。
-            while ((bytesTransmitted + getMemoryDepth(uint32_t(address)) <= MAX_I2C_DATA_LENGTH) &&
-                (currentByte < length)) {
-                // 如果另一个寄存器适合当前I2C突发写入，
-                // 逐个将每个字节添加到I2C缓冲区。
-                for (byte i = 0; i < getMemoryDepth(uint32_t(address)); i++) {
-                    Wire.write(pgm_read_byte_near(pData+currentByte+addrOffset)); 
-                    currentByte++;
-                    bytesTransmitted++;
-                }
-                // 每写入一个寄存器增加一次地址。
-                address++;
+    // 三次空写把DSP锁定在SPI模式，I2C模式下DSP不理会这些字节
+    static void latch() {
+        for (int i = 0; i < 3; i++) {
+            digitalWrite(SsPin, LOW);
+            Port->beginTransaction(SPISettings(speed, MSBFIRST, SPI_MODE3));
+            Port->transfer(0x00);
+            Port->endTransaction();
+            digitalWrite(SsPin, HIGH);
+        }
+    }
+
+    // 新时钟从下一个事务起生效，不超过 SIGMA_SPI_CLOCK_MAX
+    static void setClock(uint32_t hz) {
+        speed = hz < uint32_t(SIGMA_SPI_CLOCK_MAX) ? hz : uint32_t(SIGMA_SPI_CLOCK_MAX);
+    }
+
+    static uint32_t clock() {
+        return speed;
+    }
+
+    static uint32_t clockStep(int i) {
+        static const uint32_t steps[] = {SIGMA_SPI_CLOCK_STEPS};
+        return i < int(sizeof(steps) / sizeof(steps[0])) ? steps[i] : 0;
+    }
+
+    static int chunkLength(uint32_t address, int remaining, int total, int limit = SIGMA_STEP_UNLIMITED) {
+        (void)total;
+        return SIGMA_STEP_LENGTH(address, remaining, limit);
+    }
+
+    static void start(uint8_t command, uint32_t address) {
+        uint8_t header[3] = {command, uint8_t(address >> 8), uint8_t(address & 0xff)};   // 读/!写位、地址
+        digitalWrite(SsPin, LOW);                                           // 断言SPI从设备选择线（低电平有效）
+        Port->beginTransaction(SPISettings(speed, MSBFIRST, SPI_MODE3));   // 初始化SPI
+        Port->transfer(header, sizeof(header));
+    }
+
+    // 按暂存区分块发送；transfer() 原地写回收到的字节，所以每块都重新复制
+    static void send(const uint8_t* data, int length, bool progmem) {
+        uint8_t stage[SIGMA_SPI_STAGE];
+        for (int done = 0; done < length; ) {
+            int n = SIGMA_MIN_LENGTH(length - done, SIGMA_SPI_STAGE);
+            if (!data) {
+                memset(stage, 0, n);
             }
-            Wire.endTransmission();    // 现在缓冲区已满，发送I2C突发。
-            if (currentByte == length) {
-                break;
+            else if (progmem) {
+                memcpy_P(stage, data + done, n);
             }
+            else {
+                memcpy(stage, data + done, n);
+            }
+            Port->transfer(stage, n);
+            done += n;
+        }
+    }
+
+    static void open(uint32_t address) {
+        start(0x0, address);
+    }
+
+    static void put(const uint8_t* data, int length) {
+        send(data, length, false);
+    }
+
+    static uint8_t close(int length) {
+        Port->endTransaction();         // 释放SPI总线
+        digitalWrite(SsPin, HIGH);      // 拉高从设备选择线
+        SIGMA_TIMING_BUS(length);
+        return SIGMA_SUCCESS;
+    }
+
+    // progmem 为 true 时 data 位于闪存
+    static uint8_t write(uint32_t address, const uint8_t* data, int length, bool progmem) {
+        open(address);
+        send(data, length, progmem);
+        return close(length);
+    }
+
+    static uint8_t writeZeros(uint32_t address, int length) {
+        open(address);
+        send(nullptr, length, false);
+        return close(length);
+    }
+
+    static uint8_t read(uint32_t address, uint8_t* data, int length) {
+        start(0x1, address);
+        memset(data, 0, length);
+        Port->transfer(data, length);
+        return close(length);
+    }
+};
+
+template <uint8_t SsPin, uint32_t Clock, SPIClass* Port>
+uint32_t SigmaSpiTransport<SsPin, Clock, Port>::speed = Clock;
+#endif
+
+#if USE_SPI
+typedef SigmaSpiTransport<> SigmaDefaultTransport;
+#else
+typedef SigmaI2cTransport<> SigmaDefaultTransport;
+#endif
+
+// 默认传输的总线初始化（沿用原来的名称，SPI构建时初始化SPI和片选脚）
+void SIGMA_I2C_INIT() {
+    SigmaDefaultTransport::begin();
+}
+
+// ========== 直接写入（不经过下载计划器） ==========
+// 按传输的分块计划发送，progmem 为 true 时 pData 位于闪存
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_WRITE_DIRECT(int address, int length, const uint8_t* pData, bool progmem) {
+    uint32_t currentAddr = uint32_t(address);
+    int currentByte = 0;
+
+    while (currentByte < length) {
+        int chunk = Bus::chunkLength(currentAddr, length - currentByte, length);
+        uint8_t result = Bus::write(currentAddr, pData + currentByte, chunk, progmem);
+        if (result != SIGMA_SUCCESS) {
+            return result;
         }
+
+        byte depth = getMemoryDepth(currentAddr);
+        currentAddr += (chunk + depth - 1) / depth;    // 每个（含不完整的）字地址加1
+        currentByte += chunk;
+    }
+    return SIGMA_SUCCESS;
+}
+
+// ========== 下载计划器：合并连续地址的写入 ==========
+// 在 SIGMA_DOWNLOAD_BEGIN() 与 SIGMA_DOWNLOAD_END() 之间，导出文件中对连续
+// 地址、相同字宽的 SIGMA_WRITE_REGISTER_BLOCK 调用会被合并为一次突发
+// （例如 SOUT_SOURCE0..23）。写入顺序不变，只是相邻的写入共用一个事务。
+//
+// 以下操作是排序屏障，前面积累的写入会先发出，且它们自己单独成为一个事务：
+//   - 软复位、休眠、内核启动/停止、PLL相关寄存器（SIGMA_IS_BARRIER_REGISTER）
+//   - SIGMA_WRITE_DELAY 延迟
+//   - 任何读操作和不经计划器的RAM写入
+//
+// 用法：
+//   SIGMA_DOWNLOAD_BEGIN();
+//   default_download_IC_1();
+//   SIGMA_DOWNLOAD_END();
+
+// 必须单独发送、不得与其他写入合并的控制寄存器
+constexpr bool SIGMA_IS_BARRIER_REGISTER(uint32_t address) {
+#if DSP_TYPE == DSP_TYPE_SIGMA300_350
+    return (address >= 0xF000 && address <= 0xF006)    // PLL_CTRL0..PLL_WATCHDOG（含PLL_ENABLE/PLL_LOCK）
+        || (address >= 0xF400 && address <= 0xF404)    // HIBERNATE、START_PULSE、START_CORE、KILL_CORE、START_ADDRESS
+        || address == 0xF890;                          // SOFT_RESET
+#else
+    return true;    // 其他DSP类型的寄存器映射未整理，不合并
+#endif
+}
+
+// 每个传输一份计划器状态
+template <typename Bus>
+struct SigmaPlanState {
+    static bool active;
+    static uint8_t buffer[Bus::PLAN_BYTES];
+    static int address;      // 缓冲区内容的起始地址
+    static int next;         // 下一个可以接上的地址
+    static int length;
+    static uint8_t error;
+    static SigmaDevice* device;    // 缓冲区内容所属的设备（见"多DSP：设备表"）
+};
+
+template <typename Bus> bool SigmaPlanState<Bus>::active = false;
+template <typename Bus> uint8_t SigmaPlanState<Bus>::buffer[Bus::PLAN_BYTES];
+template <typename Bus> int SigmaPlanState<Bus>::address = 0;
+template <typename Bus> int SigmaPlanState<Bus>::next = 0;
+template <typename Bus> int SigmaPlanState<Bus>::length = 0;
+template <typename Bus> uint8_t SigmaPlanState<Bus>::error = SIGMA_SUCCESS;
+template <typename Bus> SigmaDevice* SigmaPlanState<Bus>::device = &g_sigma_default_device;
+
+// 发出积累的写入。失败时保留缓冲区内容，下一次冲刷从这里继续
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_PLAN_FLUSH() {
+    typedef SigmaPlanState<Bus> Plan;
+    if (Plan::length == 0) {
+        return SIGMA_SUCCESS;
+    }
+    // 另一个传输上切换了设备时，缓冲的写入仍发往积累它们的设备
+    SigmaDevice* current = g_sigma_device;
+    g_sigma_device = Plan::device;
+    uint8_t result = SIGMA_WRITE_DIRECT<Bus>(Plan::address, Plan::length, Plan::buffer, false);
+    g_sigma_device = current;
+    if (result != SIGMA_SUCCESS) {
+        if (Plan::error == SIGMA_SUCCESS) {
+            Plan::error = result;
+        }
+        return result;
+    }
+    Plan::length = 0;
+    return SIGMA_SUCCESS;
+}
+
+// pData 位于闪存（progmem 为 false 时在RAM）。返回错误时本次写入没有被接收，可以原样再调用一次
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_PLAN_WRITE(int address, int length, const uint8_t* pData, bool progmem = true) {
+    typedef SigmaPlanState<Bus> Plan;
+    byte depth = getMemoryDepth(uint32_t(address));
+    bool wholeWords = (length % depth) == 0;
+
+    if (SIGMA_IS_BARRIER_REGISTER(uint32_t(address)) || !wholeWords || length > Bus::PLAN_BYTES) {
+        uint8_t result = SIGMA_PLAN_FLUSH<Bus>();
+        if (result == SIGMA_SUCCESS) {
+            result = SIGMA_WRITE_DIRECT<Bus>(address, length, pData, progmem);
+        }
+        if (result != SIGMA_SUCCESS && Plan::error == SIGMA_SUCCESS) {
+            Plan::error = result;
+        }
+        return result;
+    }
+
+    bool contiguous = Plan::length > 0 && address == Plan::next && Plan::device == g_sigma_device &&
+                      getMemoryDepth(uint32_t(Plan::address)) == depth &&
+                      Plan::length + length <= Bus::PLAN_BYTES;
+    if (!contiguous) {
+        uint8_t result = SIGMA_PLAN_FLUSH<Bus>();
+        if (result != SIGMA_SUCCESS) {
+            return result;
+        }
+        Plan::address = address;
+        Plan::device = g_sigma_device;
+    }
+    if (progmem) {
+        memcpy_P(Plan::buffer + Plan::length, pData, length);
+    }
+    else {
+        memcpy(Plan::buffer + Plan::length, pData, length);
+    }
+    Plan::length += length;
+    Plan::next = address + length / depth;
+    return SIGMA_SUCCESS;
+}
+
+template <typename Bus = SigmaDefaultTransport>
+void SIGMA_DOWNLOAD_BEGIN() {
+    SigmaPlanState<Bus>::active = true;
+    SigmaPlanState<Bus>::length = 0;
+    SigmaPlanState<Bus>::error = SIGMA_SUCCESS;
+}
+
+// 发出剩余写入并结束合并，返回下载期间的第一个错误
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_DOWNLOAD_END() {
+    SIGMA_PLAN_FLUSH<Bus>();
+    SigmaPlanState<Bus>::length = 0;    // 冲刷失败时丢弃，错误已记录
+    SigmaPlanState<Bus>::active = false;
+    return SigmaPlanState<Bus>::error;
+}
+
+// ========== 优化的SIGMA_WRITE_REGISTER_BLOCK函数 ==========
+// Bus 为传输类（见"传输策略"），不指定时为默认传输
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_WRITE_REGISTER_BLOCK(byte devAddress, int address, int length, byte pData[]) {
+    SIGMA_SELECT_DEVICE<Bus>(devAddress);
+    // 参数验证
+    if (length <= 0 || !pData) {
+        g_sigma_last_error = SIGMA_ERROR_INVALID_PARAM;
+        return g_sigma_last_error;
+    }
+    
+    g_sigma_last_error = SIGMA_SUCCESS;
+    SIGMA_PLAN_FLUSH<Bus>();    // 保持与计划器中待发写入的顺序
+    SIGMA_TIMING_PHASE<Bus>(uint32_t(address));
+    return SIGMA_WRITE_DIRECT<Bus>(address, length, pData, false);
+}
+
+
+// 用于progmem类型
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_WRITE_REGISTER_BLOCK(byte devAddress, int address, int length, const uint8_t pData[], int addrOffset) {
+    SIGMA_SELECT_DEVICE<Bus>(devAddress);
+    SIGMA_TIMING_PHASE<Bus>(uint32_t(address));
+    if (SigmaPlanState<Bus>::active) {
+        return SIGMA_PLAN_WRITE<Bus>(address, length, pData + addrOffset);
+    }
+    // I2C：每块一次 memcpy_P + 一次 Wire.write()，分块边界按区域字宽预先确定
+    return SIGMA_WRITE_DIRECT<Bus>(address, length, pData + addrOffset, true);
+}
+
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_WRITE_REGISTER_BLOCK(byte devAddress, int address, int length, const uint8_t pData[]) {
+  return SIGMA_WRITE_REGISTER_BLOCK<Bus>(devAddress, address, length, pData, 0);
+}
+
+// 不带地址的替代函数调用（单DSP系统，或当前设备）
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_WRITE_REGISTER_BLOCK(int address, int length, byte pData[]) {
+    return SIGMA_WRITE_REGISTER_BLOCK<Bus>(SIGMA_CURRENT_DEVICE, address, length, pData);
+}
+
+
+
+// ========== 优化的整数和浮点写入函数 ==========
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_WRITE_REGISTER_INTEGER(int address, int32_t pData) {
+    byte byte_data[4];
+    SIGMASTUDIOTYPE_REGISTER_CONVERT(pData, byte_data);
+    return SIGMA_WRITE_REGISTER_BLOCK<Bus>(SIGMA_CURRENT_DEVICE, address, 4, byte_data);
+}
+
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_WRITE_REGISTER_FLOAT(int address, double pData) {
+    return SIGMA_WRITE_REGISTER_INTEGER<Bus>(address, SIGMASTUDIOTYPE_FIXPOINT_CONVERT(pData));
+}
+
+// 指定设备
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_WRITE_REGISTER_INTEGER(byte devAddress, int address, int32_t pData) {
+    SIGMA_SELECT_DEVICE<Bus>(devAddress);
+    return SIGMA_WRITE_REGISTER_INTEGER<Bus>(address, pData);
+}
+
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_WRITE_REGISTER_FLOAT(byte devAddress, int address, double pData) {
+    SIGMA_SELECT_DEVICE<Bus>(devAddress);
+    return SIGMA_WRITE_REGISTER_FLOAT<Bus>(address, pData);
+}
+
+// 便利函数：带错误检查的参数写入
+bool SIGMA_WRITE_PARAM_SAFE(int address, double value) {
+    uint8_t result = SIGMA_WRITE_REGISTER_FLOAT(address, value);
+    if (result != SIGMA_SUCCESS) {
+        SIGMA_DEBUG_PRINT("参数写入失败，地址: 0x");
+        SIGMA_DEBUG_PRINT_HEX(address);
+        SIGMA_DEBUG_PRINT(", 错误: ");
+        SIGMA_DEBUG_PRINTLN(result);
+        return false;
+    }
+    return true;
+}
+
+// 便利函数：批量参数写入
+bool SIGMA_WRITE_PARAMS_SAFE(int startAddress, double values[], int count) {
+    for (int i = 0; i < count; i++) {
+        if (!SIGMA_WRITE_PARAM_SAFE(startAddress + i, values[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 延迟数据为大端毫秒数（导出文件中为 0x00, 0xFF 这样的2字节）
+template <typename Bus = SigmaDefaultTransport>
+void SIGMA_WRITE_DELAY(byte devAddress, int length, byte pData[]) {
+    SIGMA_SELECT_DEVICE<Bus>(devAddress);
+    SIGMA_PLAN_FLUSH<Bus>();      // 延迟是排序屏障
+    uint32_t delay_length = 0;    // 初始化延迟长度变量
+    for (int i = 0; i < length; i++) {
+        // 解包pData以计算延迟长度为整数
+        delay_length = (delay_length << 8) | pData[i];
+    }
+    delay(delay_length);    // 延迟此处理器（不是DSP）适当的时间
+}
+
+// pData 位于闪存
+uint32_t SIGMA_DELAY_MS(int length, const uint8_t pData[]) {
+    uint32_t delay_length = 0;
+    for (int i = 0; i < length; i++) {
+        delay_length = (delay_length << 8) | pgm_read_byte_near(pData + i);
+    }
+    return delay_length;
+}
+
+template <typename Bus = SigmaDefaultTransport>
+void SIGMA_WRITE_DELAY(byte devAddress, int length, const uint8_t pData[]) {
+    SIGMA_SELECT_DEVICE<Bus>(devAddress);
+    SIGMA_PLAN_FLUSH<Bus>();      // 延迟是排序屏障
+    delay(SIGMA_DELAY_MS(length, pData));    // 延迟此处理器（不是DSP）适当的时间
+}
+
+// ========== 状态轮询 ==========
+// 导出序列在PLL使能、启动内核之后用固定延迟等待最坏情况。硬件报告状态的
+// 地方改为轮询状态寄存器，就绪后立即继续，导出的延迟只作为超时上限：
+//   PLL_ENABLE=1 之后  -> 轮询 PLL_LOCK bit0 = 1
+//   START_CORE=1 之后  -> 轮询 CORE_STATUS = 1（运行）
+// SOFT_RESET 和 HIBERNATE 没有对应的状态位，仍按导出的固定延迟等待。
+#ifndef SIGMA_POLL_READY
+  #define SIGMA_POLL_READY true       // false: 始终按导出的固定延迟等待
+#endif
+
+#ifndef SIGMA_POLL_INTERVAL_MS
+  #define SIGMA_POLL_INTERVAL_MS 1    // 轮询间隔(毫秒)
+#endif
+
+#define SIGMA_REG_PLL_ENABLE    0xF003
+#define SIGMA_REG_PLL_LOCK      0xF004
+#define SIGMA_REG_START_CORE    0xF402
+#define SIGMA_REG_CORE_STATUS   0xF405
+
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_READ_REGISTER_BYTES(int address, int length, byte* pData);
+
+static uint32_t g_sigma_wait_saved_ms = 0;    // 上一次下载序列中轮询比固定延迟少等的时间
+
+// 轮询2字节寄存器直到 (值 & mask) == expected，超时返回 SIGMA_ERROR_DSP_TIMEOUT
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_POLL_REGISTER(int address, uint16_t mask, uint16_t expected, uint32_t timeoutMs,
+                            uint32_t intervalMs = SIGMA_POLL_INTERVAL_MS) {
+    uint32_t start = millis();
+    while (true) {
+        byte value[2];
+        if (SIGMA_READ_REGISTER_BYTES<Bus>(address, 2, value) == SIGMA_SUCCESS &&
+            (uint16_t((value[0] << 8) | value[1]) & mask) == expected) {
+            return SIGMA_SUCCESS;
+        }
+        if (millis() - start >= timeoutMs) {
+            g_sigma_last_error = SIGMA_ERROR_DSP_TIMEOUT;
+            return g_sigma_last_error;
+        }
+        delay(intervalMs);
+    }
+}
+
+// 延迟前最后写入的寄存器能否由状态寄存器确认就绪：返回要轮询的状态寄存器
+// 地址（期望 (值 & *mask) == 1），不能轮询时返回0
+uint16_t SIGMA_READY_STATUS(uint16_t lastAddress, uint16_t lastValue, uint16_t* mask) {
+#if SIGMA_POLL_READY && DSP_TYPE == DSP_TYPE_SIGMA300_350
+    if (lastAddress == SIGMA_REG_PLL_ENABLE && (lastValue & 0x0001)) {
+        *mask = 0x0001;
+        return SIGMA_REG_PLL_LOCK;
+    }
+    if (lastAddress == SIGMA_REG_START_CORE && (lastValue & 0x0001)) {
+        *mask = 0x0007;
+        return SIGMA_REG_CORE_STATUS;
+    }
+#endif
+    (void)lastAddress;
+    (void)lastValue;
+    (void)mask;
+    return 0;
+}
+
+// 等待 timeoutMs 毫秒，或轮询到就绪为止：lastAddress/lastValue 是延迟前最后写入的寄存器
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_WAIT_READY_MS(uint16_t lastAddress, uint16_t lastValue, uint32_t timeoutMs) {
+    uint16_t mask = 0;
+    uint16_t status = SIGMA_READY_STATUS(lastAddress, lastValue, &mask);
+    if (status != 0) {
+        uint32_t start = millis();
+        uint8_t result = SIGMA_POLL_REGISTER<Bus>(status, mask, 0x0001, timeoutMs);
+        uint32_t elapsed = millis() - start;
+        if (elapsed < timeoutMs) {
+            g_sigma_wait_saved_ms += timeoutMs - elapsed;
+        }
+        return result;
+    }
+    SIGMA_PLAN_FLUSH<Bus>();      // 延迟是排序屏障
+    delay(timeoutMs);
+    return SIGMA_SUCCESS;
+}
+
+// 执行导出序列中的一个延迟（pData 位于闪存）
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_WAIT_READY(byte devAddress, uint16_t lastAddress, uint16_t lastValue, int length, const uint8_t pData[]) {
+    SIGMA_SELECT_DEVICE<Bus>(devAddress);
+    return SIGMA_WAIT_READY_MS<Bus>(lastAddress, lastValue, SIGMA_DELAY_MS(length, pData));
+}
+
+// 上一次 SIGMA_RUN_SEQUENCE()/SIGMA_RUN_TXBUFFER() 中轮询节省的毫秒数
+uint32_t SIGMA_WAIT_SAVED_MS() {
+    return g_sigma_wait_saved_ms;
+}
+
+// ========== 压缩数据流 ==========
+// 程序和数据内存占闪存的大头，DM1大部分是零字。sigma_sequence_gen --lz 把序列
+// 中的大块内存写入压缩成 SIGMA_SEQ_WRITE_LZ 条目（每个条目一个独立的流），
+// 执行时边解压边写入总线，只需要一个256字节的滑动窗口。标记字节：
+//   0x00-0x7F  随后 n+1 个字面字节
+//   0x80-0xBF  n+1 个零字节
+//   0xC0-0xFF  复制 n+3 个字节，下一字节为距离-1（窗口内1..256字节之前）
+// 解压器的窗口和状态约占300字节RAM（AVR上是一大块），默认不编译；使用压缩序列时
+// 在包含本文件之前定义 SIGMA_LZ_ENABLE 为 true，否则生成的 _SEQ_LZ.h 会报错。
+#ifndef SIGMA_LZ_ENABLE
+  #define SIGMA_LZ_ENABLE false
+#endif
+
+#define SIGMA_LZ_WINDOW   256
+#define SIGMA_LZ_LITERAL  0x00
+#define SIGMA_LZ_ZEROS    0x80
+#define SIGMA_LZ_COPY     0xC0
+#define SIGMA_LZ_STAGE    MAX_I2C_DATA_LENGTH    // 暂存一块的长度，没有应答的传输边解压边发送
+
+struct SigmaLzState {
+    const uint8_t* src;                // 闪存中的压缩流
+    uint8_t window[SIGMA_LZ_WINDOW];   // 最近输出的字节
+    uint8_t head;                      // 窗口写入位置，按256自然回绕
+    uint8_t token;                     // 当前标记类型（SIGMA_LZ_*）
+    uint8_t remaining;                 // 当前标记还要输出的字节数
+    uint8_t distance;                  // 复制距离-1
+    int entry;                         // 正在解压的序列条目，-1 表示没有
+    uint8_t stage[SIGMA_LZ_STAGE];     // 有应答的传输：已解压、待发送的一块，失败时原样重发
+    int staged;
+};
+
+void SIGMA_LZ_START(SigmaLzState* lz, const uint8_t* src) {
+    lz->src = src;
+    lz->head = 0;
+    lz->remaining = 0;
+}
+
+// 解压出下一个字节
+uint8_t SIGMA_LZ_NEXT(SigmaLzState* lz) {
+    if (lz->remaining == 0) {
+        uint8_t token = pgm_read_byte_near(lz->src++);
+        if (token < SIGMA_LZ_ZEROS) {
+            lz->token = SIGMA_LZ_LITERAL;
+            lz->remaining = uint8_t(token + 1);
+        }
+        else if (token < SIGMA_LZ_COPY) {
+            lz->token = SIGMA_LZ_ZEROS;
+            lz->remaining = uint8_t(token - SIGMA_LZ_ZEROS + 1);
+        }
+        else {
+            lz->token = SIGMA_LZ_COPY;
+            lz->remaining = uint8_t(token - SIGMA_LZ_COPY + 3);
+            lz->distance = pgm_read_byte_near(lz->src++);
+        }
+    }
+    uint8_t value;
+    if (lz->token == SIGMA_LZ_LITERAL) {
+        value = pgm_read_byte_near(lz->src++);
+    }
+    else if (lz->token == SIGMA_LZ_ZEROS) {
+        value = 0;
+    }
+    else {
+        value = lz->window[uint8_t(lz->head - lz->distance - 1)];
+    }
+    lz->window[lz->head++] = value;
+    lz->remaining--;
+    return value;
+}
+
+void SIGMA_LZ_READ(SigmaLzState* lz, uint8_t* out, int length) {
+    for (int i = 0; i < length; i++) {
+        out[i] = SIGMA_LZ_NEXT(lz);
+    }
+}
+
+// 边解压边写入，一个事务：每次解压 SIGMA_LZ_STAGE 字节交给传输
+template <typename Bus>
+uint8_t SIGMA_WRITE_LZ_STREAM(uint32_t address, int length, SigmaLzState* lz) {
+    Bus::open(address);
+    for (int i = 0; i < length; ) {
+        int n = length - i < SIGMA_LZ_STAGE ? length - i : SIGMA_LZ_STAGE;
+        SIGMA_LZ_READ(lz, lz->stage, n);
+        Bus::put(lz->stage, n);
+        i += n;
+    }
+    return Bus::close(length);
+}
+
+// ========== 表驱动下载序列 ==========
+// 导出文件里的 default_download_IC_x() 是几十个逐条展开的函数调用。
+// 序列表把它压缩成 {操作, 组, 地址, 长度, 偏移} 条目加一个PROGMEM数据块，
+// 由 SIGMA_RUN_SEQUENCE()（阻塞）或 SIGMA_SEQ_STEP()（非阻塞）执行，写入仍经过计划器/分块写入。
+//
+// 序列表由 host/sigma_sequence_gen 从 TxBuffer_IC_x.dat/NumBytes_IC_x.dat 生成：
+//   sigma_sequence_gen <导出目录> 1 > ADAU1452_EN_B_I2C_IC_1_SEQ.h
+//   sigma_sequence_gen --lz <导出目录> 1 > ADAU1452_EN_B_I2C_IC_1_SEQ_LZ.h   （内存数据压缩存放）
+//   sigma_sequence_gen --sparse <导出目录> 1 > ADAU1452_EN_B_I2C_IC_1_SEQ_SPARSE.h   （零段不存数据）
+// 生成的头文件包含导出文件，并提供入口函数 sequence_download[_SPARSE][_LZ]_IC_x()，
+// 导出文件本身保持 SigmaStudio 生成的原样。
+#define SIGMA_SEQ_WRITE   0    // 写 length 字节到 address
+#define SIGMA_SEQ_DELAY   1    // 延迟，数据为大端毫秒数；有状态位时改为轮询（见 SIGMA_WAIT_READY）
+#define SIGMA_SEQ_WRITE_LZ 2   // 同 SIGMA_SEQ_WRITE，数据为压缩流（见 SIGMA_LZ_*），length 为解压后的字节数
+#define SIGMA_SEQ_ZERO    3    // 写 length 字节的零，不占数据块（见 SIGMA_SEQ_SET_ZERO_MODE()）
+
+// 条目分组，增量重载（SIGMA_BOOT_INCREMENTAL）按组比较哈希、只重写变化的组
+#define SIGMA_GROUP_CONTROL  0    // 复位、休眠、内核启停和延迟，只在完整下载时执行
+#define SIGMA_GROUP_CLOCK    1    // PLL和电源寄存器
+#define SIGMA_GROUP_IO       2    // 其余控制寄存器（引脚、ASRC、串口、SPDIF）
+#define SIGMA_GROUP_PROGRAM  3
+#define SIGMA_GROUP_DM0      4
+#define SIGMA_GROUP_DM1      5
+#define SIGMA_GROUP_COUNT    6
+#define SIGMA_GROUP_BIT(g)   (uint8_t(1) << (g))
+#define SIGMA_GROUP_ALL      uint8_t((1 << SIGMA_GROUP_COUNT) - 1)
+
+struct SigmaSeqEntry {
+    uint8_t opcode;
+    uint8_t group;         // SIGMA_GROUP_*
+    uint16_t address;
+    uint16_t length;       // 数据字节数（不含地址）
+    uint32_t offset;       // 在数据块中的偏移
+};
+
+// 下载后读回校验的一段内存（程序、DM0参数、DM1数据），crc 为导出数据的CRC32
+struct SigmaSeqSection {
+    uint16_t address;
+    uint16_t length;       // 字节数
+    uint32_t crc;
+};
+
+// 热启动签名：address 处的数据内存字存放整个镜像（控制组以外的寄存器和内存）的CRC32（下载成功后写入），
+// 再加上均匀抽样的程序字。MCU复位而DSP仍在运行同一镜像时据此跳过下载
+#define SIGMA_SIGNATURE_SAMPLES 8
+
+struct SigmaSignature {
+    uint16_t address;
+    uint32_t value;
+    uint16_t sampleAddress[SIGMA_SIGNATURE_SAMPLES];
+    uint32_t sampleValue[SIGMA_SIGNATURE_SAMPLES];
+};
+
+// ========== 非阻塞执行 ==========
+// SIGMA_SEQ_STEP() 每次调用最多做一件事：发送一块数据（I2C为一个突发，
+// SPI不超过 stepBytes）、读一次状态寄存器，或检查延迟是否到期。延迟按
+// 截止时间处理而不调用 delay()，loop() 在下载期间仍可处理其他工作：
+//
+//   SigmaSeqState dl;
+//   SIGMA_SEQ_START(&dl, DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1);
+//   void loop() {
+//       if (SIGMA_SEQ_STEP(&dl)) {
+//           // 进度：dl.bytesSent / dl.bytesTotal
+//       }
+//       ...    // 编码器、界面、看门狗
+//   }
+//
+// 在 SIGMA_DOWNLOAD_BEGIN()/END() 之间执行时，小的写入仍交给计划器合并。
+//
+// 一块写入在重试（SIGMA_RETRY_COUNT）用尽后仍失败时，序列停在这一块上
+// （dl.failed），SIGMA_SEQ_STEP() 返回 false。排除故障后调用
+// SIGMA_SEQ_RESUME() 从失败的块继续，不必从 SOFT_RESET 重新下载。
+#ifndef SIGMA_SPI_STEP_BYTES
+  #define SIGMA_SPI_STEP_BYTES 256    // SPI每步最多发送的数据字节
+#endif
+
+struct SigmaSeqState {
+    const SigmaSeqEntry* table;    // 闪存
+    const uint8_t* blob;           // 闪存
+    int count;
+    int index;                     // 当前条目
+    uint32_t sent;                 // 当前条目已发送的字节
+    byte devAddress;
+    uint8_t groups;                // 只执行这些组的条目（SIGMA_GROUP_BIT 的组合）
+    SigmaLzState* lz;              // 序列含压缩条目时的解压器
+    uint8_t zeroMode;              // 零条目的处理方式（SIGMA_ZERO_*）
+    bool zeroStale;                // SIGMA_ZERO_CHECK 读回的一块不为零，下一步把它写零
+    uint16_t stepBytes;            // SPI每步字节数上限，I2C由分块计划决定
+    uint8_t error;                 // 不中断序列的第一个错误（如轮询超时）
+    bool failed;                   // 停在失败的块上，等待 SIGMA_SEQ_RESUME()
+    uint8_t failure;               // 导致停止的错误
+    uint16_t resumes;              // 从失败处继续的次数
+
+    // 延迟/轮询
+    bool waiting;
+    uint16_t statusAddress;        // 0 表示固定延迟
+    uint16_t statusMask;
+    uint32_t waitStart;
+    uint32_t waitMs;
+    uint32_t nextPoll;
+    uint32_t savedMs;              // 轮询比固定延迟少等的时间
+
+    uint16_t lastAddress;          // 最近一次单寄存器写入
+    uint16_t lastValue;
+
+    uint32_t bytesSent;            // 进度：已发送/总数据字节
+    uint32_t bytesTotal;
+    uint32_t bytesSkipped;         // 内存已为零、没有发送的零条目字节（计入 bytesSent）
+};
+
+#if SIGMA_LZ_ENABLE
+static SigmaLzState g_sigma_lz;    // 默认解压器，同时执行多个压缩序列时用 SIGMA_SEQ_SET_LZ() 各给一个
+#endif
+
+void SIGMA_SEQ_SET_LZ(SigmaSeqState* dl, SigmaLzState* lz) {
+    dl->lz = lz;
+    if (lz) {
+        lz->entry = -1;
+        lz->staged = 0;
+    }
+}
+
+void SIGMA_SEQ_START(SigmaSeqState* dl, byte devAddress, const SigmaSeqEntry table[], int count, const uint8_t blob[],
+                     uint8_t groups = SIGMA_GROUP_ALL) {
+    memset(dl, 0, sizeof(*dl));
+    dl->table = table;
+    dl->blob = blob;
+    dl->count = count;
+    dl->devAddress = devAddress;
+    dl->groups = groups;
+    dl->stepBytes = SIGMA_SPI_STEP_BYTES;
+    SIGMA_TIMING_START(SIGMA_TIMING_AUTO);
+    bool compressed = false;
+    for (int i = 0; i < count; i++) {
+        SigmaSeqEntry entry;
+        memcpy_P(&entry, &table[i], sizeof(entry));
+        if (entry.opcode != SIGMA_SEQ_DELAY && (groups & SIGMA_GROUP_BIT(entry.group))) {
+            dl->bytesTotal += entry.length;
+        }
+        compressed = compressed || entry.opcode == SIGMA_SEQ_WRITE_LZ;
+    }
+#if SIGMA_LZ_ENABLE
+    if (compressed) {
+        SIGMA_SEQ_SET_LZ(dl, &g_sigma_lz);
+    }
+#else
+    (void)compressed;
+#endif
+}
+
+bool SIGMA_SEQ_DONE(const SigmaSeqState* dl) {
+    return dl->index >= dl->count;
+}
+
+// 距离下一步有事可做还有多少毫秒（0 表示应立即调用 SIGMA_SEQ_STEP()）
+uint32_t SIGMA_SEQ_WAIT_MS(const SigmaSeqState* dl) {
+    if (!dl->waiting) {
+        return 0;
+    }
+    uint32_t now = millis();
+    uint32_t due = dl->statusAddress ? dl->nextPoll : dl->waitStart + dl->waitMs;
+    return int32_t(due - now) > 0 ? due - now : 0;
+}
+
+void SIGMA_SEQ_RESULT(SigmaSeqState* dl, uint8_t result) {
+    if (result != SIGMA_SUCCESS && dl->error == SIGMA_SUCCESS) {
+        dl->error = result;
+    }
+}
+
+// 本步发送的字节数：I2C与 SIGMA_WRITE_DIRECT 的分块一致，SPI按 stepBytes 切分
+template <typename Bus>
+int SIGMA_SEQ_CHUNK(const SigmaSeqState* dl, const SigmaSeqEntry* entry, uint32_t address) {
+    return Bus::chunkLength(address, int(entry->length - dl->sent), entry->length, dl->stepBytes);
+}
+
+// 停在当前块上，返回 false。继续并成功后这个错误不再报告
+bool SIGMA_SEQ_FAIL(SigmaSeqState* dl, uint8_t result) {
+    dl->failed = true;
+    dl->failure = result;
+    return false;
+}
+
+// 从失败的块继续
+void SIGMA_SEQ_RESUME(SigmaSeqState* dl) {
+    if (dl->failed) {
+        dl->failed = false;
+        dl->failure = SIGMA_SUCCESS;
+        dl->resumes++;
+    }
+}
+
+// 进入下一个条目，序列结束时记录轮询节省的时间（SIGMA_WAIT_SAVED_MS()）
+bool SIGMA_SEQ_ADVANCE(SigmaSeqState* dl) {
+    dl->sent = 0;
+    dl->waiting = false;
+    if (++dl->index < dl->count) {
+        return true;
+    }
+    g_sigma_wait_saved_ms = dl->savedMs;
+    SIGMA_TIMING_FINISH(SIGMA_TIMING_AUTO);
+    return false;
+}
+
+// ========== 稀疏序列：跳过零段 ==========
+// sigma_sequence_gen --sparse 把DM0/DM1写入中的长串零字拆成 SIGMA_SEQ_ZERO 条目。
+// 默认照常写入零（只省闪存）；DSP内存已知为零时整段跳过，总线上只传非零数据：
+//   SIGMA_ZERO_ASSUME  调用者保证内存为零，例如刚给DSP上电或拉过硬件复位脚、之后没有下载过
+//   SIGMA_ZERO_CHECK   执行到每个零条目时逐块读回（每步一块，不超过 SIGMA_ZERO_CHECK_BYTES），
+//                      全为零的一块跳过，否则下一步把这一块写零。每个字都核对过，但读回的总线
+//                      流量与写零相当，只在需要不改写已为零的内存时使用；省总线时间只能靠 ASSUME
+// MCU复位后重新下载、增量重载时DSP内存保留着旧内容，必须用默认的 SIGMA_ZERO_WRITE 或 SIGMA_ZERO_CHECK。
+#define SIGMA_ZERO_WRITE   0
+#define SIGMA_ZERO_ASSUME  1
+#define SIGMA_ZERO_CHECK   2
+
+void SIGMA_SEQ_SET_ZERO_MODE(SigmaSeqState* dl, uint8_t mode) {
+    dl->zeroMode = mode;
+}
+
+// 一个写入零的事务，长度不超过 Bus::chunkLength()
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_WRITE_ZEROS(uint32_t address, int length) {
+    return Bus::writeZeros(address, length);
+}
+
+#ifndef SIGMA_ZERO_CHECK_BYTES
+  #define SIGMA_ZERO_CHECK_BYTES 32    // SIGMA_ZERO_CHECK 每步读回的字节数（栈上缓冲区，4的倍数）
+#endif
+
+// 零条目的一步：整段跳过（SIGMA_ZERO_ASSUME）、读回一块（SIGMA_ZERO_CHECK），或写入一块零
+template <typename Bus>
+bool SIGMA_SEQ_STEP_ZERO(SigmaSeqState* dl, const SigmaSeqEntry* entry) {
+    if (dl->zeroMode == SIGMA_ZERO_ASSUME) {
+        dl->bytesSkipped += entry->length - dl->sent;
+        dl->bytesSent += entry->length - dl->sent;
+        return SIGMA_SEQ_ADVANCE(dl);
+    }
+    uint8_t result = SIGMA_PLAN_FLUSH<Bus>();
+    if (result != SIGMA_SUCCESS) {
+        return SIGMA_SEQ_FAIL(dl, result);
+    }
+    byte depth = getMemoryDepth(entry->address);
+    uint32_t address = entry->address + dl->sent / depth;
+    int chunk = SIGMA_SEQ_CHUNK<Bus>(dl, entry, address);
+    if (dl->zeroMode == SIGMA_ZERO_CHECK) {
+        // 读回的块和随后写零的块相同
+        chunk = chunk < SIGMA_ZERO_CHECK_BYTES ? chunk : SIGMA_ZERO_CHECK_BYTES;
+    }
+    if (dl->zeroMode == SIGMA_ZERO_CHECK && !dl->zeroStale) {
+        uint8_t data[SIGMA_ZERO_CHECK_BYTES];
+        result = Bus::read(address, data, chunk);
+        if (result != SIGMA_SUCCESS) {
+            return SIGMA_SEQ_FAIL(dl, result);
+        }
+        uint8_t bits = 0;
+        for (int i = 0; i < chunk; i++) {
+            bits |= data[i];
+        }
+        if (bits) {
+            dl->zeroStale = true;
+            return true;
+        }
+        dl->sent += chunk;
+        dl->bytesSkipped += chunk;
+        dl->bytesSent += chunk;
+        return dl->sent < entry->length || SIGMA_SEQ_ADVANCE(dl);
+    }
+    result = SIGMA_WRITE_ZEROS<Bus>(address, chunk);
+    if (result != SIGMA_SUCCESS) {
+        return SIGMA_SEQ_FAIL(dl, result);
+    }
+    dl->zeroStale = false;
+    dl->sent += chunk;
+    dl->bytesSent += chunk;
+    return dl->sent < entry->length || SIGMA_SEQ_ADVANCE(dl);
+}
+
+// 压缩条目的一步：解压一块并发送。有应答的传输失败时保留这一块，继续时原样重发
+template <typename Bus>
+bool SIGMA_SEQ_STEP_LZ(SigmaSeqState* dl, const SigmaSeqEntry* entry) {
+    SigmaLzState* lz = dl->lz;
+    if (!lz) {
+        return SIGMA_SEQ_FAIL(dl, SIGMA_ERROR_INVALID_PARAM);
+    }
+    uint8_t result = SIGMA_PLAN_FLUSH<Bus>();
+    if (result != SIGMA_SUCCESS) {
+        return SIGMA_SEQ_FAIL(dl, result);
+    }
+    if (lz->entry != dl->index) {
+        SIGMA_LZ_START(lz, dl->blob + entry->offset);
+        lz->entry = dl->index;
+    }
+    byte depth = getMemoryDepth(entry->address);
+    uint32_t address = entry->address + dl->sent / depth;
+    if (Bus::ACKED) {
+        int chunk = Bus::chunkLength(address, int(entry->length - dl->sent), entry->length, SIGMA_LZ_STAGE);
+        if (lz->staged == 0) {
+            SIGMA_LZ_READ(lz, lz->stage, chunk);
+            lz->staged = chunk;
+        }
+        result = Bus::write(address, lz->stage, chunk, false);
+        if (result != SIGMA_SUCCESS) {
+            return SIGMA_SEQ_FAIL(dl, result);
+        }
+        lz->staged = 0;
+        dl->sent += chunk;
+        dl->bytesSent += chunk;
+        return dl->sent < entry->length || SIGMA_SEQ_ADVANCE(dl);
+    }
+    int chunk = SIGMA_SEQ_CHUNK<Bus>(dl, entry, address);
+    result = SIGMA_WRITE_LZ_STREAM<Bus>(address, chunk, lz);
+    if (result != SIGMA_SUCCESS) {
+        return SIGMA_SEQ_FAIL(dl, result);
+    }
+    dl->sent += chunk;
+    dl->bytesSent += chunk;
+    return dl->sent < entry->length || SIGMA_SEQ_ADVANCE(dl);
+}
+
+// 执行一步，序列未结束且没有停在失败处时返回 true
+template <typename Bus = SigmaDefaultTransport>
+bool SIGMA_SEQ_STEP(SigmaSeqState* dl) {
+    if (SIGMA_SEQ_DONE(dl) || dl->failed) {
+        return false;
+    }
+    SIGMA_SELECT_DEVICE<Bus>(dl->devAddress);
+    SigmaSeqEntry entry;
+    memcpy_P(&entry, &dl->table[dl->index], sizeof(entry));
+    const uint8_t* pData = dl->blob + entry.offset;
+
+    if (!(dl->groups & SIGMA_GROUP_BIT(entry.group))) {
+        return SIGMA_SEQ_ADVANCE(dl);
+    }
+    if (entry.opcode != SIGMA_SEQ_DELAY) {
+        SIGMA_TIMING_PHASE<Bus>(entry.address);
+    }
+    if (entry.opcode == SIGMA_SEQ_WRITE_LZ) {
+        return SIGMA_SEQ_STEP_LZ<Bus>(dl, &entry);
+    }
+    if (entry.opcode == SIGMA_SEQ_ZERO) {
+        return SIGMA_SEQ_STEP_ZERO<Bus>(dl, &entry);
+    }
+    if (entry.opcode == SIGMA_SEQ_DELAY) {
+        uint32_t now = millis();
+        if (!dl->waiting) {
+            uint8_t result = SIGMA_PLAN_FLUSH<Bus>();    // 延迟是排序屏障
+            if (result != SIGMA_SUCCESS) {
+                return SIGMA_SEQ_FAIL(dl, result);
+            }
+            dl->waiting = true;
+            dl->waitStart = now;
+            dl->waitMs = SIGMA_DELAY_MS(entry.length, pData);
+            dl->nextPoll = now;
+            dl->statusAddress = SIGMA_READY_STATUS(dl->lastAddress, dl->lastValue, &dl->statusMask);
+            return true;
+        }
+        uint32_t elapsed = now - dl->waitStart;
+        if (dl->statusAddress) {
+            if (int32_t(now - dl->nextPoll) < 0) {
+                return true;
+            }
+            byte value[2];
+            if (SIGMA_READ_REGISTER_BYTES<Bus>(dl->statusAddress, 2, value) == SIGMA_SUCCESS &&
+                (uint16_t((value[0] << 8) | value[1]) & dl->statusMask) == 0x0001) {
+                if (elapsed < dl->waitMs) {
+                    dl->savedMs += dl->waitMs - elapsed;
+                }
+            }
+            else if (elapsed >= dl->waitMs) {
+                g_sigma_last_error = SIGMA_ERROR_DSP_TIMEOUT;
+                SIGMA_SEQ_RESULT(dl, SIGMA_ERROR_DSP_TIMEOUT);
+            }
+            else {
+                dl->nextPoll = now + SIGMA_POLL_INTERVAL_MS;
+                return true;
+            }
+        }
+        else if (elapsed < dl->waitMs) {
+            return true;
+        }
+        return SIGMA_SEQ_ADVANCE(dl);
+    }
+
+    if (dl->sent == 0 && entry.length == 2) {
+        dl->lastAddress = entry.address;
+        dl->lastValue = uint16_t((pgm_read_byte_near(pData) << 8) | pgm_read_byte_near(pData + 1));
+    }
+    if (SigmaPlanState<Bus>::active && dl->sent == 0 && entry.length <= Bus::PLAN_BYTES) {
+        uint8_t result = SIGMA_PLAN_WRITE<Bus>(entry.address, entry.length, pData);
+        if (result != SIGMA_SUCCESS) {
+            return SIGMA_SEQ_FAIL(dl, result);
+        }
+        dl->sent = entry.length;
+        dl->bytesSent += entry.length;
+    }
+    else {
+        uint8_t result = SIGMA_PLAN_FLUSH<Bus>();
+        if (result != SIGMA_SUCCESS) {
+            return SIGMA_SEQ_FAIL(dl, result);
+        }
+        byte depth = getMemoryDepth(entry.address);
+        uint32_t address = entry.address + dl->sent / depth;
+        int chunk = SIGMA_SEQ_CHUNK<Bus>(dl, &entry, address);
+        result = SIGMA_WRITE_DIRECT<Bus>(int(address), chunk, pData + dl->sent, true);
+        if (result != SIGMA_SUCCESS) {
+            return SIGMA_SEQ_FAIL(dl, result);
+        }
+        dl->sent += chunk;
+        dl->bytesSent += chunk;
+    }
+    return dl->sent < entry.length || SIGMA_SEQ_ADVANCE(dl);
+}
+
+// 阻塞执行到序列结束或停在失败的块上。停止时返回导致停止的错误，
+// 之后可以 SIGMA_SEQ_RESUME() 再调用一次；正常结束时返回第一个错误（如轮询超时）
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_SEQ_RUN(SigmaSeqState* dl) {
+    dl->stepBytes = SIGMA_STEP_UNLIMITED;    // 阻塞执行时SPI每个条目一次发送
+    while (SIGMA_SEQ_STEP<Bus>(dl)) {
+        uint32_t waitMs = SIGMA_SEQ_WAIT_MS(dl);
+        if (waitMs) {
+            delay(waitMs);
+        }
+    }
+    return dl->failed ? dl->failure : dl->error;
+}
+
+// 阻塞执行整个序列，table 和 blob 都位于闪存。
+// 需要从失败处继续时改用 SIGMA_SEQ_START() + SIGMA_SEQ_RUN()。zeroMode 见 SIGMA_SEQ_SET_ZERO_MODE()
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_RUN_SEQUENCE(byte devAddress, const SigmaSeqEntry table[], int count, const uint8_t blob[],
+                           uint8_t zeroMode = SIGMA_ZERO_WRITE) {
+    SigmaSeqState dl;
+    SIGMA_SEQ_START(&dl, devAddress, table, count, blob);
+    SIGMA_SEQ_SET_ZERO_MODE(&dl, zeroMode);
+    return SIGMA_SEQ_RUN<Bus>(&dl);
+}
+
+// ========== 多DSP：并行下载 ==========
+// 每片DSP在自己的总线上（两个I2C控制器，或I2C加SPI）时，依次下载的启动时间是各片之和。
+// 并行下载把各片的序列交替推进：轮流让每片做一步（SIGMA_SEQ_STEP()），一片在复位、
+// PLL锁定等延迟中等待时其他各片照常发送，只有所有各片都在等待时才调用 delay()。
+// 总线传输本身仍是阻塞的，各片的延迟互相重叠，总时间接近最慢的一片加上其他各片的线上时间：
+//
+//   typedef SigmaI2cTransport<DSP_I2C_ADDR, &Wire> LeftBus;
+//   typedef SigmaI2cTransport<DSP_I2C_ADDR, &Wire1> RightBus;
+//   LeftBus::begin();
+//   RightBus::begin();
+//   SigmaSeqState left, right;
+//   SIGMA_SEQ_START(&left, DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1);
+//   SIGMA_SEQ_START(&right, DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1);
+//   SigmaParallel boot;
+//   SIGMA_PARALLEL_BEGIN(&boot);
+//   SIGMA_PARALLEL_ADD<LeftBus>(&boot, &left);
+//   SIGMA_PARALLEL_ADD<RightBus>(&boot, &right);
+//   uint8_t result = SIGMA_PARALLEL_RUN(&boot);    // 各片的结果在 left.error/left.failed 等
+//
+// 一片失败（dl.failed）时其他各片继续下载，SIGMA_SEQ_RESUME() 之后可以再次运行。
+// 同一条总线上的几片DSP（见"多DSP：设备表"）也可以加入，但只有延迟能够重叠。
+// 需要在下载期间做别的事时，在 loop() 中调用 SIGMA_PARALLEL_STEP() 代替 SIGMA_PARALLEL_RUN()。
+#ifndef SIGMA_PARALLEL_MAX
+  #define SIGMA_PARALLEL_MAX 4    // 一次并行下载最多的DSP数
+#endif
+
+struct SigmaParallel {
+    SigmaSeqState* dl[SIGMA_PARALLEL_MAX];
+    bool (*step[SIGMA_PARALLEL_MAX])(SigmaSeqState*);    // 各片传输的 SIGMA_SEQ_STEP<Bus>
+    uint8_t count;
+};
+
+void SIGMA_PARALLEL_BEGIN(SigmaParallel* p) {
+    memset(p, 0, sizeof(*p));
+}
+
+// 加入一片DSP，dl 已由 SIGMA_SEQ_START() 准备好。已满时返回 false
+template <typename Bus = SigmaDefaultTransport>
+bool SIGMA_PARALLEL_ADD(SigmaParallel* p, SigmaSeqState* dl) {
+    if (p->count >= SIGMA_PARALLEL_MAX) {
+        g_sigma_last_error = SIGMA_ERROR_INVALID_PARAM;
+        return false;
+    }
+    p->dl[p->count] = dl;
+    p->step[p->count] = &SIGMA_SEQ_STEP<Bus>;
+    p->count++;
+    return true;
+}
+
+// 每片做一步，还有没结束也没停在失败处的DSP时返回 true
+bool SIGMA_PARALLEL_STEP(SigmaParallel* p) {
+    bool running = false;
+    for (uint8_t i = 0; i < p->count; i++) {
+        running = p->step[i](p->dl[i]) || running;
+    }
+    return running;
+}
+
+// 距离某一片有事可做还有多少毫秒
+uint32_t SIGMA_PARALLEL_WAIT_MS(const SigmaParallel* p) {
+    uint32_t waitMs = 0xFFFFFFFFUL;
+    for (uint8_t i = 0; i < p->count; i++) {
+        const SigmaSeqState* dl = p->dl[i];
+        if (!SIGMA_SEQ_DONE(dl) && !dl->failed) {
+            uint32_t ms = SIGMA_SEQ_WAIT_MS(dl);
+            waitMs = ms < waitMs ? ms : waitMs;
+        }
+    }
+    return waitMs == 0xFFFFFFFFUL ? 0 : waitMs;
+}
+
+// 阻塞执行到各片都结束或停在失败处，返回按加入顺序第一片的错误（同 SIGMA_SEQ_RUN()）
+uint8_t SIGMA_PARALLEL_RUN(SigmaParallel* p) {
+    while (SIGMA_PARALLEL_STEP(p)) {
+        uint32_t waitMs = SIGMA_PARALLEL_WAIT_MS(p);
+        if (waitMs) {
+            delay(waitMs);
+        }
+    }
+    for (uint8_t i = 0; i < p->count; i++) {
+        uint8_t result = p->dl[i]->failed ? p->dl[i]->failure : p->dl[i]->error;
+        if (result != SIGMA_SUCCESS) {
+            return result;
+        }
+    }
+    return SIGMA_SUCCESS;
+}
+
+// 回放 TxBuffer_IC_x.dat/NumBytes_IC_x.dat 格式的序列（均位于闪存）：
+//   ADI_REG_TYPE TxBuffer_IC_1[] = {
+//   #include "TxBuffer_IC_1.dat"
+//   };
+//   ADI_DATA_U16 NumBytes_IC_1[] = {
+//   #include "NumBytes_IC_1.dat"
+//   };
+//   SIGMA_RUN_TXBUFFER(DEVICE_ADDR_IC_1, TxBuffer_IC_1, NumBytes_IC_1, sizeof(NumBytes_IC_1) / 2);
+// 每个事务为2字节大端地址加数据，NumBytes 中的长度含地址。导出文件不单独标记延迟，
+// 这里把"地址0、数据2字节"识别为延迟：DM0的字宽是4字节，2字节写入不可能是有效的内存写入。
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_RUN_TXBUFFER(byte devAddress, const uint8_t txBuffer[], const uint16_t numBytes[], int count) {
+    SIGMA_SELECT_DEVICE<Bus>(devAddress);
+    uint8_t first = SIGMA_SUCCESS;
+    uint16_t lastAddress = 0;
+    uint16_t lastValue = 0;
+    uint32_t pos = 0;
+    g_sigma_wait_saved_ms = 0;
+    for (int i = 0; i < count; i++) {
+        uint16_t size = pgm_read_word_near(numBytes + i);
+        if (size < 2) {
+            if (first == SIGMA_SUCCESS) {
+                first = SIGMA_ERROR_INVALID_PARAM;
+            }
+            break;
+        }
+        uint16_t address = uint16_t((pgm_read_byte_near(txBuffer + pos) << 8) | pgm_read_byte_near(txBuffer + pos + 1));
+        const uint8_t* pData = txBuffer + pos + 2;
+        int length = size - 2;
+        pos += size;
+        uint8_t result = SIGMA_SUCCESS;
+
+        if (address == 0 && length == 2 && getMemoryDepth(0) != 2) {
+            result = SIGMA_WAIT_READY<Bus>(devAddress, lastAddress, lastValue, length, pData);
+        }
+        else if (length == 0) {
+            continue;
+        }
+        else {
+            if (length == 2) {
+                lastAddress = address;
+                lastValue = uint16_t((pgm_read_byte_near(pData) << 8) | pgm_read_byte_near(pData + 1));
+            }
+            if (SigmaPlanState<Bus>::active) {
+                result = SIGMA_PLAN_WRITE<Bus>(address, length, pData);
+            }
+            else {
+                result = SIGMA_WRITE_DIRECT<Bus>(address, length, pData, true);
+            }
+        }
+        if (result != SIGMA_SUCCESS && first == SIGMA_SUCCESS) {
+            first = result;
+        }
+    }
+    return first;
+}
+
+
+// SAFELOAD 宏定义映射
+#ifndef SAFELOAD_DATA_ADDR
+  #ifdef MOD_SAFELOADMODULE_DATA_SAFELOAD0_ADDR
+    #define SAFELOAD_DATA_ADDR MOD_SAFELOADMODULE_DATA_SAFELOAD0_ADDR
+  #else
+    #define SAFELOAD_DATA_ADDR 24576  // 默认值
+  #endif
+#endif
+
+#ifndef SAFELOAD_ADDR_ADDR
+  #ifdef MOD_SAFELOADMODULE_ADDRESS_SAFELOAD_ADDR
+    #define SAFELOAD_ADDR_ADDR MOD_SAFELOADMODULE_ADDRESS_SAFELOAD_ADDR
+  #else
+    #define SAFELOAD_ADDR_ADDR 24581  // 默认值
+  #endif
+#endif
+
+#ifndef SAFELOAD_SLOTS_ADDR
+  #ifdef MOD_SAFELOADMODULE_NUM_SAFELOAD_ADDR
+    #define SAFELOAD_SLOTS_ADDR MOD_SAFELOADMODULE_NUM_SAFELOAD_ADDR
+  #else
+    #define SAFELOAD_SLOTS_ADDR 24582  // 默认值
+  #endif
+#endif
+
+// SAFELOAD slots 数据数组
+#ifndef SAFELOAD_SLOTS_DATA_1
+  static const uint8_t SAFELOAD_SLOTS_DATA_1[] = {1, 1, 1, 1, 1};  // 默认值数组
+#endif
+
+void SIGMA_WRITE_SAFELOAD_REGISTER_BLOCK(int address, int length, uint8_t pData[]){
+  SIGMA_WRITE_REGISTER_BLOCK(SIGMA_CURRENT_DEVICE, SAFELOAD_DATA_ADDR, length, pData);
+  SIGMA_WRITE_REGISTER_INTEGER(SAFELOAD_ADDR_ADDR, address);
+  SIGMA_WRITE_REGISTER_BLOCK(SIGMA_CURRENT_DEVICE, SAFELOAD_SLOTS_ADDR, length, SAFELOAD_SLOTS_DATA_1);
+}
+
+void SIGMA_WRITE_SAFELOAD_REGISTER_BLOCK(int address, int length, const uint8_t pData[], int addrOffset){
+  SIGMA_WRITE_REGISTER_BLOCK(SIGMA_CURRENT_DEVICE, SAFELOAD_DATA_ADDR, length, pData, addrOffset);
+  SIGMA_WRITE_REGISTER_INTEGER(SAFELOAD_ADDR_ADDR, address);
+  SIGMA_WRITE_REGISTER_BLOCK(SIGMA_CURRENT_DEVICE, SAFELOAD_SLOTS_ADDR, length, SAFELOAD_SLOTS_DATA_1);
+}
+
+// ========== 优化的读取函数 ==========
+template <typename Bus>
+uint8_t SIGMA_READ_REGISTER_BYTES(int address, int length, byte* pData) {
+    // 参数验证
+    if (length <= 0 || !pData) {
+        g_sigma_last_error = SIGMA_ERROR_INVALID_PARAM;
+        return g_sigma_last_error;
+    }
+    
+    g_sigma_last_error = SIGMA_SUCCESS;
+    SIGMA_PLAN_FLUSH<Bus>();    // 先发出计划器中待发的写入
+    return Bus::read(uint32_t(address), pData, length);
+}
+
+template <typename Bus = SigmaDefaultTransport>
+int32_t SIGMA_READ_REGISTER_INTEGER(int address, int length) {
+    if (length > 4) {
+        g_sigma_last_error = SIGMA_ERROR_INVALID_PARAM;
+        return 0;
+    }
+    
+    byte register_value[4] = {0};
+    if (SIGMA_READ_REGISTER_BYTES<Bus>(address, length, register_value) != SIGMA_SUCCESS) {
+        return 0;
+    }
+    
+    int32_t result = 0;
+    for (int i = 0; i < length; i++) {
+        result = (result << 8) + register_value[i];
+    }
+    return result;
+}
+
+template <typename Bus = SigmaDefaultTransport>
+double SIGMA_READ_REGISTER_FLOAT(int address) {
+    int32_t integer_val = SIGMA_READ_REGISTER_INTEGER<Bus>(address, 4);
+    if (g_sigma_last_error != SIGMA_SUCCESS) {
+        return 0.0;
+    }
+    
+#if DSP_TYPE == DSP_TYPE_SIGMA300_350
+    return double(integer_val) / (1 << 23);
+#else
+    return double(integer_val) / (1 << 23);
+#endif
+}
+
+// 指定设备
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_READ_REGISTER_BYTES(byte devAddress, int address, int length, byte* pData) {
+    SIGMA_SELECT_DEVICE<Bus>(devAddress);
+    return SIGMA_READ_REGISTER_BYTES<Bus>(address, length, pData);
+}
+
+template <typename Bus = SigmaDefaultTransport>
+int32_t SIGMA_READ_REGISTER_INTEGER(byte devAddress, int address, int length) {
+    SIGMA_SELECT_DEVICE<Bus>(devAddress);
+    return SIGMA_READ_REGISTER_INTEGER<Bus>(address, length);
+}
+
+template <typename Bus = SigmaDefaultTransport>
+double SIGMA_READ_REGISTER_FLOAT(byte devAddress, int address) {
+    SIGMA_SELECT_DEVICE<Bus>(devAddress);
+    return SIGMA_READ_REGISTER_FLOAT<Bus>(address);
+}
+
+// 便利函数：安全读取参数
+bool SIGMA_READ_PARAM_SAFE(int address, double* value) {
+    if (!value) {
+        g_sigma_last_error = SIGMA_ERROR_INVALID_PARAM;
+        return false;
+    }
+    
+    *value = SIGMA_READ_REGISTER_FLOAT(address);
+    if (g_sigma_last_error != SIGMA_SUCCESS) {
+        SIGMA_DEBUG_PRINT("参数读取失败，地址: 0x");
+        SIGMA_DEBUG_PRINT_HEX(address);
+        SIGMA_DEBUG_PRINT(", 错误: ");
+        SIGMA_DEBUG_PRINTLN(g_sigma_last_error);
+        return false;
+    }
+    return true;
+}
+
+// ========== 读回校验 ==========
+// 下载后按最大突发读回程序、参数和DM1内存，逐段计算CRC32并与序列头文件中
+// 构建时算好的值（Sections_IC_x，由 host/sigma_sequence_gen 生成）比较：
+//
+//   sequence_download_IC_1();
+//   if (SIGMA_VERIFY_SECTIONS(DEVICE_ADDR_IC_1, Sections_IC_1, SECTION_COUNT_IC_1) != SIGMA_SUCCESS) ...
+//
+// 只读回一遍、不保存数据，RAM开销是一个 SIGMA_VERIFY_BUFFER_BYTES 的栈缓冲区。
+// I2C默认一次读满Wire接收缓冲区（一个突发），SPI默认每次读256字节。
+#ifndef SIGMA_VERIFY_BUFFER_BYTES
+  #if USE_SPI
+    #define SIGMA_VERIFY_BUFFER_BYTES 256
+  #else
+    #define SIGMA_VERIFY_BUFFER_BYTES SIGMA_I2C_BUFFER_SIZE
+  #endif
+#endif
+
+// CRC32（IEEE 802.3，反射多项式 0xEDB88320），与 zlib 的 crc32() 相同，
+// 可以分段累加：crc = SIGMA_CRC32(crc, data, length)，初值为0
+uint32_t SIGMA_CRC32(uint32_t crc, const uint8_t* data, int length) {
+    crc = ~crc;
+    for (int i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+// 读回一段内存并计算CRC32
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_READ_CRC32(uint16_t address, uint16_t length, uint32_t* crc) {
+    byte buffer[SIGMA_VERIFY_BUFFER_BYTES];
+    byte depth = getMemoryDepth(address);
+    int step = (SIGMA_VERIFY_BUFFER_BYTES / depth) * depth;
+    uint32_t currentAddr = address;
+    uint32_t value = 0;
+    for (int currentByte = 0; currentByte < length; currentByte += step) {
+        int chunk = SIGMA_MIN_LENGTH(length - currentByte, step);
+        if (SIGMA_READ_REGISTER_BYTES<Bus>(int(currentAddr), chunk, buffer) != SIGMA_SUCCESS) {
+            return g_sigma_last_error;
+        }
+        value = SIGMA_CRC32(value, buffer, chunk);
+        currentAddr += chunk / depth;
+    }
+    *crc = value;
+    return SIGMA_SUCCESS;
+}
+
+// 逐段校验，sections 位于闪存。第一个不符的段号写入 *failed（没有则为 -1），
+// 总线错误时返回该错误，CRC不符时返回 SIGMA_ERROR_VERIFY
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_VERIFY_SECTIONS(byte devAddress, const SigmaSeqSection sections[], int count, int* failed = nullptr) {
+    SIGMA_SELECT_DEVICE<Bus>(devAddress);
+    if (failed) {
+        *failed = -1;
+    }
+    for (int i = 0; i < count; i++) {
+        SigmaSeqSection section;
+        memcpy_P(&section, &sections[i], sizeof(section));
+        uint32_t crc = 0;
+        if (SIGMA_READ_CRC32<Bus>(section.address, section.length, &crc) != SIGMA_SUCCESS || crc != section.crc) {
+            if (failed) {
+                *failed = i;
+            }
+            if (g_sigma_last_error == SIGMA_SUCCESS) {
+                g_sigma_last_error = SIGMA_ERROR_VERIFY;
+            }
+            SIGMA_DEBUG_PRINT("校验失败，地址: 0x");
+            SIGMA_DEBUG_PRINT_HEX(section.address);
+            SIGMA_DEBUG_PRINT(", CRC: 0x");
+            SIGMA_DEBUG_PRINT_HEX(crc);
+            SIGMA_DEBUG_PRINTLN("");
+            return g_sigma_last_error;
+        }
+    }
+    return SIGMA_SUCCESS;
+}
+
+// ========== 热启动 ==========
+// MCU复位但DSP没有掉电时，DSP仍在运行上一次下载的镜像，不必重新下载。
+// 判断条件（全部满足才跳过）：CORE_STATUS 为运行，签名字等于镜像CRC32，
+// 抽样的程序字与导出数据一致。检查只需十次左右的短读取，而完整下载需要
+// 数百个事务加上约0.5秒的复位/PLL等待：
+//
+//   SIGMA_BOOT_SEQUENCE(DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1, &Signature_IC_1);
+//
+// 签名字 SIGNATURE_ADDR_IC_n 位于导出的DM1数据之后（由 host/sigma_sequence_gen 选择）。DSP程序
+// 必须不用它：程序用到的数据内存都要在导出的段里（SigmaStudio 连滤波器状态一起导出），
+// 重新导出后段覆盖了签名字时 _SEQ.h 编译报错，需重新生成。
+// SOFT_RESET 不清除数据内存，所以下载前先把签名字清零，下载成功后再写入。
+static bool g_sigma_warm_boot = false;
+
+// DSP是否正在运行 signature 描述的镜像，signature 位于闪存
+template <typename Bus = SigmaDefaultTransport>
+bool SIGMA_WARM_BOOT_MATCH(byte devAddress, const SigmaSignature* signature) {
+    SIGMA_SELECT_DEVICE<Bus>(devAddress);
+    SigmaSignature sig;
+    memcpy_P(&sig, signature, sizeof(sig));
+
+    uint8_t savedError = g_sigma_last_error;
+    bool match = (SIGMA_READ_REGISTER_INTEGER<Bus>(SIGMA_REG_CORE_STATUS, 2) & 0x0007) == 0x0001 &&
+                 uint32_t(SIGMA_READ_REGISTER_INTEGER<Bus>(sig.address, 4)) == sig.value;
+    for (int i = 0; match && i < SIGMA_SIGNATURE_SAMPLES; i++) {
+        match = uint32_t(SIGMA_READ_REGISTER_INTEGER<Bus>(sig.sampleAddress[i], 4)) == sig.sampleValue[i];
+    }
+    match = match && g_sigma_last_error == SIGMA_SUCCESS;
+    g_sigma_last_error = savedError;    // 读不到（DSP未上电）只表示需要下载
+    return match;
+}
+
+// 写入（或用 value = 0 清除）签名字
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_WRITE_SIGNATURE(byte devAddress, const SigmaSignature* signature, uint32_t value) {
+    SigmaSignature sig;
+    memcpy_P(&sig, signature, sizeof(sig));
+    byte data[4] = {byte(value >> 24), byte(value >> 16), byte(value >> 8), byte(value)};
+    return SIGMA_WRITE_REGISTER_BLOCK<Bus>(devAddress, int(sig.address), 4, data);
+}
+
+// 上一次 SIGMA_BOOT_SEQUENCE() 是否因热启动跳过了下载
+bool SIGMA_WAS_WARM_BOOT() {
+    return g_sigma_warm_boot;
+}
+
+// DSP已在运行同一镜像时直接返回，否则执行下载序列并在成功后写入签名
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_BOOT_SEQUENCE(byte devAddress, const SigmaSeqEntry table[], int count, const uint8_t blob[],
+                            const SigmaSignature* signature) {
+    g_sigma_warm_boot = SIGMA_WARM_BOOT_MATCH<Bus>(devAddress, signature);
+    if (g_sigma_warm_boot) {
+        return SIGMA_SUCCESS;
+    }
+    // 下载中途失败时不能留下旧签名；DSP没有应答时这次写入失败，不影响下载
+    SIGMA_WRITE_SIGNATURE<Bus>(devAddress, signature, 0);
+    uint8_t result = SIGMA_RUN_SEQUENCE<Bus>(devAddress, table, count, blob);
+    if (result == SIGMA_SUCCESS) {
+        SigmaSignature sig;
+        memcpy_P(&sig, signature, sizeof(sig));
+        result = SIGMA_WRITE_SIGNATURE<Bus>(devAddress, signature, sig.value);
+    }
+    return result;
+}
+
+// 自启动：SELFBOOT 引脚为高时DSP上电后自己从EEPROM加载镜像（工程中的 IC 2 "E2Prom"，
+// 由 SigmaStudio 写入），MCU不下载，只等内核运行起来。自启动期间读不到状态不算错误；
+// 超时（EEPROM为空、损坏或 SELFBOOT 为低）返回 SIGMA_ERROR_DSP_TIMEOUT
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_WAIT_SELF_BOOT(byte devAddress, uint32_t timeoutMs = 1000) {
+    SIGMA_SELECT_DEVICE<Bus>(devAddress);
+    uint8_t savedError = g_sigma_last_error;
+    uint8_t result = SIGMA_POLL_REGISTER<Bus>(SIGMA_REG_CORE_STATUS, 0x0007, 0x0001, timeoutMs);
+    g_sigma_last_error = result == SIGMA_SUCCESS ? savedError : result;
+    return result;
+}
+
+// ========== 增量重载 ==========
+// 只改了参数的固件更新也会重新下载6720字节的程序和所有寄存器。这里把上一次
+// 成功加载的镜像的各组哈希（序列头文件中的 GroupHash_IC_x）存进MCU的EEPROM，
+// 启动时：
+//   - DSP已在运行新镜像（签名匹配）：什么都不写，同 SIGMA_BOOT_SEQUENCE()；
+//   - DSP仍在运行EEPROM中记录的旧镜像，且程序和时钟组都没变：只重写哈希
+//     不同的组，不复位、不停止内核；
+//   - 其他情况（没有记录、DSP掉过电、程序或时钟变化）：完整下载。
+//
+//   SIGMA_BOOT_INCREMENTAL(DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1,
+//                          &Signature_IC_1, GroupHash_IC_1);
+//
+// 没有EEPROM库的平台（如SAMD）SIGMA_USE_EEPROM 默认为 false，此时总是完整下载。
+#ifndef SIGMA_USE_EEPROM
+  #if SIGMA_PLATFORM == SIGMA_PLATFORM_SAMD || SIGMA_PLATFORM == SIGMA_PLATFORM_GENERIC
+    #define SIGMA_USE_EEPROM false
+  #else
+    #define SIGMA_USE_EEPROM true
+  #endif
+#endif
+
+#ifndef SIGMA_NV_ADDR
+  #define SIGMA_NV_ADDR 0    // 记录在EEPROM中的起始地址
+#endif
+
+#if SIGMA_USE_EEPROM
+#include <EEPROM.h>
+#endif
+
+#define SIGMA_NV_MAGIC 0x53494731UL    // "SIG1"
+#define SIGMA_CLOCK_MAGIC 0x434C4B31UL    // "CLK1"
+
+struct SigmaNvRecord {
+    uint32_t magic;
+    uint32_t image;                        // 镜像签名（SigmaSignature::value）
+    uint32_t hash[SIGMA_GROUP_COUNT];      // 各组哈希
+};
+
+// SIGMA_QUALIFY_CLOCK() 选中的时钟（见"总线时钟鉴定"）
+struct SigmaClockRecord {
+    uint32_t magic;
+    uint32_t clock;
+};
+
+// 每个设备一份增量重载记录和时钟记录，按设备表中的位置依次存放
+#define SIGMA_NV_SLOT_BYTES (sizeof(SigmaNvRecord) + sizeof(SigmaClockRecord))
+#define SIGMA_NV_END        (SIGMA_NV_ADDR + SIGMA_MAX_DEVICES * SIGMA_NV_SLOT_BYTES)
+
+// 当前设备的记录在EEPROM中的地址，没有记录位置时为 -1（不读也不写EEPROM）
+int SIGMA_NV_SLOT() {
+    int index = SIGMA_DEVICE_INDEX();
+    return index == SIGMA_NO_DEVICE_INDEX ? -1 : SIGMA_NV_ADDR + index * int(SIGMA_NV_SLOT_BYTES);
+}
+
+#define SIGMA_BOOT_MODE_COLD         0    // 完整下载
+#define SIGMA_BOOT_MODE_WARM         1    // DSP已在运行同一镜像，没有写入
+#define SIGMA_BOOT_MODE_INCREMENTAL  2    // 只重写了变化的组
+
+static uint8_t g_sigma_boot_mode = SIGMA_BOOT_MODE_COLD;
+static uint8_t g_sigma_boot_groups = 0;
+
+bool SIGMA_NV_LOAD(SigmaNvRecord* record) {
+#if SIGMA_USE_EEPROM
+    if (SIGMA_NV_SLOT() < 0) {
+        return false;
+    }
+  #if SIGMA_PLATFORM == SIGMA_PLATFORM_ESP32 || SIGMA_PLATFORM == SIGMA_PLATFORM_ESP8266
+    EEPROM.begin(SIGMA_NV_END);
+  #endif
+    EEPROM.get(SIGMA_NV_SLOT(), *record);
+    return record->magic == SIGMA_NV_MAGIC;
+#else
+    (void)record;
+    return false;
+#endif
+}
+
+void SIGMA_NV_STORE(const SigmaNvRecord* record) {
+#if SIGMA_USE_EEPROM
+    if (SIGMA_NV_SLOT() < 0) {
+        return;
     }
+    EEPROM.put(SIGMA_NV_SLOT(), *record);    // 只写入变化的字节
+  #if SIGMA_PLATFORM == SIGMA_PLATFORM_ESP32 || SIGMA_PLATFORM == SIGMA_PLATFORM_ESP8266
+    EEPROM.commit();
+  #endif
+#else
+    (void)record;
 #endif
 }
 
-void SIGMA_WRITE_REGISTER_BLOCK(byte devAddress, int address, int length, const uint8_t pData[]) {
-  SIGMA_WRITE_REGISTER_BLOCK(devAddress, address, length, pData, 0);
+// 上一次 SIGMA_BOOT_INCREMENTAL() 的方式（SIGMA_BOOT_MODE_*）和重写的组
+uint8_t SIGMA_BOOT_MODE() {
+    return g_sigma_boot_mode;
 }
 
-// 不带地址的替代函数调用（单DSP系统）
-void SIGMA_WRITE_REGISTER_BLOCK(int address, int length, byte pData[]) {
-    SIGMA_WRITE_REGISTER_BLOCK(DSP_I2C_ADDR, address, length, pData);
+uint8_t SIGMA_BOOT_GROUPS() {
+    return g_sigma_boot_groups;
 }
 
+// hashes 为 SIGMA_GROUP_COUNT 个组哈希，与 signature 一样位于闪存
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_BOOT_INCREMENTAL(byte devAddress, const SigmaSeqEntry table[], int count, const uint8_t blob[],
+                               const SigmaSignature* signature, const uint32_t hashes[]) {
+    SIGMA_SELECT_DEVICE<Bus>(devAddress);    // 记录按设备分开
+    SigmaNvRecord current;
+    SigmaSignature sig;
+    memcpy_P(&sig, signature, sizeof(sig));
+    current.magic = SIGMA_NV_MAGIC;
+    current.image = sig.value;
+    memcpy_P(current.hash, hashes, sizeof(current.hash));
 
+    SigmaNvRecord stored;
+    bool haveRecord = SIGMA_NV_LOAD(&stored);
 
-// ========== 优化的整数和浮点写入函数 ==========
-uint8_t SIGMA_WRITE_REGISTER_INTEGER(int address, int32_t pData) {
-    byte byte_data[4];
-    SIGMASTUDIOTYPE_REGISTER_CONVERT(pData, byte_data);
-    return SIGMA_WRITE_REGISTER_BLOCK(DSP_I2C_ADDR, address, 4, byte_data);
+    if (SIGMA_WARM_BOOT_MATCH<Bus>(devAddress, signature)) {
+        g_sigma_warm_boot = true;
+        g_sigma_boot_mode = SIGMA_BOOT_MODE_WARM;
+        g_sigma_boot_groups = 0;
+        if (!haveRecord || memcmp(&stored, &current, sizeof(current)) != 0) {
+            SIGMA_NV_STORE(&current);
+        }
+        return SIGMA_SUCCESS;
+    }
+    g_sigma_warm_boot = false;
+
+    uint8_t groups = SIGMA_GROUP_ALL;
+    if (haveRecord) {
+        // DSP仍在运行记录中的镜像：内核在运行且签名字等于记录的签名
+        uint8_t savedError = g_sigma_last_error;
+        bool running = (SIGMA_READ_REGISTER_INTEGER<Bus>(SIGMA_REG_CORE_STATUS, 2) & 0x0007) == 0x0001 &&
+                       uint32_t(SIGMA_READ_REGISTER_INTEGER<Bus>(sig.address, 4)) == stored.image &&
+                       g_sigma_last_error == SIGMA_SUCCESS;
+        g_sigma_last_error = savedError;
+
+        uint8_t changed = 0;
+        for (int g = 0; g < SIGMA_GROUP_COUNT; g++) {
+            if (stored.hash[g] != current.hash[g]) {
+                changed |= SIGMA_GROUP_BIT(g);
+            }
+        }
+        changed &= uint8_t(~SIGMA_GROUP_BIT(SIGMA_GROUP_CONTROL));
+        // 哈希都相同却没有通过热启动检查，说明DSP内容与记录不符，完整下载
+        if (running && changed &&
+            !(changed & (SIGMA_GROUP_BIT(SIGMA_GROUP_PROGRAM) | SIGMA_GROUP_BIT(SIGMA_GROUP_CLOCK)))) {
+            groups = changed;
+        }
+    }
+    g_sigma_boot_mode = groups == SIGMA_GROUP_ALL ? SIGMA_BOOT_MODE_COLD : SIGMA_BOOT_MODE_INCREMENTAL;
+    g_sigma_boot_groups = groups;
+
+    // 签名字先清零，中途失败时下次启动不会误认为新镜像已加载
+    SIGMA_WRITE_SIGNATURE<Bus>(devAddress, signature, 0);
+    SigmaSeqState dl;
+    SIGMA_SEQ_START(&dl, devAddress, table, count, blob, groups);
+    uint8_t result = SIGMA_SEQ_RUN<Bus>(&dl);
+    if (result == SIGMA_SUCCESS) {
+        result = SIGMA_WRITE_SIGNATURE<Bus>(devAddress, signature, sig.value);
+    }
+    if (result == SIGMA_SUCCESS) {
+        SIGMA_NV_STORE(&current);
+    }
+    return result;
 }
 
-uint8_t SIGMA_WRITE_REGISTER_FLOAT(int address, double pData) {
-    return SIGMA_WRITE_REGISTER_INTEGER(address, SIGMASTUDIOTYPE_FIXPOINT_CONVERT(pData));
+// ========== 多DSP：切换设备 ==========
+// 当前设备的状态在全局变量中（各函数直接使用它们），切换时存回设备表并换成另一个设备的
+static void SIGMA_DEVICE_SAVE() {
+    g_sigma_device->lastError = g_sigma_last_error;
+    g_sigma_device->retries = g_sigma_retries;
+    g_sigma_device->retryFailures = g_sigma_retry_failures;
+    g_sigma_device->warmBoot = g_sigma_warm_boot;
+    g_sigma_device->bootMode = g_sigma_boot_mode;
+    g_sigma_device->bootGroups = g_sigma_boot_groups;
 }
 
-// 便利函数：带错误检查的参数写入
-bool SIGMA_WRITE_PARAM_SAFE(int address, double value) {
-    uint8_t result = SIGMA_WRITE_REGISTER_FLOAT(address, value);
-    if (result != SIGMA_SUCCESS) {
-        SIGMA_DEBUG_PRINT("参数写入失败，地址: 0x");
-        SIGMA_DEBUG_PRINT_HEX(address);
-        SIGMA_DEBUG_PRINT(", 错误: ");
-        SIGMA_DEBUG_PRINTLN(result);
-        return false;
-    }
-    return true;
+static void SIGMA_DEVICE_LOAD() {
+    g_sigma_last_error = g_sigma_device->lastError;
+    g_sigma_retries = g_sigma_device->retries;
+    g_sigma_retry_failures = g_sigma_device->retryFailures;
+    g_sigma_warm_boot = g_sigma_device->warmBoot;
+    g_sigma_boot_mode = g_sigma_device->bootMode;
+    g_sigma_boot_groups = g_sigma_device->bootGroups;
 }
 
-// 便利函数：批量参数写入
-bool SIGMA_WRITE_PARAMS_SAFE(int startAddress, double values[], int count) {
-    for (int i = 0; i < count; i++) {
-        if (!SIGMA_WRITE_PARAM_SAFE(startAddress + i, values[i])) {
-            return false;
+// 登记一个DSP。devAddress 为导出文件中的设备地址，i2cAddress 为7位I2C地址；
+// 设备的总线时钟取 Bus 当前的时钟。设备表已满时返回 nullptr
+template <typename Bus = SigmaDefaultTransport>
+SigmaDevice* SIGMA_ADD_DEVICE(byte devAddress, uint8_t i2cAddress) {
+    SigmaDevice* device = SIGMA_FIND_DEVICE(devAddress);
+    if (!device) {
+        if (g_sigma_device_count >= SIGMA_MAX_DEVICES) {
+            g_sigma_last_error = SIGMA_ERROR_INVALID_PARAM;
+            return nullptr;
         }
+        device = &g_sigma_devices[g_sigma_device_count++];
+        *device = SigmaDevice();
+        device->devAddress = devAddress;
     }
-    return true;
+    device->i2cAddress = i2cAddress;
+    device->clock = Bus::clock();
+    return device;
 }
 
-void SIGMA_WRITE_DELAY(byte devAddress, int length, byte pData[]) {
-    int delay_length = 0;    // 初始化延迟长度变量
-    for (byte i = length; i > 0; i--) {
-        // 解包pData以计算延迟长度为整数
-        delay_length = (delay_length << 8) + pData[i];
+// 不给I2C地址时由导出地址推出：SigmaStudio导出的是8位写地址，I2C地址为其右移一位。
+// OVERRIDE_SIGMASTUDIO_DEVICE_ADDRESS 时导出地址与板子不符（见 USER_SETTINGS.h），
+// 第一片DSP用 DSP_I2C_ADDR，其余各片推不出地址，返回 nullptr，须用上面的重载给出
+template <typename Bus = SigmaDefaultTransport>
+SigmaDevice* SIGMA_ADD_DEVICE(byte devAddress) {
+#if OVERRIDE_SIGMASTUDIO_DEVICE_ADDRESS
+    SigmaDevice* device = SIGMA_FIND_DEVICE(devAddress);
+    if (device ? device != &g_sigma_devices[0] : g_sigma_device_count > 0) {
+        g_sigma_last_error = SIGMA_ERROR_INVALID_PARAM;
+        return nullptr;
     }
-    delay(delay_length);    // 延迟此处理器（不是DSP）适当的时间
+    return SIGMA_ADD_DEVICE<Bus>(devAddress, uint8_t(DSP_I2C_ADDR));
+#else
+    return SIGMA_ADD_DEVICE<Bus>(devAddress, uint8_t(devAddress >> 1));
+#endif
 }
 
-void SIGMA_WRITE_DELAY(byte devAddress, int length, const uint8_t pData[]) {
-    int delay_length = 0;    // 初始化延迟长度变量
-    for (byte i = length; i > 0; i--) {
-        // 解包pData以计算延迟长度为整数
-        delay_length = (delay_length << 8) + pgm_read_byte_near(pData+i);
+template <typename Bus>
+void SIGMA_SELECT_DEVICE(byte devAddress) {
+    if (devAddress == SIGMA_CURRENT_DEVICE || g_sigma_device_count == 0) {
+        return;
+    }
+    SigmaDevice* next = SIGMA_FIND_DEVICE(devAddress);
+    if (!next) {
+        next = &g_sigma_default_device;
+    }
+    if (next == g_sigma_device) {
+        return;
+    }
+    SIGMA_PLAN_FLUSH<Bus>();    // 待发的合并写入属于原来的设备，错误也记在它名下
+    SIGMA_DEVICE_SAVE();
+    g_sigma_device = next;
+    SIGMA_DEVICE_LOAD();
+    if (next->clock && next->clock != Bus::clock()) {
+        Bus::setClock(next->clock);
     }
-    delay(delay_length);    // 延迟此处理器（不是DSP）适当的时间
 }
 
+// 设备的状态（最后的错误、计数、启动方式、时钟）。未登记的地址返回未登记设备共用的一份
+SigmaDevice* SIGMA_GET_DEVICE(byte devAddress) {
+    SIGMA_DEVICE_SAVE();
+    SigmaDevice* device = SIGMA_FIND_DEVICE(devAddress);
+    return device ? device : &g_sigma_default_device;
+}
 
-// SAFELOAD 宏定义映射
-#ifndef SAFELOAD_DATA_ADDR
-  #ifdef MOD_SAFELOADMODULE_DATA_SAFELOAD0_ADDR
-    #define SAFELOAD_DATA_ADDR MOD_SAFELOADMODULE_DATA_SAFELOAD0_ADDR
-  #else
-    #define SAFELOAD_DATA_ADDR 24576  // 默认值
-  #endif
+uint8_t SIGMA_GET_LAST_ERROR(byte devAddress) {
+    return SIGMA_GET_DEVICE(devAddress)->lastError;
+}
+
+// ========== 总线时钟鉴定 ==========
+// 线束、上拉电阻和走线决定总线实际能跑多快，I2C_CLOCK_SPEED/SPI_SPEED 只是猜测。
+// SIGMA_QUALIFY_CLOCK() 从慢到快试传输的各档时钟（clockStep()）：每个测试图样在最慢一档
+// 时钟下写进DSP程序不用的一个数据内存字，再在被试的时钟下读回，读回不符、总线错误或I2C
+// 需要重试就停下。未鉴定的时钟下只发起读取，但读取的命令部分同样在被试时钟下发送：
+//   - I2C：子地址出错时只会读错地址；设备地址字节里的读/写位出错的后果这里无法排除；
+//   - SPI：命令字节的读/写位出错时读取变成写入，MOSI上的零写到可能错位的地址。
+// 所以SPI上DSP正在运行时不鉴定，返回 SIGMA_ERROR_DSP_RUNNING；先鉴定再下载，下载覆盖
+// 这类写入。要求绝对安全时I2C也只在下载前鉴定（最慢一档视为可靠）。
+// 选中通过的最快一档，且不超过第一个失败时钟的 SIGMA_CLOCK_MARGIN 百分比（留出余量）；
+// 各档都通过时同样留出余量，以最高一档为界。测试字原来的内容在最慢一档时钟下读出，结束时写回。
+//
+// 结果存进EEPROM（每个设备一份，紧接该设备的增量重载记录），以后启动直接使用记录的时钟，
+// 只核对一轮图样；核对失败（换过线束）时重新鉴定，force 为 true 时总是重新鉴定。
+// 登记过的设备（见"多DSP：设备表"）记住选中的时钟，切换到该设备时传输改用这个时钟。
+//
+//   SIGMA_I2C_INIT();
+//   // 测试字紧接签名字，要求相同（见"热启动"）
+//   if (SIGMA_QUALIFY_CLOCK(DEVICE_ADDR_IC_1, SCRATCH_ADDR_IC_1) != SIGMA_SUCCESS) {
+//       SIGMA_PRINT_ERROR();    // 时钟保持不变
+//   }
+//   default_download_IC_1();
+#ifndef SIGMA_CLOCK_MARGIN
+  #define SIGMA_CLOCK_MARGIN 80    // 选中的时钟不超过第一个失败时钟的百分比
 #endif
 
-#ifndef SAFELOAD_ADDR_ADDR
-  #ifdef MOD_SAFELOADMODULE_ADDRESS_SAFELOAD_ADDR
-    #define SAFELOAD_ADDR_ADDR MOD_SAFELOADMODULE_ADDRESS_SAFELOAD_ADDR
-  #else
-    #define SAFELOAD_ADDR_ADDR 24581  // 默认值
-  #endif
+#ifndef SIGMA_QUALIFY_ROUNDS
+  #define SIGMA_QUALIFY_ROUNDS 4   // 每档时钟写入读回全部图样的轮数
 #endif
 
-#ifndef SAFELOAD_SLOTS_ADDR
-  #ifdef MOD_SAFELOADMODULE_NUM_SAFELOAD_ADDR
-    #define SAFELOAD_SLOTS_ADDR MOD_SAFELOADMODULE_NUM_SAFELOAD_ADDR
-  #else
-    #define SAFELOAD_SLOTS_ADDR 24582  // 默认值
+// 相邻位相反、整字节翻转和走动的图样
+static const uint32_t g_sigma_clock_patterns[] = {
+    0x55AA55AAUL, 0xAA55AA55UL, 0xFF00FF00UL, 0x00FF00FFUL,
+    0xFFFFFFFFUL, 0x00000000UL, 0x12345678UL, 0xEDCBA987UL
+};
+
+// nvAddress 为负时没有记录
+bool SIGMA_CLOCK_LOAD(int nvAddress, SigmaClockRecord* record) {
+#if SIGMA_USE_EEPROM
+    if (nvAddress < 0) {
+        return false;
+    }
+  #if SIGMA_PLATFORM == SIGMA_PLATFORM_ESP32 || SIGMA_PLATFORM == SIGMA_PLATFORM_ESP8266
+    size_t end = nvAddress + sizeof(SigmaClockRecord);
+    EEPROM.begin(end > SIGMA_NV_END ? end : SIGMA_NV_END);    // 与增量重载的记录共用同一块
   #endif
+    EEPROM.get(nvAddress, *record);
+    return record->magic == SIGMA_CLOCK_MAGIC && record->clock != 0;
+#else
+    (void)nvAddress;
+    (void)record;
+    return false;
 #endif
+}
 
-// SAFELOAD slots 数据数组
-#ifndef SAFELOAD_SLOTS_DATA_1
-  static const uint8_t SAFELOAD_SLOTS_DATA_1[] = {1, 1, 1, 1, 1};  // 默认值数组
+void SIGMA_CLOCK_STORE(int nvAddress, const SigmaClockRecord* record) {
+#if SIGMA_USE_EEPROM
+    if (nvAddress < 0) {
+        return;
+    }
+    EEPROM.put(nvAddress, *record);    // 只写入变化的字节
+  #if SIGMA_PLATFORM == SIGMA_PLATFORM_ESP32 || SIGMA_PLATFORM == SIGMA_PLATFORM_ESP8266
+    EEPROM.commit();
+  #endif
+#else
+    (void)nvAddress;
+    (void)record;
 #endif
-
-void SIGMA_WRITE_SAFELOAD_REGISTER_BLOCK(int address, int length, uint8_t pData[]){
-  SIGMA_WRITE_REGISTER_BLOCK(DSP_I2C_ADDR, SAFELOAD_DATA_ADDR, length, pData);
-  SIGMA_WRITE_REGISTER_INTEGER(SAFELOAD_ADDR_ADDR, address);
-  SIGMA_WRITE_REGISTER_BLOCK(DSP_I2C_ADDR, SAFELOAD_SLOTS_ADDR, length, SAFELOAD_SLOTS_DATA_1);
 }
 
-void SIGMA_WRITE_SAFELOAD_REGISTER_BLOCK(int address, int length, const uint8_t pData[], int addrOffset){
-  SIGMA_WRITE_REGISTER_BLOCK(DSP_I2C_ADDR, SAFELOAD_DATA_ADDR, length, pData, addrOffset);
-  SIGMA_WRITE_REGISTER_INTEGER(SAFELOAD_ADDR_ADDR, address);
-  SIGMA_WRITE_REGISTER_BLOCK(DSP_I2C_ADDR, SAFELOAD_SLOTS_ADDR, length, SAFELOAD_SLOTS_DATA_1);
+// 全部图样 rounds 轮：在最慢一档时钟下写入，在 clock 下读回比较，不经过计划器
+template <typename Bus>
+bool SIGMA_CLOCK_CHECK(uint16_t address, uint32_t clock, int rounds) {
+    uint32_t retries = g_sigma_retries;
+    for (int r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < sizeof(g_sigma_clock_patterns) / sizeof(g_sigma_clock_patterns[0]); i++) {
+            uint32_t pattern = g_sigma_clock_patterns[i];
+            uint8_t out[4] = {uint8_t(pattern >> 24), uint8_t(pattern >> 16), uint8_t(pattern >> 8), uint8_t(pattern)};
+            uint8_t in[4];
+            Bus::setClock(Bus::clockStep(0));
+            if (Bus::write(address, out, 4, false) != SIGMA_SUCCESS) {
+                return false;
+            }
+            Bus::setClock(clock);
+            if (Bus::read(address, in, 4) != SIGMA_SUCCESS || memcmp(in, out, 4) != 0) {
+                return false;
+            }
+        }
+    }
+    return g_sigma_retries == retries;    // 靠重试才通过的时钟不算可靠
 }
 
-// ========== 优化的读取函数 ==========
-uint8_t SIGMA_READ_REGISTER_BYTES(int address, int length, byte* pData) {
-    // 参数验证
-    if (length <= 0 || !pData) {
-        g_sigma_last_error = SIGMA_ERROR_INVALID_PARAM;
-        return g_sigma_last_error;
-    }
-    
-    g_sigma_last_error = SIGMA_SUCCESS;
-    
-#if USE_SPI
-    digitalWrite(DSP_SS_PIN, LOW);
-    SPI.beginTransaction(settingsA);
-    SPI.transfer(0x1);
-    SPI.transfer(address >> 8);
-    SPI.transfer(address & 0xff);
-    for (int i = 0; i < length; i++) {
-        pData[i] = SPI.transfer(0);
+// scratchAddress 为DSP程序不用的一个数据内存字（4字节）；成功时传输停在选中的时钟，
+// 最慢一档也失败时恢复原来的时钟并返回 SIGMA_ERROR_BUS_CLOCK，没有应答的传输（SPI）上DSP
+// 正在运行时不做任何测试，恢复原来的时钟并返回 SIGMA_ERROR_DSP_RUNNING。nvAddress 为 -1 时用设备的记录位置，
+// 设备没有记录位置（见 SIGMA_DEVICE_INDEX()）时每次都重新鉴定，结果不保存
+template <typename Bus = SigmaDefaultTransport>
+uint8_t SIGMA_QUALIFY_CLOCK(byte devAddress, uint16_t scratchAddress, bool force = false, int nvAddress = -1) {
+    SIGMA_SELECT_DEVICE<Bus>(devAddress);
+    if (nvAddress < 0 && SIGMA_NV_SLOT() >= 0) {
+        nvAddress = SIGMA_NV_SLOT() + int(sizeof(SigmaNvRecord));
     }
-    SPI.endTransaction();
-    digitalWrite(DSP_SS_PIN, HIGH);
-    return SIGMA_SUCCESS;
-    
-#else
-    Wire.beginTransmission(DSP_I2C_ADDR);
-    Wire.write(address >> 8);
-    Wire.write(address & 0xff);
-    uint8_t error = Wire.endTransmission(false);
-    
-    if (checkI2CError(error) != SIGMA_SUCCESS) {
+    uint8_t savedError = g_sigma_last_error;
+    uint32_t initial = Bus::clock();
+    uint32_t slowest = Bus::clockStep(0);
+
+    uint8_t original[4];
+    Bus::setClock(slowest);
+    if (!Bus::ACKED && (SIGMA_READ_REGISTER_INTEGER<Bus>(SIGMA_REG_CORE_STATUS, 2) & 0x0007) == 0x0001) {
+        Bus::setClock(initial);
+        g_sigma_last_error = SIGMA_ERROR_DSP_RUNNING;
         return g_sigma_last_error;
     }
-    
-    uint8_t received = Wire.requestFrom(DSP_I2C_ADDR, (uint8_t)length);
-    if (received != length) {
-        g_sigma_last_error = SIGMA_ERROR_I2C_DATA;
+    if (SIGMA_READ_REGISTER_BYTES<Bus>(scratchAddress, 4, original) != SIGMA_SUCCESS) {
+        Bus::setClock(initial);
         return g_sigma_last_error;
     }
-    
-    for (int i = 0; i < length; i++) {
-        if (Wire.available()) {
-            pData[i] = Wire.read();
-        } else {
-            g_sigma_last_error = SIGMA_ERROR_I2C_DATA;
-            return g_sigma_last_error;
-        }
-    }
-    return SIGMA_SUCCESS;
-#endif
-}
 
-int32_t SIGMA_READ_REGISTER_INTEGER(int address, int length) {
-    if (length > 4) {
-        g_sigma_last_error = SIGMA_ERROR_INVALID_PARAM;
-        return 0;
-    }
-    
-    byte register_value[4] = {0};
-    if (SIGMA_READ_REGISTER_BYTES(address, length, register_value) != SIGMA_SUCCESS) {
-        return 0;
-    }
-    
-    int32_t result = 0;
-    for (int i = 0; i < length; i++) {
-        result = (result << 8) + register_value[i];
+    SigmaClockRecord record;
+    uint32_t chosen = 0;
+    if (!force && SIGMA_CLOCK_LOAD(nvAddress, &record)) {
+        if (SIGMA_CLOCK_CHECK<Bus>(scratchAddress, record.clock, 1)) {
+            chosen = record.clock;
+        }
     }
-    return result;
-}
 
-double SIGMA_READ_REGISTER_FLOAT(int address) {
-    int32_t integer_val = SIGMA_READ_REGISTER_INTEGER(address, 4);
-    if (g_sigma_last_error != SIGMA_SUCCESS) {
-        return 0.0;
+    if (!chosen) {
+        int passed = 0;    // 从最慢一档起连续通过的档数
+        uint32_t failed = 0;
+        while (Bus::clockStep(passed)) {
+            if (!SIGMA_CLOCK_CHECK<Bus>(scratchAddress, Bus::clockStep(passed), SIGMA_QUALIFY_ROUNDS)) {
+                failed = Bus::clockStep(passed);
+                break;
+            }
+            passed++;
+        }
+        // 余量以第一个失败的时钟为界，都通过时以最高一档为界
+        uint32_t limit = failed ? failed : passed ? Bus::clockStep(passed - 1) : 0;
+        for (int i = passed - 1; i >= 0 && !chosen; i--) {
+            if (Bus::clockStep(i) <= limit / 100 * SIGMA_CLOCK_MARGIN) {
+                chosen = Bus::clockStep(i);
+            }
+        }
+        if (passed && !chosen) {
+            chosen = slowest;
+        }
     }
-    
-#if DSP_TYPE == DSP_TYPE_SIGMA300_350
-    return double(integer_val) / (1 << 23);
-#else
-    return double(integer_val) / (1 << 23);
-#endif
-}
 
-// 便利函数：安全读取参数
-bool SIGMA_READ_PARAM_SAFE(int address, double* value) {
-    if (!value) {
-        g_sigma_last_error = SIGMA_ERROR_INVALID_PARAM;
-        return false;
+    // 在最慢一档时钟下写回测试字
+    Bus::setClock(slowest);
+    uint8_t result = Bus::write(scratchAddress, original, 4, false);
+    if (!chosen) {
+        Bus::setClock(initial);
+        g_sigma_last_error = SIGMA_ERROR_BUS_CLOCK;
+        return g_sigma_last_error;
     }
-    
-    *value = SIGMA_READ_REGISTER_FLOAT(address);
-    if (g_sigma_last_error != SIGMA_SUCCESS) {
-        SIGMA_DEBUG_PRINT("参数读取失败，地址: 0x");
-        SIGMA_DEBUG_PRINT_HEX(address);
-        SIGMA_DEBUG_PRINT(", 错误: ");
-        SIGMA_DEBUG_PRINTLN(g_sigma_last_error);
-        return false;
+    Bus::setClock(chosen);
+    g_sigma_device->clock = chosen;
+    if (result != SIGMA_SUCCESS) {
+        return result;
     }
-    return true;
+    record.magic = SIGMA_CLOCK_MAGIC;
+    record.clock = chosen;
+    SIGMA_CLOCK_STORE(nvAddress, &record);
+    g_sigma_last_error = savedError;    // 鉴定中较快时钟的失败是预期的
+    return SIGMA_SUCCESS;
 }
 
 // 用于读取DSP寄存器并打印到串口的函数，不被
@@ -534,6 +2677,263 @@ void SIGMA_PRINT_REGISTER(int address, int dataLength) {
  */
 #define SIGMASTUDIOTYPE_INTEGER_CONVERT(_value) (_value)
 
+// ========== 从文件系统加载镜像 ==========
+// 把下载序列放在 LittleFS/SPIFFS/SD 上而不是编译进闪存，调音更新只需复制一个文件：
+//   sigma_sequence_gen --image <导出目录> 1 > ADAU1452_EN_B_I2C_IC_1.sigi
+//   sigma_sequence_gen --image --sparse <导出目录> 1 > ADAU1452_EN_B_I2C_IC_1.sigi   （零段不存数据）
+//
+//   File image = LittleFS.open("/ADAU1452_EN_B_I2C_IC_1.sigi", "r");
+//   uint8_t result = SIGMA_RUN_IMAGE(DEVICE_ADDR_IC_1, image);
+//
+// 镜像格式（多字节字段均为大端）：
+//   文件头  "SIGI"、版本(1字节)、保留(1字节)、记录数(2)、记录区字节数(4)、记录区CRC32(4)
+//   记录    操作(1)、组(1)、地址(2)、长度(2)，SIGMA_SEQ_WRITE/SIGMA_SEQ_DELAY 随后是 length 字节数据，
+//           SIGMA_SEQ_ZERO 没有数据（总是写零）。文件不占闪存，不使用压缩条目
+// 开始写入之前先读一遍整个文件，核对CRC和记录结构；复制了一半或损坏的文件不会打断正在运行的DSP。
+//
+// 文件按 SIGMA_IMAGE_BLOCK 字节成块读取，两块轮换：总线写入消耗一块，另一块是下一次读取的目标。
+// 复位、PLL锁定等延迟开始时先把空闲的一块读好，文件系统的读取时间从DSP的等待里扣除。
+// 文件类型只需提供 read(uint8_t*, size_t)、seek(uint32_t) 和 size()，Arduino 各文件系统的 File 都满足。
+
+#ifndef SIGMA_IMAGE_BLOCK
+  #define SIGMA_IMAGE_BLOCK 256       // 每次从文件读取的字节数（RAM中两块）
+#endif
+
+#define SIGMA_IMAGE_VERSION     1
+#define SIGMA_IMAGE_HEADER      16
+#define SIGMA_IMAGE_RECORD      6     // 记录头字节数
+#define SIGMA_IMAGE_STAGE       (SIGMA_WITH_SPI && SIGMA_PLAN_BUFFER_SIZE > MAX_I2C_DATA_LENGTH ? SIGMA_PLAN_BUFFER_SIZE \
+                                                                                    : MAX_I2C_DATA_LENGTH)
+
+struct SigmaImageReader {
+    uint8_t block[2][SIGMA_IMAGE_BLOCK];
+    uint16_t filled[2];            // 各块读到的字节数，0 表示空闲
+    uint16_t pos;                  // 当前块中下一个字节
+    uint8_t current;               // 正在消耗的块
+    uint32_t remaining;            // 文件中还没有读出的字节
+    uint32_t crc;                  // 已取出数据的CRC32
+    uint8_t stage[SIGMA_IMAGE_STAGE];    // 一次总线写入（I2C突发、SPI块或交给计划器的写入）
+
+    uint32_t fileReads;            // 调用 file.read() 的次数
+    uint32_t prefetched;           // 在延迟期间读好的块数
+};
+
+// 从 offset 开始读取 length 字节
+template <typename FileT>
+bool SIGMA_IMAGE_OPEN(SigmaImageReader* r, FileT& file, uint32_t offset, uint32_t length) {
+    r->filled[0] = 0;
+    r->filled[1] = 0;
+    r->pos = 0;
+    r->current = 0;
+    r->remaining = length;
+    r->crc = 0;
+    return file.seek(offset);
+}
+
+// 读满第 which 块，文件提前结束时返回 false
+template <typename FileT>
+bool SIGMA_IMAGE_LOAD(SigmaImageReader* r, FileT& file, uint8_t which) {
+    uint16_t want = uint16_t(r->remaining < SIGMA_IMAGE_BLOCK ? r->remaining : SIGMA_IMAGE_BLOCK);
+    size_t got = want ? file.read(r->block[which], want) : 0;
+    r->fileReads += want ? 1 : 0;
+    r->filled[which] = uint16_t(got);
+    r->remaining = got == want ? r->remaining - want : 0;
+    return want > 0 && got == want;
+}
+
+// 空闲的一块还没有读时现在读，返回是否读了
+template <typename FileT>
+bool SIGMA_IMAGE_PREFETCH(SigmaImageReader* r, FileT& file) {
+    uint8_t next = r->current ^ 1;
+    if (r->filled[next] != 0 || r->remaining == 0) {
+        return false;
+    }
+    SIGMA_IMAGE_LOAD(r, file, next);
+    r->prefetched++;
+    return true;
+}
+
+// 取出 length 字节，out 为 nullptr 时只跳过（仍计入CRC）。数据不足时返回 false
+template <typename FileT>
+bool SIGMA_IMAGE_READ(SigmaImageReader* r, FileT& file, uint8_t* out, int length) {
+    while (length > 0) {
+        if (r->pos == r->filled[r->current]) {
+            r->filled[r->current] = 0;    // 用完的一块交给下一次预读
+            r->current ^= 1;
+            r->pos = 0;
+            if (r->filled[r->current] == 0 && !SIGMA_IMAGE_LOAD(r, file, r->current)) {
+                return false;
+            }
+        }
+        int n = r->filled[r->current] - r->pos;
+        n = n < length ? n : length;
+        const uint8_t* src = r->block[r->current] + r->pos;
+        r->crc = SIGMA_CRC32(r->crc, src, n);
+        if (out) {
+            memcpy(out, src, n);
+            out += n;
+        }
+        r->pos += n;
+        length -= n;
+    }
+    return true;
+}
+
+// 镜像记录，与 SigmaSeqEntry 相同但没有偏移（数据紧随记录头）
+template <typename FileT>
+bool SIGMA_IMAGE_RECORD_READ(SigmaImageReader* r, FileT& file, SigmaSeqEntry* entry) {
+    uint8_t head[SIGMA_IMAGE_RECORD];
+    if (!SIGMA_IMAGE_READ(r, file, head, SIGMA_IMAGE_RECORD)) {
+        return false;
+    }
+    entry->opcode = head[0];
+    entry->group = head[1];
+    entry->address = uint16_t((head[2] << 8) | head[3]);
+    entry->length = uint16_t((head[4] << 8) | head[5]);
+    entry->offset = 0;
+    return (entry->opcode == SIGMA_SEQ_WRITE || entry->opcode == SIGMA_SEQ_ZERO ||
+            (entry->opcode == SIGMA_SEQ_DELAY && entry->length <= 4)) && entry->group < SIGMA_GROUP_COUNT;
+}
+
+// 读文件头并核对整个记录区，成功时 *count/*bodyBytes 为记录数和记录区字节数
+template <typename FileT>
+uint8_t SIGMA_IMAGE_CHECK(SigmaImageReader* r, FileT& file, uint16_t* count, uint32_t* bodyBytes) {
+    uint8_t head[SIGMA_IMAGE_HEADER] = {0};
+    bool ok = file.seek(0) && file.read(head, SIGMA_IMAGE_HEADER) == SIGMA_IMAGE_HEADER &&
+              memcmp(head, "SIGI", 4) == 0 && head[4] == SIGMA_IMAGE_VERSION;
+    *count = uint16_t((head[6] << 8) | head[7]);
+    *bodyBytes = (uint32_t(head[8]) << 24) | (uint32_t(head[9]) << 16) | (uint32_t(head[10]) << 8) | head[11];
+    uint32_t crc = (uint32_t(head[12]) << 24) | (uint32_t(head[13]) << 16) | (uint32_t(head[14]) << 8) | head[15];
+    ok = ok && file.size() == SIGMA_IMAGE_HEADER + *bodyBytes &&
+         SIGMA_IMAGE_OPEN(r, file, SIGMA_IMAGE_HEADER, *bodyBytes);
+    for (uint16_t i = 0; ok && i < *count; i++) {
+        SigmaSeqEntry entry;
+        ok = SIGMA_IMAGE_RECORD_READ(r, file, &entry) &&
+             SIGMA_IMAGE_READ(r, file, nullptr, entry.opcode == SIGMA_SEQ_ZERO ? 0 : entry.length);
+    }
+    if (!ok || r->remaining != 0 || r->pos != r->filled[r->current] || r->crc != crc) {
+        g_sigma_last_error = SIGMA_ERROR_IMAGE;
+        return g_sigma_last_error;
+    }
+    return SIGMA_SUCCESS;
+}
+
+// 执行一条写入记录：小的写入交给计划器，其余按暂存区大小分块，每块一个事务。
+// 每块先从文件读进暂存区再开始事务：SPI上片选不会在读SD卡（常与DSP共用SPI总线）时
+// 保持有效，读取失败时这一块不写入，有应答的传输失败时也可以重发
+template <typename Bus, typename FileT>
+uint8_t SIGMA_IMAGE_WRITE(SigmaImageReader* r, FileT& file, const SigmaSeqEntry* entry) {
+    if (SigmaPlanState<Bus>::active && entry->length <= Bus::PLAN_BYTES && entry->length <= SIGMA_IMAGE_STAGE) {
+        if (!SIGMA_IMAGE_READ(r, file, r->stage, entry->length)) {
+            return SIGMA_ERROR_IMAGE;
+        }
+        return SIGMA_PLAN_WRITE<Bus>(entry->address, entry->length, r->stage, false);
+    }
+    uint8_t result = SIGMA_PLAN_FLUSH<Bus>();
+    if (result != SIGMA_SUCCESS) {
+        return result;
+    }
+    uint32_t address = entry->address;
+    for (int sent = 0; sent < entry->length; ) {
+        int chunk = Bus::chunkLength(address, entry->length - sent, entry->length, SIGMA_IMAGE_STAGE);
+        if (!SIGMA_IMAGE_READ(r, file, r->stage, chunk)) {
+            return SIGMA_ERROR_IMAGE;
+        }
+        result = Bus::write(address, r->stage, chunk, false);
+        if (result != SIGMA_SUCCESS) {
+            return result;
+        }
+        byte depth = getMemoryDepth(address);
+        address += (chunk + depth - 1) / depth;
+        sent += chunk;
+    }
+    return SIGMA_SUCCESS;
+}
+
+// 执行一条零记录
+template <typename Bus>
+uint8_t SIGMA_IMAGE_ZERO(const SigmaSeqEntry* entry) {
+    uint8_t result = SIGMA_PLAN_FLUSH<Bus>();
+    byte depth = getMemoryDepth(entry->address);
+    for (int sent = 0; result == SIGMA_SUCCESS && sent < entry->length; ) {
+        uint32_t address = entry->address + sent / depth;
+        int chunk = Bus::chunkLength(address, entry->length - sent, entry->length);
+        result = SIGMA_WRITE_ZEROS<Bus>(address, chunk);
+        sent += chunk;
+    }
+    return result;
+}
+
+// 核对后阻塞执行整个镜像，reader 提供两块读取缓冲区（约 2*SIGMA_IMAGE_BLOCK 字节）。
+// 文件有误时不写入DSP，返回 SIGMA_ERROR_IMAGE；总线错误时停止并返回该错误；
+// 正常结束时返回第一个不中断执行的错误（如轮询超时）
+template <typename Bus = SigmaDefaultTransport, typename FileT>
+uint8_t SIGMA_RUN_IMAGE(byte devAddress, FileT& file, SigmaImageReader* r) {
+    SIGMA_SELECT_DEVICE<Bus>(devAddress);
+    uint16_t count;
+    uint32_t bodyBytes;
+    r->fileReads = 0;
+    r->prefetched = 0;
+    if (SIGMA_IMAGE_CHECK(r, file, &count, &bodyBytes) != SIGMA_SUCCESS ||
+        !SIGMA_IMAGE_OPEN(r, file, SIGMA_IMAGE_HEADER, bodyBytes)) {
+        g_sigma_last_error = SIGMA_ERROR_IMAGE;
+        return g_sigma_last_error;
+    }
+    g_sigma_wait_saved_ms = 0;
+    SIGMA_TIMING_START(SIGMA_TIMING_AUTO);
+    uint8_t first = SIGMA_SUCCESS;
+    uint16_t lastAddress = 0;
+    uint16_t lastValue = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        SigmaSeqEntry entry;
+        uint8_t result = SIGMA_IMAGE_RECORD_READ(r, file, &entry) ? SIGMA_SUCCESS : SIGMA_ERROR_IMAGE;
+        if (result == SIGMA_SUCCESS && entry.opcode == SIGMA_SEQ_DELAY) {
+            uint8_t data[4];
+            result = SIGMA_IMAGE_READ(r, file, data, entry.length) ? SIGMA_SUCCESS : SIGMA_ERROR_IMAGE;
+            uint32_t ms = 0;
+            for (int k = 0; k < entry.length; k++) {
+                ms = (ms << 8) | data[k];
+            }
+            SIGMA_PLAN_FLUSH<Bus>();
+            uint32_t start = millis();
+            SIGMA_IMAGE_PREFETCH(r, file);    // 在DSP等待期间读下一块
+            uint32_t spent = millis() - start;
+            uint8_t wait = SIGMA_WAIT_READY_MS<Bus>(lastAddress, lastValue, spent < ms ? ms - spent : 0);
+            if (wait != SIGMA_SUCCESS && first == SIGMA_SUCCESS) {
+                first = wait;
+            }
+        }
+        else if (result == SIGMA_SUCCESS) {
+            SIGMA_TIMING_PHASE<Bus>(entry.address);
+            if (entry.opcode == SIGMA_SEQ_ZERO) {
+                result = SIGMA_IMAGE_ZERO<Bus>(&entry);
+            }
+            else {
+                result = SIGMA_IMAGE_WRITE<Bus>(r, file, &entry);
+                if (entry.length == 2) {
+                    lastAddress = entry.address;
+                    lastValue = uint16_t((r->stage[0] << 8) | r->stage[1]);
+                }
+            }
+        }
+        if (result != SIGMA_SUCCESS) {
+            if (result == SIGMA_ERROR_IMAGE) {
+                g_sigma_last_error = result;    // 核对之后文件又变了
+            }
+            SIGMA_TIMING_FINISH(SIGMA_TIMING_AUTO);
+            return result;
+        }
+    }
+    SIGMA_TIMING_FINISH(SIGMA_TIMING_AUTO);
+    return first;
+}
+
+template <typename Bus = SigmaDefaultTransport, typename FileT>
+uint8_t SIGMA_RUN_IMAGE(byte devAddress, FileT& file) {
+    static SigmaImageReader reader;    // 所有传输共用一份
+    return SIGMA_RUN_IMAGE<Bus>(devAddress, file, &reader);
+}
+
 // ========== 新增：便利函数和使用示例 ==========
 
 // 优化的调试打印函数
@@ -657,6 +3057,107 @@ bool SIGMA_SYSTEM_INIT() {
  *        SIGMA_PRINT_ERROR();
  *    }
  * 
+ * 7. 合并连续寄存器写入的下载：
+ *    SIGMA_DOWNLOAD_BEGIN();
+ *    default_download_IC_1();
+ *    if (SIGMA_DOWNLOAD_END() != SIGMA_SUCCESS) {
+ *        SIGMA_PRINT_ERROR();
+ *    }
+ * 
+ * 8. 表驱动下载（序列表由 host/sigma_sequence_gen 生成，代替导出的 default_download_IC_1()）：
+ *    #include "ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+ *    if (sequence_download_IC_1() != SIGMA_SUCCESS) {
+ *        SIGMA_PRINT_ERROR();
+ *    }
+ * 
+ * 9. 非阻塞下载（loop() 中每次执行一步）：
+ *    SigmaSeqState dl;
+ *    SIGMA_SEQ_START(&dl, DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1);
+ *    void loop() {
+ *        if (!SIGMA_SEQ_DONE(&dl) && SIGMA_SEQ_WAIT_MS(&dl) == 0) {
+ *            SIGMA_SEQ_STEP(&dl);
+ *        }
+ *        handleEncoder();
+ *    }
+ * 
+ * 10. 从失败的块继续下载（不必从 SOFT_RESET 重来）：
+ *    SigmaSeqState dl;
+ *    SIGMA_SEQ_START(&dl, DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1);
+ *    while (SIGMA_SEQ_RUN(&dl) != SIGMA_SUCCESS && dl.failed && dl.resumes < 3) {
+ *        SIGMA_SEQ_RESUME(&dl);
+ *    }
+ * 
+ * 11. 下载后读回校验（CRC32由 host/sigma_sequence_gen 在构建时算好）：
+ *    int section;
+ *    if (SIGMA_VERIFY_SECTIONS(DEVICE_ADDR_IC_1, Sections_IC_1, SECTION_COUNT_IC_1, &section) != SIGMA_SUCCESS) {
+ *        SIGMA_PRINT_ERROR();    // section 为第一个不符的段
+ *    }
+ * 
+ * 12. MCU复位后DSP仍在运行同一镜像时跳过下载：
+ *    SIGMA_BOOT_SEQUENCE(DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1, &Signature_IC_1);
+ *    if (SIGMA_WAS_WARM_BOOT()) {
+ *        Serial.println("DSP已在运行，跳过下载");
+ *    }
+ * 
+ * 13. 只重写与上次加载相比变化的部分（各组哈希存在EEPROM）：
+ *    SIGMA_BOOT_INCREMENTAL(DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1,
+ *                           &Signature_IC_1, GroupHash_IC_1);
+ *    if (SIGMA_BOOT_MODE() == SIGMA_BOOT_MODE_INCREMENTAL) {
+ *        Serial.println(SIGMA_BOOT_GROUPS(), BIN);    // 重写的组
+ *    }
+ * 
+ * 14. 压缩的序列表（闪存占用约减半，边解压边写入，用法同例8-10）：
+ *    #define SIGMA_LZ_ENABLE true    // 在包含任何DSP头文件之前
+ *    #include "ADAU1452_EN_B_I2C_IC_1_SEQ_LZ.h"
+ *    sequence_download_LZ_IC_1();
+ * 
+ * 15. 刚给DSP上电后只发送非零数据（稀疏序列，跳过零段）：
+ *    #include "ADAU1452_EN_B_I2C_IC_1_SEQ_SPARSE.h"
+ *    sequence_download_SPARSE_IC_1(DEVICE_ADDR_IC_1, SIGMA_ZERO_ASSUME);
+ *    // 不能确定内存为零时用 SIGMA_ZERO_CHECK：逐块读回，只给不为零的块写零
+ * 
+ * 16. 各启动阶段的耗时、事务数和字节数：
+ *    sequence_download_IC_1();
+ *    SIGMA_PRINT_BOOT_TIMING();    // 或 SIGMA_GET_BOOT_TIMING()->phase[SIGMA_PHASE_PROGRAM].us 等
+ *    // 多个DSP或逐条展开的导出函数：SIGMA_TIMING_BEGIN(); ...; SIGMA_TIMING_END();
+ * 
+ * 17. DSP从EEPROM自启动（用 SigmaStudio 写入 IC 2 "E2Prom"，拉高 SELFBOOT）：
+ *    if (SIGMA_WAIT_SELF_BOOT(DEVICE_ADDR_IC_1) != SIGMA_SUCCESS) {
+ *        default_download_IC_1();    // EEPROM为空时由MCU下载
+ *    }
+ * 
+ * 18. 从文件系统加载镜像（sigma_sequence_gen --image 生成，更新调音只需替换文件）：
+ *    #include <LittleFS.h>
+ *    LittleFS.begin();
+ *    File image = LittleFS.open("/ADAU1452_EN_B_I2C_IC_1.sigi", "r");
+ *    if (SIGMA_RUN_IMAGE(DEVICE_ADDR_IC_1, image) == SIGMA_ERROR_IMAGE) {
+ *        default_download_IC_1();    // 文件损坏时退回编译进闪存的镜像
+ *    }
+ * 
+ * 19. 启动时鉴定总线时钟（结果存在EEPROM，以后启动直接使用）：
+ *    SIGMA_I2C_INIT();
+ *    SIGMA_QUALIFY_CLOCK(DEVICE_ADDR_IC_1, SCRATCH_ADDR_IC_1);
+ *    default_download_IC_1();    // 在选中的时钟下载
+ * 
+ * 20. 一个MCU控制同一I2C总线上的两片DSP（导出地址 0x72、0x74，即I2C 0x39、0x3A）：
+ *    SIGMA_I2C_INIT();
+ *    SIGMA_ADD_DEVICE(0x72, 0x39);
+ *    SIGMA_ADD_DEVICE(0x74, 0x3A);
+ *    sequence_download_IC_1(0x72);
+ *    sequence_download_IC_1(0x74);
+ *    SIGMA_WRITE_REGISTER_FLOAT(0x74, MOD_GAIN_ADDR, 0.5);    // 只改第二片
+ *    if (SIGMA_GET_LAST_ERROR(0x72) != SIGMA_SUCCESS) { ... }
+ * 
+ * 21. 两片DSP各在一个I2C控制器上，交替下载（延迟重叠，总时间接近最慢的一片）：
+ *    SigmaSeqState left, right;
+ *    SIGMA_SEQ_START(&left, DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1);
+ *    SIGMA_SEQ_START(&right, DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1);
+ *    SigmaParallel boot;
+ *    SIGMA_PARALLEL_BEGIN(&boot);
+ *    SIGMA_PARALLEL_ADD<SigmaI2cTransport<DSP_I2C_ADDR, &Wire>>(&boot, &left);
+ *    SIGMA_PARALLEL_ADD<SigmaI2cTransport<DSP_I2C_ADDR, &Wire1>>(&boot, &right);
+ *    SIGMA_PARALLEL_RUN(&boot);
+ * 
  * ========== 优化功能说明 ==========
  * 
  * 1. 错误处理系统：
@@ -690,7 +3191,26 @@ bool SIGMA_SYSTEM_INIT() {
  * #define SIGMA_DEBUG 1              // 开启调试输出
  * #define I2C_TIMEOUT_MS 1000        // I2C超时时间
  * #define I2C_CLOCK_SPEED 400000     // I2C时钟频率
- * #define MAX_I2C_DATA_LENGTH 30     // I2C缓冲区大小
+ * #define SIGMA_I2C_BUFFER_SIZE 32   // Wire发送缓冲区大小（默认按平台选择）
+ * #define MAX_I2C_DATA_LENGTH 30     // 直接指定I2C突发数据长度
+ * #define SIGMA_POLL_READY false     // 关闭PLL锁定/内核启动的状态轮询，按导出的固定延迟等待
+ * #define SIGMA_POLL_INTERVAL_MS 1   // 状态轮询间隔
+ * #define SIGMA_SPI_STEP_BYTES 256   // 非阻塞下载时SPI每步最多发送的字节数
+ * #define SIGMA_ZERO_CHECK_BYTES 32  // SIGMA_ZERO_CHECK 每步读回的字节数
+ * #define SIGMA_RETRY_COUNT 3        // I2C每块写入失败后的最多重试次数
+ * #define SIGMA_RETRY_BACKOFF_MS 1   // 第一次重试前的等待，此后每次加倍
+ * #define SIGMA_VERIFY_BUFFER_BYTES 32  // 读回校验的栈缓冲区，每次读回的字节数（默认一个I2C突发/SPI 256）
+ * #define SIGMA_USE_EEPROM false     // 不使用EEPROM保存增量重载的哈希（总是完整下载）
+ * #define SIGMA_NV_ADDR 0            // 哈希和时钟记录在EEPROM中的起始地址（每个设备一份）
+ * #define SIGMA_LZ_ENABLE true       // 编译压缩序列的解压器（约300字节RAM，使用 _SEQ_LZ.h 时需要）
+ * #define SIGMA_BOOT_TIMING false    // 不记录启动阶段计时
+ * #define SIGMA_BOOT_TIMING_PRINT true  // 第一次下载结束时打印各阶段计时
+ * #define SIGMA_IMAGE_BLOCK 512      // SIGMA_RUN_IMAGE() 每次从文件读取的字节数（两块）
+ * #define SIGMA_CLOCK_MARGIN 80      // 鉴定选中的时钟不超过第一个失败时钟的百分比
+ * #define SIGMA_QUALIFY_ROUNDS 4     // 鉴定时每档时钟写入读回全部图样的轮数
+ * #define SIGMA_I2C_CLOCK_STEPS 100000, 400000   // 鉴定尝试的I2C时钟（从慢到快）
+ * #define SIGMA_MAX_DEVICES 2        // SIGMA_ADD_DEVICE() 最多登记的DSP数
+ * #define SIGMA_PARALLEL_MAX 2       // 一次并行下载最多的DSP数
  */
 
 #endif
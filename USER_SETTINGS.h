@@ -9,16 +9,18 @@
 #define DSP_TYPE DSP_TYPE_SIGMA300_350
 
 // 通信接口选择
+#ifndef USE_SPI
 #define USE_SPI false
+#endif
 
 // 时钟速度设置
+// SPI默认1MHz，任何线束都能跑；ADAU145x 最高 22MHz，短线板子可在编译选项中
+// 定义 SPI_SPEED=20000000L 等打开（不超过 SIGMA_SPI_CLOCK_MAX，MCU 分不出时向下取整），
+// 或用 SIGMA_QUALIFY_CLOCK() 在启动时鉴定
+#ifndef SPI_SPEED
 #define SPI_SPEED 1000000L
-#define I2C_SPEED 100000L  // 降低到 100kHz
-
-#if USE_SPI
-#include <SPI.h>
-const SPISettings settingsA(SPI_SPEED, MSBFIRST, SPI_MODE3);
 #endif
+#define I2C_SPEED 100000L  // 降低到 100kHz
 
 // 引脚定义
 #define DSP_RESET_PIN 9
@@ -0,0 +1,97 @@
+#ifndef __HOST_ARDUINO_H__
+#define __HOST_ARDUINO_H__
+/*
+ * 主机构建用的最小 Arduino 替身。
+ * 只实现 SigmaStudioFW.h 和导出文件实际用到的部分。
+ */
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "SigmaHostBus.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+// ========== PROGMEM ==========
+// 主机上闪存与RAM是同一地址空间
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(addr)       (*(const uint8_t*)(addr))
+#define pgm_read_byte_near(addr)  (*(const uint8_t*)(addr))
+#define pgm_read_word_near(addr)  (*(const uint16_t*)(addr))
+#define memcpy_P(dest, src, n)    memcpy((dest), (src), (n))
+
+// ========== GPIO ==========
+#define LOW    0
+#define HIGH   1
+#define INPUT  0
+#define OUTPUT 1
+
+inline void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+inline void digitalWrite(uint8_t pin, uint8_t val) { (void)pin; (void)val; }
+inline int digitalRead(uint8_t pin) { (void)pin; return LOW; }
+
+// ========== 时间（虚拟时钟，见 SigmaHostBus.h） ==========
+inline void delay(unsigned long ms) { SIGMA_HOST_ADVANCE_US(uint64_t(ms) * 1000); }
+inline void delayMicroseconds(unsigned int us) { SIGMA_HOST_ADVANCE_US(us); }
+inline unsigned long millis() { return (unsigned long)(SIGMA_HOST_TIME_US() / 1000); }
+inline unsigned long micros() { return (unsigned long)SIGMA_HOST_TIME_US(); }
+inline void yield() {}
+
+// ========== 串口 ==========
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class HardwareSerial {
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    operator bool() const { return true; }
+
+    size_t print(const char* s) { return fputs(s, stdout) < 0 ? 0 : strlen(s); }
+    size_t print(char c) { return putchar(c) == EOF ? 0 : 1; }
+    size_t print(unsigned char n, int base = DEC) { return printNumber(n, base); }
+    size_t print(int n, int base = DEC) { return print(long(n), base); }
+    size_t print(unsigned int n, int base = DEC) { return printNumber(n, base); }
+    size_t print(long n, int base = DEC) {
+        if (base == DEC && n < 0) {
+            return print('-') + printNumber((unsigned long)(-n), base);
+        }
+        return printNumber((unsigned long)n, base);
+    }
+    size_t print(unsigned long n, int base = DEC) { return printNumber(n, base); }
+    size_t print(double n, int digits = 2) { return printf("%.*f", digits, n); }
+
+    size_t println() { return print('\n'); }
+    template <typename T>
+    size_t println(T value) { return print(value) + println(); }
+    template <typename T>
+    size_t println(T value, int format) { return print(value, format) + println(); }
+
+private:
+    size_t printNumber(unsigned long n, int base) {
+        switch (base) {
+            case HEX: return printf("%lX", n);
+            case OCT: return printf("%lo", n);
+            case BIN: {
+                char buf[sizeof(n) * 8 + 1];
+                int i = sizeof(buf) - 1;
+                buf[i] = '\0';
+                do {
+                    buf[--i] = char('0' + (n & 1));
+                    n >>= 1;
+                } while (n);
+                return print(&buf[i]);
+            }
+            default: return printf("%lu", n);
+        }
+    }
+};
+
+inline HardwareSerial Serial;
+inline HardwareSerial Serial0;
+
+#endif // __HOST_ARDUINO_H__
@@ -0,0 +1,66 @@
+#ifndef __HOST_EEPROM_H__
+#define __HOST_EEPROM_H__
+/*
+ * 主机构建用的 EEPROM 替身：内存中的字节数组，初始为擦除状态(0xFF)，
+ * 接口与 Arduino EEPROM 库的 get()/put() 一致。begin()/commit() 对应
+ * ESP32/ESP8266 的闪存模拟，这里不做任何事。
+ */
+#include "Arduino.h"
+
+#ifndef EEPROM_SIZE
+  #define EEPROM_SIZE 1024
+#endif
+
+class EEPROMClass {
+public:
+    size_t writes = 0;    // 实际改变的字节数（AVR put() 只写入变化的字节）
+
+    EEPROMClass() { erase(); }
+
+    void begin(size_t size) { (void)size; }
+    bool commit() { return true; }
+    uint16_t length() const { return EEPROM_SIZE; }
+
+    uint8_t read(int address) const {
+        return data_[address];
+    }
+
+    void write(int address, uint8_t value) {
+        if (data_[address] != value) {
+            data_[address] = value;
+            writes++;
+        }
+    }
+
+    void update(int address, uint8_t value) {
+        write(address, value);
+    }
+
+    template <typename T>
+    T& get(int address, T& value) const {
+        memcpy(&value, &data_[address], sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    const T& put(int address, const T& value) {
+        const uint8_t* p = (const uint8_t*)&value;
+        for (size_t i = 0; i < sizeof(T); i++) {
+            write(address + int(i), p[i]);
+        }
+        return value;
+    }
+
+    // 测试用：恢复擦除状态
+    void erase() {
+        memset(data_, 0xFF, sizeof(data_));
+        writes = 0;
+    }
+
+private:
+    uint8_t data_[EEPROM_SIZE];
+};
+
+inline EEPROMClass EEPROM;
+
+#endif // __HOST_EEPROM_H__
@@ -0,0 +1,98 @@
+#ifndef __HOST_FS_H__
+#define __HOST_FS_H__
+/*
+ * 主机构建用的文件系统替身：接口与 ESP32/ESP8266 的 fs::FS/fs::File 一致
+ * （LittleFS、SPIFFS、SD 共用这一套），文件放在主机上的一个目录里，
+ * 目录由 root 指定，"/dsp/a.sigi" 对应 root + "/dsp/a.sigi"。
+ * 只实现 SIGMA_RUN_IMAGE() 用到的读取接口。
+ */
+#include <memory>
+#include <string>
+#include "Arduino.h"
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class File {
+public:
+    File() {}
+
+    // 与 Arduino 的 File 一样可以复制，副本共用同一个打开的文件和计数
+    explicit File(FILE* f) : handle_(std::make_shared<Handle>(f)) {}
+
+    explicit operator bool() const { return handle_ && handle_->f; }
+
+    size_t read(uint8_t* buf, size_t size) {
+        if (!*this) {
+            return 0;
+        }
+        handle_->reads++;
+        return fread(buf, 1, size, handle_->f);
+    }
+
+    int read() {
+        uint8_t b;
+        return read(&b, 1) == 1 ? b : -1;
+    }
+
+    bool seek(uint32_t pos, SeekMode mode = SeekSet) {
+        int whence = mode == SeekSet ? SEEK_SET : mode == SeekCur ? SEEK_CUR : SEEK_END;
+        return *this && fseek(handle_->f, long(pos), whence) == 0;
+    }
+
+    size_t position() const { return *this ? size_t(ftell(handle_->f)) : 0; }
+
+    size_t size() const {
+        if (!*this) {
+            return 0;
+        }
+        long pos = ftell(handle_->f);
+        fseek(handle_->f, 0, SEEK_END);
+        long end = ftell(handle_->f);
+        fseek(handle_->f, pos, SEEK_SET);
+        return size_t(end);
+    }
+
+    int available() const { return int(size() - position()); }
+
+    void close() { handle_.reset(); }
+
+    // 测试用：调用 read(buf, size) 的次数
+    size_t reads() const { return handle_ ? handle_->reads : 0; }
+
+private:
+    struct Handle {
+        FILE* f;
+        size_t reads = 0;
+        explicit Handle(FILE* f) : f(f) {}
+        ~Handle() {
+            if (f) {
+                fclose(f);
+            }
+        }
+    };
+    std::shared_ptr<Handle> handle_;
+};
+
+class FS {
+public:
+    std::string root = ".";    // 映射为 "/" 的主机目录
+
+    bool begin(bool formatOnFail = false) { (void)formatOnFail; return true; }
+    void end() {}
+
+    File open(const char* path, const char* mode = "r") {
+        std::string m = std::string(mode) + "b";
+        return File(fopen((root + path).c_str(), m.c_str()));
+    }
+
+    bool exists(const char* path) { return bool(open(path)); }
+};
+
+}  // namespace fs
+
+using fs::File;
+using fs::FS;
+
+#endif // __HOST_FS_H__
@@ -0,0 +1,10 @@
+#ifndef __HOST_LITTLEFS_H__
+#define __HOST_LITTLEFS_H__
+/*
+ * 主机构建用的 LittleFS 替身：目录映射的 fs::FS（见 FS.h），测试中设置 LittleFS.root。
+ */
+#include "FS.h"
+
+inline fs::FS LittleFS;
+
+#endif // __HOST_LITTLEFS_H__
@@ -0,0 +1,63 @@
+#ifndef __HOST_SPI_H__
+#define __HOST_SPI_H__
+/*
+ * 主机构建用的 SPI 替身：beginTransaction()/endTransaction() 界定一次
+ * 片选周期，期间每个 transfer() 字节都交给当前总线后端。
+ * transferCalls 统计 transfer() 的调用次数（单字节和块传输各算一次），
+ * 用来检查数据是否以块传输发出。
+ */
+#include "Arduino.h"
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x04
+#define SPI_MODE2 0x08
+#define SPI_MODE3 0x0C
+
+class SPISettings {
+public:
+    constexpr SPISettings() : clock(4000000), bitOrder(MSBFIRST), dataMode(SPI_MODE0) {}
+    constexpr SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode)
+        : clock(clock), bitOrder(bitOrder), dataMode(dataMode) {}
+
+    uint32_t clock;
+    uint8_t bitOrder;
+    uint8_t dataMode;
+};
+
+class SPIClass {
+public:
+    size_t transferCalls = 0;
+
+    void begin() {}
+    void end() {}
+
+    void beginTransaction(const SPISettings& settings) {
+        SIGMA_HOST_BUS()->setClock(settings.clock);
+        SIGMA_HOST_BUS()->spiBegin();
+    }
+
+    uint8_t transfer(uint8_t data) {
+        transferCalls++;
+        return SIGMA_HOST_BUS()->spiTransfer(data);
+    }
+
+    // 原地收发，与Arduino SPI库的块传输接口一致
+    void transfer(void* buf, size_t count) {
+        transferCalls++;
+        uint8_t* p = (uint8_t*)buf;
+        for (size_t i = 0; i < count; i++) {
+            p[i] = SIGMA_HOST_BUS()->spiTransfer(p[i]);
+        }
+    }
+
+    void endTransaction() {
+        SIGMA_HOST_BUS()->spiEnd();
+    }
+};
+
+inline SPIClass SPI;
+
+#endif // __HOST_SPI_H__
@@ -0,0 +1,118 @@
+#ifndef __SIGMA_BUS_TIMING_H__
+#define __SIGMA_BUS_TIMING_H__
+/*
+ * 总线时序模型：根据记录下来的事务计算线上时间。
+ *
+ * I2C写事务：START保持 + (设备地址字节 + 子地址/数据字节) × 9位(含ACK)
+ *            + STOP建立 + 总线空闲时间(tBUF) + MCU软件间隙
+ * 不带STOP的写（读之前的地址阶段）以重复START的建立时间结束。
+ * SPI事务：片选建立 + 字节数 × 8位 + 片选保持 + 片选高电平时间 + MCU软件间隙
+ *
+ * 时序参数取自 I2C 规范 (UM10204) 各速度等级的最小值，
+ * 以及 ADAU1452 数据手册的 SPI 从机时序。
+ */
+#include "SigmaHostBus.h"
+
+struct SigmaI2CTiming {
+    uint32_t hz;
+    double tHdStaNs;    // START保持时间
+    double tSuStaNs;    // 重复START建立时间
+    double tSuStoNs;    // STOP建立时间
+    double tBufNs;      // STOP与下一个START之间的总线空闲时间
+    double mcuGapNs;    // 两个事务之间的MCU软件开销
+};
+
+struct SigmaSPITiming {
+    uint32_t hz;
+    double csSetupNs;   // 片选拉低到第一个SCLK
+    double csHoldNs;    // 最后一个SCLK到片选拉高
+    double csHighNs;    // 片选最小高电平时间
+    double mcuGapNs;
+};
+
+// 按速度等级选择I2C时序：标准模式(<=100k)、快速模式(<=400k)、快速+模式
+inline SigmaI2CTiming SIGMA_I2C_TIMING(uint32_t hz, double mcuGapNs = 0) {
+    if (hz <= 100000) {
+        return SigmaI2CTiming{hz, 4000, 4700, 4000, 4700, mcuGapNs};
+    }
+    if (hz <= 400000) {
+        return SigmaI2CTiming{hz, 600, 600, 600, 1300, mcuGapNs};
+    }
+    return SigmaI2CTiming{hz, 260, 260, 260, 500, mcuGapNs};
+}
+
+inline SigmaSPITiming SIGMA_SPI_TIMING(uint32_t hz, double mcuGapNs = 0) {
+    return SigmaSPITiming{hz, 10, 10, 10, mcuGapNs};
+}
+
+inline double SIGMA_I2C_TRANSACTION_NS(const SigmaBusTransaction& t, const SigmaI2CTiming& tm) {
+    double bitNs = 1e9 / tm.hz;
+    double bits = 9.0 * (1 + t.data.size());
+    double ns = tm.tHdStaNs + bits * bitNs;
+    if (t.kind == SIGMA_BUS_I2C_WRITE && !t.sendStop) {
+        return ns + tm.tSuStaNs;
+    }
+    return ns + tm.tSuStoNs + tm.tBufNs + tm.mcuGapNs;
+}
+
+inline double SIGMA_SPI_TRANSACTION_NS(const SigmaBusTransaction& t, const SigmaSPITiming& tm) {
+    double bitNs = 1e9 / tm.hz;
+    return tm.csSetupNs + 8.0 * t.data.size() * bitNs + tm.csHoldNs + tm.csHighNs + tm.mcuGapNs;
+}
+
+// 整个事务序列的线上时间（纳秒），按各事务自身的总线类型计算
+inline double SIGMA_BUS_WIRE_NS(const std::vector<SigmaBusTransaction>& log, size_t first, size_t last,
+                                const SigmaI2CTiming& i2c, const SigmaSPITiming& spi) {
+    double ns = 0;
+    for (size_t i = first; i < last && i < log.size(); i++) {
+        if (log[i].kind == SIGMA_BUS_SPI) {
+            ns += SIGMA_SPI_TRANSACTION_NS(log[i], spi);
+        }
+        else {
+            ns += SIGMA_I2C_TRANSACTION_NS(log[i], i2c);
+        }
+    }
+    return ns;
+}
+
+// ========== 占用线上时间的后端 ==========
+// 记录事务，并按事务时的总线时钟把虚拟时钟推进该事务的线上时间：与MCU上阻塞的
+// Wire/SPI 一样，发送期间程序不能做别的事。用于测量包括线上时间在内的启动耗时。
+class SigmaBusTimed : public SigmaBusRecorder {
+public:
+    double mcuGapNs = 0;
+
+    uint8_t i2cWrite(uint8_t devAddress, const uint8_t* data, size_t length, bool sendStop) override {
+        uint8_t status = SigmaBusRecorder::i2cWrite(devAddress, data, length, sendStop);
+        occupy(SIGMA_I2C_TRANSACTION_NS(log.back(), SIGMA_I2C_TIMING(log.back().clock, mcuGapNs)));
+        return status;
+    }
+
+    size_t i2cRead(uint8_t devAddress, uint8_t* data, size_t length) override {
+        size_t received = SigmaBusRecorder::i2cRead(devAddress, data, length);
+        occupy(SIGMA_I2C_TRANSACTION_NS(log.back(), SIGMA_I2C_TIMING(log.back().clock, mcuGapNs)));
+        return received;
+    }
+
+    void spiEnd() override {
+        SigmaBusRecorder::spiEnd();
+        occupy(SIGMA_SPI_TRANSACTION_NS(log.back(), SIGMA_SPI_TIMING(log.back().clock, mcuGapNs)));
+    }
+
+    // 已计入虚拟时钟的线上时间（纳秒）
+    double busyNs() const { return busyNs_; }
+
+private:
+    double busyNs_ = 0;
+    double pendingNs_ = 0;    // 不足1微秒的部分
+
+    void occupy(double ns) {
+        busyNs_ += ns;
+        pendingNs_ += ns;
+        uint64_t us = uint64_t(pendingNs_ / 1000);
+        pendingNs_ -= double(us) * 1000;
+        SIGMA_HOST_ADVANCE_US(us);
+    }
+};
+
+#endif // __SIGMA_BUS_TIMING_H__
@@ -0,0 +1,327 @@
+#ifndef __SIGMA_DSP_EMULATOR_H__
+#define __SIGMA_DSP_EMULATOR_H__
+/*
+ * ADAU1452 地址空间的软件模型，作为总线后端接收 SigmaStudioFW.h 的流量。
+ *
+ *   0x0000 - 0x5FFF  DM0 数据内存（参数从0开始），4字节/字
+ *   0x6000 - 0xBFFF  DM1 数据内存，4字节/字
+ *   0xC000 - 0xEFFF  程序内存，4字节/字
+ *   0xF000 - 0xFFFF  控制寄存器，2字节/字
+ *
+ * 与 getMemoryDepth() 的假设一致。写入时每凑满一个字就提交并把地址加1，
+ * 不足一个字的尾部字节被丢弃并计数（与硬件行为一致）。
+ *
+ * 状态寄存器按虚拟时钟建模：PLL_ENABLE 置1后经过 pllLockUs 微秒 PLL_LOCK
+ * 才读到1；START_CORE 置1后 CORE_STATUS 读到1（运行）。
+ * selfBoot() 模拟从自启动EEPROM加载：只执行EEPROM中的事务，不模拟其字节格式。
+ * maxClock 模拟线束能承受的最高时钟：更快的总线时钟下写入和读回的数据字节出现位错误，
+ * 子地址字节也会出错（写入落到别的地址，读取读到别的地址），SPI命令字节的读/写位翻转
+ * （读取变成把MOSI上的字节写到错位的地址）。
+ * SPI接口按硬件建模：hardwareReset() 后处于I2C模式，片选拉低三次后才接收SPI事务。
+ * directWrite()/directRead() 不经总线访问，供 SigmaEmulatorTransport（SigmaTransports.h）使用。
+ */
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "SigmaHostBus.h"
+#include "SigmaTxBuffer.h"
+
+#define SIGMA_EMU_DM0_ADDR       0x0000
+#define SIGMA_EMU_DM1_ADDR       0x6000
+#define SIGMA_EMU_PROGRAM_ADDR   0xC000
+#define SIGMA_EMU_REGISTER_ADDR  0xF000
+
+#define SIGMA_EMU_PLL_ENABLE     0xF003
+#define SIGMA_EMU_PLL_LOCK       0xF004
+#define SIGMA_EMU_START_CORE     0xF402
+#define SIGMA_EMU_CORE_STATUS    0xF405
+
+class SigmaDspEmulator : public SigmaBusBackend {
+public:
+    // 事务统计
+    size_t writeTransactions = 0;
+    size_t readTransactions = 0;
+    size_t wordsWritten = 0;
+    size_t partialWords = 0;      // 被丢弃的不完整字
+    size_t nacks = 0;             // 地址不匹配的事务
+
+    uint64_t pllLockUs = 3000;    // PLL使能到锁定的时间
+    bool spiMode = true;          // false：I2C模式，SPI事务被忽略
+    uint32_t maxClock = 0;        // 超过此总线时钟时数据出错，0 不限制
+
+    explicit SigmaDspEmulator(uint8_t devAddress = 0x3B)
+        : devAddress_(devAddress), mem_(size_t(0x10000) * 4, 0) {}
+
+    static uint8_t wordWidth(uint16_t address) {
+        return address < SIGMA_EMU_REGISTER_ADDR ? 4 : 2;
+    }
+
+    uint8_t devAddress() const { return devAddress_; }
+
+    // 按字宽把 address 开始的内容展开为字节流（与总线读取相同的格式）
+    void readMemory(uint16_t address, uint8_t* out, size_t length) const {
+        uint32_t addr = address;
+        size_t pos = 0;
+        while (pos < length) {
+            uint8_t width = wordWidth(uint16_t(addr));
+            for (uint8_t i = 0; i < width && pos < length; i++) {
+                out[pos++] = mem_[size_t(addr & 0xFFFF) * 4 + i];
+            }
+            addr++;
+        }
+    }
+
+    std::vector<uint8_t> readMemory(uint16_t address, size_t length) const {
+        std::vector<uint8_t> out(length);
+        readMemory(address, out.data(), length);
+        return out;
+    }
+
+    // 与期望内容比较，返回第一个不同字节的偏移；完全相同时返回 length
+    size_t compare(uint16_t address, const uint8_t* expected, size_t length) const {
+        std::vector<uint8_t> actual = readMemory(address, length);
+        for (size_t i = 0; i < length; i++) {
+            if (actual[i] != expected[i]) {
+                return i;
+            }
+        }
+        return length;
+    }
+
+    uint16_t registerValue(uint16_t address) const {
+        const uint8_t* p = &mem_[size_t(address) * 4];
+        return uint16_t((p[0] << 8) | p[1]);
+    }
+
+    // 直接写入（不经过总线，不计入统计），用于测试准备初始状态
+    void poke(uint16_t address, const uint8_t* data, size_t length) {
+        storeBytes(address, data, length);
+    }
+
+    // 不经总线后端的一次写入/读取（SigmaEmulatorTransport 用），计入事务统计，寄存器经过钩子
+    void directWrite(uint16_t address, const uint8_t* data, size_t length) {
+        writeTransactions++;
+        storeBytes(address, data, length);
+    }
+
+    void directRead(uint16_t address, uint8_t* out, size_t length) {
+        readTransactions++;
+        loadBytes(address, out, length);
+    }
+
+    // 模拟 SELFBOOT 引脚为高时的上电：DSP按顺序执行EEPROM中的事务（SigmaStudio 写入
+    // EEPROM的内容，这里用导出的下载序列代替），延迟推进虚拟时钟。EEPROM为空时传入空序列
+    void selfBoot(const std::vector<SigmaTxEntry>& entries) {
+        for (const SigmaTxEntry& e : entries) {
+            if (e.isDelay()) {
+                SIGMA_HOST_ADVANCE_US(uint64_t((e.data[0] << 8) | e.data[1]) * 1000);
+            }
+            else {
+                storeBytes(e.address, e.data.data(), e.data.size());
+            }
+        }
+    }
+
+    void clear() {
+        std::fill(mem_.begin(), mem_.end(), 0);
+        writeTransactions = readTransactions = wordsWritten = partialWords = nacks = 0;
+        pllEnabled_ = false;
+    }
+
+    // 复位脚拉低再释放：内存清零，回到I2C模式
+    void hardwareReset() {
+        clear();
+        spiMode = false;
+        spiSelects_ = 0;
+    }
+
+    // ========== SigmaBusBackend ==========
+    uint8_t i2cWrite(uint8_t devAddress, const uint8_t* data, size_t length, bool sendStop) override {
+        (void)sendStop;
+        if (devAddress != devAddress_) {
+            nacks++;
+            return 2;
+        }
+        writeTransactions++;
+        if (length < 2) {
+            return 0;
+        }
+        uint8_t subAddress[2] = {data[0], data[1]};
+        garble(subAddress, 2, 0x01);
+        pointer_ = uint16_t((subAddress[0] << 8) | subAddress[1]);
+        std::vector<uint8_t> payload(data + 2, data + length);
+        garble(payload.data(), payload.size(), 0x01);
+        storeBytes(pointer_, payload.data(), payload.size());
+        return 0;
+    }
+
+    size_t i2cRead(uint8_t devAddress, uint8_t* data, size_t length) override {
+        if (devAddress != devAddress_) {
+            nacks++;
+            return 0;
+        }
+        readTransactions++;
+        loadBytes(pointer_, data, length);
+        garble(data, length, 0x80);
+        return length;
+    }
+
+    // SPI：第1字节为 R/!W 命令，第2、3字节为地址，其后为数据
+    // I2C模式下第三次片选拉低切换到SPI，这三次的内容都被忽略
+    void spiBegin() override {
+        spiCount_ = 0;
+        spiWrite_.clear();
+        spiIgnored_ = !spiMode;
+        if (!spiMode && ++spiSelects_ >= 3) {
+            spiMode = true;
+        }
+    }
+
+    uint8_t spiTransfer(uint8_t data) override {
+        uint8_t out = 0;
+        if (spiIgnored_) {
+            return out;
+        }
+        if (spiCount_ == 0) {
+            garble(&data, 1, 0x01);    // 读/!写位出错时读取变成写入
+            spiRead_ = data & 0x01;
+        }
+        else if (spiCount_ == 1) {
+            garble(&data, 1, 0x01);
+            pointer_ = uint16_t(data << 8);
+        }
+        else if (spiCount_ == 2) {
+            garble(&data, 1, 0x01);
+            pointer_ |= data;
+            spiReadAddr_ = pointer_;
+            spiReadOffset_ = 0;
+        }
+        else if (spiRead_) {
+            out = nextReadByte(spiReadAddr_, spiReadOffset_);
+            garble(&out, 1, 0x80);
+        }
+        else {
+            garble(&data, 1, 0x01);
+            spiWrite_.push_back(data);
+        }
+        spiCount_++;
+        return out;
+    }
+
+    void spiEnd() override {
+        if (spiIgnored_ || spiCount_ < 3) {
+            return;
+        }
+        if (spiRead_) {
+            readTransactions++;
+        }
+        else {
+            writeTransactions++;
+            storeBytes(pointer_, spiWrite_.data(), spiWrite_.size());
+        }
+    }
+
+    void setClock(uint32_t hz) override {
+        clock_ = hz;
+    }
+
+protected:
+    // 寄存器写入钩子，子类可模拟更多副作用（覆盖时应调用基类以保留状态模型）
+    virtual void onRegisterWrite(uint16_t address, uint16_t value) {
+        if (address == SIGMA_EMU_PLL_ENABLE) {
+            pllEnabled_ = (value & 0x0001) != 0;
+            pllEnabledUs_ = SIGMA_HOST_TIME_US();
+        }
+    }
+
+    // 寄存器读取钩子，状态寄存器按模型计算，其余返回存储值
+    virtual uint16_t onRegisterRead(uint16_t address) {
+        if (address == SIGMA_EMU_PLL_LOCK) {
+            return pllEnabled_ && SIGMA_HOST_TIME_US() - pllEnabledUs_ >= pllLockUs ? 0x0001 : 0x0000;
+        }
+        if (address == SIGMA_EMU_CORE_STATUS) {
+            return registerValue(SIGMA_EMU_START_CORE) & 0x0001;
+        }
+        return registerValue(address);
+    }
+
+    void storeWord(uint16_t address, const uint8_t* word) {
+        uint8_t width = wordWidth(address);
+        memcpy(&mem_[size_t(address) * 4], word, width);
+        wordsWritten++;
+        if (width == 2) {
+            onRegisterWrite(address, uint16_t((word[0] << 8) | word[1]));
+        }
+    }
+
+private:
+    uint8_t devAddress_;
+    std::vector<uint8_t> mem_;
+    uint16_t pointer_ = 0;
+    bool pllEnabled_ = false;
+    uint64_t pllEnabledUs_ = 0;
+    size_t spiCount_ = 0;
+    bool spiRead_ = false;
+    bool spiIgnored_ = false;
+    uint32_t clock_ = 0;
+    int spiSelects_ = 0;
+    uint16_t spiReadAddr_ = 0;
+    uint8_t spiReadOffset_ = 0;
+    std::vector<uint8_t> spiWrite_;
+
+    bool tooFast() const {
+        return maxClock && clock_ > maxClock;
+    }
+
+    // 时钟过快时数据字节翻转一位（写入和读回翻转不同的位，读回不会恰好抵消）
+    void garble(uint8_t* data, size_t length, uint8_t bit) {
+        if (!tooFast()) {
+            return;
+        }
+        for (size_t i = 0; i < length; i++) {
+            data[i] ^= bit;
+        }
+    }
+
+    void storeBytes(uint16_t address, const uint8_t* data, size_t length) {
+        uint32_t addr = address;
+        size_t pos = 0;
+        while (pos < length) {
+            uint8_t width = wordWidth(uint16_t(addr));
+            if (length - pos < width) {
+                partialWords++;
+                break;
+            }
+            storeWord(uint16_t(addr), data + pos);
+            pos += width;
+            addr = (addr + 1) & 0xFFFF;
+        }
+    }
+
+    // 读游标：依次返回按字宽展开的字节，寄存器经过 onRegisterRead()
+    uint8_t nextReadByte(uint16_t& address, uint8_t& offset) {
+        uint8_t width = wordWidth(address);
+        uint8_t out;
+        if (width == 2) {
+            uint16_t v = onRegisterRead(address);
+            out = offset == 0 ? uint8_t(v >> 8) : uint8_t(v);
+        }
+        else {
+            out = mem_[size_t(address) * 4 + offset];
+        }
+        if (++offset == width) {
+            offset = 0;
+            address = uint16_t(address + 1);
+        }
+        return out;
+    }
+
+    void loadBytes(uint16_t address, uint8_t* out, size_t length) {
+        uint8_t offset = 0;
+        for (size_t i = 0; i < length; i++) {
+            out[i] = nextReadByte(address, offset);
+        }
+    }
+};
+
+#endif // __SIGMA_DSP_EMULATOR_H__
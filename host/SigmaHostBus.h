@@ -0,0 +1,337 @@
+#ifndef __SIGMA_HOST_BUS_H__
+#define __SIGMA_HOST_BUS_H__
+/*
+ * 主机（Linux）构建用的总线后端。
+ *
+ * host/ 目录下的 Arduino.h、Wire.h、SPI.h 只是最小化的替身，它们把所有
+ * 总线流量转发给这里的 SigmaBusBackend。默认后端是 SigmaBusRecorder，
+ * 它把每个事务完整记录下来，便于在 perf/valgrind 下分析 SigmaStudioFW.h。
+ *
+ * 主机上没有真实的时间流逝：delay()/millis()/micros() 都基于一个虚拟
+ * 时钟，后端也可以按自己的总线模型推进它。
+ */
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <vector>
+
+// ========== 虚拟时钟 ==========
+inline uint64_t g_sigma_host_time_us = 0;
+
+inline uint64_t SIGMA_HOST_TIME_US() {
+    return g_sigma_host_time_us;
+}
+
+inline void SIGMA_HOST_ADVANCE_US(uint64_t us) {
+    g_sigma_host_time_us += us;
+}
+
+// ========== 总线后端接口 ==========
+class SigmaBusBackend {
+public:
+    virtual ~SigmaBusBackend() {}
+
+    // 一次完整的I2C写事务（START + 设备地址 + data + STOP/重复START）。
+    // 返回值与 Wire.endTransmission() 相同：0=成功，2=地址NACK，3=数据NACK...
+    virtual uint8_t i2cWrite(uint8_t devAddress, const uint8_t* data, size_t length, bool sendStop) = 0;
+
+    // 一次I2C读事务，返回实际读到的字节数。
+    virtual size_t i2cRead(uint8_t devAddress, uint8_t* data, size_t length) = 0;
+
+    // SPI事务：spiBegin() 对应片选拉低，spiEnd() 对应片选拉高，
+    // 中间每个字节全双工交换一次。
+    virtual void spiBegin() = 0;
+    virtual uint8_t spiTransfer(uint8_t data) = 0;
+    virtual void spiEnd() = 0;
+
+    // 总线时钟变化通知（Wire.setClock()/SPISettings）
+    virtual void setClock(uint32_t hz) { (void)hz; }
+};
+
+// ========== 记录型后端 ==========
+enum SigmaBusKind : uint8_t {
+    SIGMA_BUS_I2C_WRITE = 0,
+    SIGMA_BUS_I2C_READ  = 1,
+    SIGMA_BUS_SPI       = 2
+};
+
+struct SigmaBusTransaction {
+    uint8_t kind;                 // SigmaBusKind
+    uint8_t devAddress;           // I2C 7位地址；SPI时为0
+    bool sendStop;                // I2C写是否以STOP结束
+    uint32_t clock;               // 事务发生时的总线时钟
+    uint64_t timeUs;              // 事务开始时的虚拟时钟
+    std::vector<uint8_t> data;    // 线上字节（不含I2C设备地址字节）
+};
+
+// 可选的 target 后端接收同样的流量并提供读回数据（如 SigmaDspEmulator），
+// 没有 target 时写入总是成功、读回全零。
+class SigmaBusRecorder : public SigmaBusBackend {
+public:
+    std::vector<SigmaBusTransaction> log;
+    uint32_t clock = 0;
+    SigmaBusBackend* target = nullptr;
+
+    void clear() { log.clear(); }
+
+    uint8_t i2cWrite(uint8_t devAddress, const uint8_t* data, size_t length, bool sendStop) override {
+        SigmaBusTransaction t;
+        t.kind = SIGMA_BUS_I2C_WRITE;
+        t.devAddress = devAddress;
+        t.sendStop = sendStop;
+        t.clock = clock;
+        t.timeUs = SIGMA_HOST_TIME_US();
+        t.data.assign(data, data + length);
+        log.push_back(t);
+        return target ? target->i2cWrite(devAddress, data, length, sendStop) : 0;
+    }
+
+    size_t i2cRead(uint8_t devAddress, uint8_t* data, size_t length) override {
+        memset(data, 0, length);
+        if (target) {
+            length = target->i2cRead(devAddress, data, length);
+        }
+        SigmaBusTransaction t;
+        t.kind = SIGMA_BUS_I2C_READ;
+        t.devAddress = devAddress;
+        t.sendStop = true;
+        t.clock = clock;
+        t.timeUs = SIGMA_HOST_TIME_US();
+        t.data.assign(data, data + length);
+        log.push_back(t);
+        return length;
+    }
+
+    void spiBegin() override {
+        SigmaBusTransaction t;
+        t.kind = SIGMA_BUS_SPI;
+        t.devAddress = 0;
+        t.sendStop = true;
+        t.clock = clock;
+        t.timeUs = SIGMA_HOST_TIME_US();
+        log.push_back(t);
+        if (target) {
+            target->spiBegin();
+        }
+    }
+
+    uint8_t spiTransfer(uint8_t data) override {
+        if (!log.empty()) {
+            log.back().data.push_back(data);
+        }
+        return target ? target->spiTransfer(data) : 0;
+    }
+
+    void spiEnd() override {
+        if (target) {
+            target->spiEnd();
+        }
+    }
+
+    void setClock(uint32_t hz) override {
+        clock = hz;
+        if (target) {
+            target->setClock(hz);
+        }
+    }
+
+    // 写事务数量
+    size_t writeCount() const {
+        size_t n = 0;
+        for (const SigmaBusTransaction& t : log) {
+            if (t.kind != SIGMA_BUS_I2C_READ) n++;
+        }
+        return n;
+    }
+
+    // 写事务中的有效数据字节（去掉子地址/SPI命令头）
+    size_t payloadBytes() const {
+        size_t n = 0;
+        for (const SigmaBusTransaction& t : log) {
+            size_t header = (t.kind == SIGMA_BUS_SPI) ? 3 : 2;
+            if (t.kind != SIGMA_BUS_I2C_READ && t.data.size() > header) {
+                n += t.data.size() - header;
+            }
+        }
+        return n;
+    }
+
+    // 线上的全部字节（I2C写计入设备地址字节）
+    size_t wireBytes() const {
+        size_t n = 0;
+        for (const SigmaBusTransaction& t : log) {
+            n += t.data.size() + (t.kind == SIGMA_BUS_SPI ? 0 : 1);
+        }
+        return n;
+    }
+};
+
+// ========== 计数型后端 ==========
+// 只统计事务和字节数，不保存内容，开销足够低，适合做基准测试。
+// target 的含义与 SigmaBusRecorder 相同。
+class SigmaBusCounter : public SigmaBusBackend {
+public:
+    size_t transactions = 0;
+    size_t payloadBytes = 0;      // 数据字节（写入的数据或读回的数据）
+    size_t overheadBytes = 0;     // 设备地址、子地址、SPI命令字节
+    SigmaBusBackend* target = nullptr;
+
+    void reset() { transactions = payloadBytes = overheadBytes = 0; }
+
+    uint8_t i2cWrite(uint8_t devAddress, const uint8_t* data, size_t length, bool sendStop) override {
+        size_t header = length < 2 ? length : 2;
+        transactions++;
+        overheadBytes += 1 + header;
+        payloadBytes += length - header;
+        return target ? target->i2cWrite(devAddress, data, length, sendStop) : 0;
+    }
+
+    size_t i2cRead(uint8_t devAddress, uint8_t* data, size_t length) override {
+        transactions++;
+        overheadBytes += 1;
+        payloadBytes += length;
+        memset(data, 0, length);
+        return target ? target->i2cRead(devAddress, data, length) : length;
+    }
+
+    void spiBegin() override {
+        transactions++;
+        spiCount_ = 0;
+        if (target) {
+            target->spiBegin();
+        }
+    }
+
+    uint8_t spiTransfer(uint8_t data) override {
+        if (spiCount_++ < 3) {
+            overheadBytes++;
+        }
+        else {
+            payloadBytes++;
+        }
+        return target ? target->spiTransfer(data) : 0;
+    }
+
+    void spiEnd() override {
+        if (target) {
+            target->spiEnd();
+        }
+    }
+
+    void setClock(uint32_t hz) override {
+        if (target) {
+            target->setClock(hz);
+        }
+    }
+
+private:
+    size_t spiCount_ = 0;
+};
+
+// ========== 故障注入后端 ==========
+// 把流量转发给 target，并按设定让部分I2C写事务失败（不转发，返回 failStatus），
+// 用于测试重试和从失败处继续下载。写事务从0开始编号，含失败的事务。
+class SigmaBusFaultInjector : public SigmaBusBackend {
+public:
+    SigmaBusBackend* target = nullptr;
+    size_t failEvery = 0;         // 每第N个写事务失败一次，0 关闭
+    size_t failAt = 0;            // 从第 failAt 个写事务起连续失败 failBurst 次
+    size_t failBurst = 0;
+    uint8_t failStatus = 3;       // Wire.endTransmission() 的数据NACK
+    size_t writes = 0;
+    size_t injected = 0;
+
+    void reset() {
+        writes = injected = 0;
+    }
+
+    uint8_t i2cWrite(uint8_t devAddress, const uint8_t* data, size_t length, bool sendStop) override {
+        size_t n = writes++;
+        if ((failEvery && (n + 1) % failEvery == 0) || (n >= failAt && n < failAt + failBurst)) {
+            injected++;
+            return failStatus;
+        }
+        return target ? target->i2cWrite(devAddress, data, length, sendStop) : 0;
+    }
+
+    size_t i2cRead(uint8_t devAddress, uint8_t* data, size_t length) override {
+        memset(data, 0, length);
+        return target ? target->i2cRead(devAddress, data, length) : length;
+    }
+
+    void spiBegin() override {
+        if (target) {
+            target->spiBegin();
+        }
+    }
+
+    uint8_t spiTransfer(uint8_t data) override {
+        return target ? target->spiTransfer(data) : 0;
+    }
+
+    void spiEnd() override {
+        if (target) {
+            target->spiEnd();
+        }
+    }
+
+    void setClock(uint32_t hz) override {
+        if (target) {
+            target->setClock(hz);
+        }
+    }
+};
+
+// ========== 共享总线 ==========
+// 一条I2C总线上挂几个设备（如地址不同的 SigmaDspEmulator）：每个事务交给所有设备，
+// 地址匹配的那个应答。没有设备应答时写入返回 2（地址NACK），读取返回 0。
+// SPI设备各有片选，不在这里共享，SPI事务被丢弃。
+class SigmaBusShared : public SigmaBusBackend {
+public:
+    std::vector<SigmaBusBackend*> devices;
+
+    uint8_t i2cWrite(uint8_t devAddress, const uint8_t* data, size_t length, bool sendStop) override {
+        uint8_t status = 2;
+        for (SigmaBusBackend* device : devices) {
+            if (device->i2cWrite(devAddress, data, length, sendStop) == 0) {
+                status = 0;
+            }
+        }
+        return status;
+    }
+
+    size_t i2cRead(uint8_t devAddress, uint8_t* data, size_t length) override {
+        size_t received = 0;
+        for (SigmaBusBackend* device : devices) {
+            size_t n = device->i2cRead(devAddress, data, length);
+            if (!received) {
+                received = n;
+            }
+        }
+        return received;
+    }
+
+    void spiBegin() override {}
+    uint8_t spiTransfer(uint8_t data) override { (void)data; return 0; }
+    void spiEnd() override {}
+
+    void setClock(uint32_t hz) override {
+        for (SigmaBusBackend* device : devices) {
+            device->setClock(hz);
+        }
+    }
+};
+
+// ========== 当前后端 ==========
+inline SigmaBusRecorder g_sigma_host_default_bus;
+inline SigmaBusBackend* g_sigma_host_bus = &g_sigma_host_default_bus;
+
+inline void SIGMA_HOST_SET_BUS(SigmaBusBackend* bus) {
+    g_sigma_host_bus = bus ? bus : &g_sigma_host_default_bus;
+}
+
+inline SigmaBusBackend* SIGMA_HOST_BUS() {
+    return g_sigma_host_bus;
+}
+
+#endif // __SIGMA_HOST_BUS_H__
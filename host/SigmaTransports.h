@@ -0,0 +1,150 @@
+#ifndef __SIGMA_TRANSPORTS_H__
+#define __SIGMA_TRANSPORTS_H__
+/*
+ * 主机测试用的传输类（接口见 SigmaStudioFW.h 的"传输策略"），不经过 Wire/SPI 替身和总线后端：
+ *
+ *   SigmaRecordingTransport<Id>   记录每个写入/读取操作的地址和数据，读回全零
+ *   SigmaEmulatorTransport<&dsp>  直接读写一个 SigmaDspEmulator 的地址空间
+ *
+ * 两者都有应答（ACKED）且不限制事务长度：一次写入就是一个操作，不按I2C突发或SPI步长
+ * 切分，适合检查写入引擎本身（计划器合并、序列、镜像）的行为。Id 区分互相独立的记录器。
+ * 在 SigmaStudioFW.h 之后包含。
+ */
+#include <string.h>
+#include <vector>
+#include "SigmaDspEmulator.h"
+
+struct SigmaTransportOp {
+    bool read;
+    uint32_t address;
+    std::vector<uint8_t> data;
+};
+
+template <int Id = 0>
+struct SigmaRecordingTransport {
+    static constexpr bool ACKED = true;
+    static constexpr int PLAN_BYTES = SIGMA_PLAN_BUFFER_SIZE;
+
+    static std::vector<SigmaTransportOp>& log() {
+        static std::vector<SigmaTransportOp> ops;
+        return ops;
+    }
+
+    static void begin() {}
+
+    // 没有总线时钟，只记下设置的值
+    static void setClock(uint32_t hz) { speed() = hz; }
+    static uint32_t clock() { return speed(); }
+
+    static uint32_t& speed() {
+        static uint32_t hz = 0;
+        return hz;
+    }
+
+    static int chunkLength(uint32_t address, int remaining, int total, int limit = SIGMA_STEP_UNLIMITED) {
+        (void)total;
+        return SIGMA_STEP_LENGTH(address, remaining, limit);
+    }
+
+    static void open(uint32_t address) {
+        log().push_back(SigmaTransportOp{false, address, {}});
+    }
+
+    static void put(const uint8_t* data, int length) {
+        log().back().data.insert(log().back().data.end(), data, data + length);
+    }
+
+    static uint8_t close(int length) {
+        SIGMA_TIMING_BUS(length);
+        return SIGMA_SUCCESS;
+    }
+
+    // 主机上闪存与RAM是同一地址空间，progmem 无需区分
+    static uint8_t write(uint32_t address, const uint8_t* data, int length, bool progmem) {
+        (void)progmem;
+        open(address);
+        put(data, length);
+        return close(length);
+    }
+
+    static uint8_t writeZeros(uint32_t address, int length) {
+        open(address);
+        log().back().data.assign(size_t(length), 0);
+        return close(length);
+    }
+
+    static uint8_t read(uint32_t address, uint8_t* data, int length) {
+        memset(data, 0, size_t(length));
+        log().push_back(SigmaTransportOp{true, address, std::vector<uint8_t>(data, data + length)});
+        SIGMA_TIMING_BUS(length);
+        return SIGMA_SUCCESS;
+    }
+};
+
+template <SigmaDspEmulator* Emu>
+struct SigmaEmulatorTransport {
+    static constexpr bool ACKED = true;
+    static constexpr int PLAN_BYTES = SIGMA_PLAN_BUFFER_SIZE;
+
+    static void begin() {}
+
+    // 没有总线时钟，只记下设置的值
+    static void setClock(uint32_t hz) { speed() = hz; }
+    static uint32_t clock() { return speed(); }
+
+    static uint32_t& speed() {
+        static uint32_t hz = 0;
+        return hz;
+    }
+
+    static int chunkLength(uint32_t address, int remaining, int total, int limit = SIGMA_STEP_UNLIMITED) {
+        (void)total;
+        return SIGMA_STEP_LENGTH(address, remaining, limit);
+    }
+
+    // open()/put() 攒下的写入，close() 时一次交给模型
+    static std::vector<uint8_t>& pending() {
+        static std::vector<uint8_t> data;
+        return data;
+    }
+
+    static uint32_t& pendingAddress() {
+        static uint32_t address = 0;
+        return address;
+    }
+
+    static void open(uint32_t address) {
+        pendingAddress() = address;
+        pending().clear();
+    }
+
+    static void put(const uint8_t* data, int length) {
+        pending().insert(pending().end(), data, data + length);
+    }
+
+    static uint8_t close(int length) {
+        Emu->directWrite(uint16_t(pendingAddress()), pending().data(), pending().size());
+        SIGMA_TIMING_BUS(length);
+        return SIGMA_SUCCESS;
+    }
+
+    static uint8_t write(uint32_t address, const uint8_t* data, int length, bool progmem) {
+        (void)progmem;
+        Emu->directWrite(uint16_t(address), data, size_t(length));
+        SIGMA_TIMING_BUS(length);
+        return SIGMA_SUCCESS;
+    }
+
+    static uint8_t writeZeros(uint32_t address, int length) {
+        std::vector<uint8_t> zeros(size_t(length), 0);
+        return write(address, zeros.data(), length, false);
+    }
+
+    static uint8_t read(uint32_t address, uint8_t* data, int length) {
+        Emu->directRead(uint16_t(address), data, size_t(length));
+        SIGMA_TIMING_BUS(length);
+        return SIGMA_SUCCESS;
+    }
+};
+
+#endif // __SIGMA_TRANSPORTS_H__
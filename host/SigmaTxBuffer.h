@@ -0,0 +1,121 @@
+#ifndef __SIGMA_TX_BUFFER_H__
+#define __SIGMA_TX_BUFFER_H__
+/*
+ * 读取 SigmaStudio 导出的 TxBuffer_IC_x.dat / NumBytes_IC_x.dat。
+ *
+ * NumBytes 每行是一个逻辑事务的字节数（含2字节地址），TxBuffer 按顺序
+ * 给出所有字节，并在每个事务的首行用 "(n) IC 1.NAME" 注释标出名称。
+ * 延迟事务的地址为0，名称以 "Delay" 结尾。
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+// 导出文件所在目录，由构建系统定义
+#ifndef SIGMA_EXPORT_DIR
+  #define SIGMA_EXPORT_DIR "."
+#endif
+
+struct SigmaTxEntry {
+    uint16_t address;
+    std::vector<uint8_t> data;    // 不含2字节地址
+    std::string name;
+
+    bool isDelay() const {
+        return name.size() >= 5 && name.compare(name.size() - 5, 5, "Delay") == 0;
+    }
+};
+
+inline bool SIGMA_READ_TEXT_FILE(const std::string& path, std::string& out) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) {
+        return false;
+    }
+    char buf[4096];
+    size_t n;
+    out.clear();
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+        out.append(buf, n);
+    }
+    fclose(f);
+    return true;
+}
+
+// 载入 dir 下 IC 的导出序列，失败返回false
+inline bool SIGMA_LOAD_TX_BUFFER(const std::string& dir, int ic, std::vector<SigmaTxEntry>& entries) {
+    std::string numText, txText;
+    std::string suffix = "_IC_" + std::to_string(ic) + ".dat";
+    if (!SIGMA_READ_TEXT_FILE(dir + "/NumBytes" + suffix, numText) ||
+        !SIGMA_READ_TEXT_FILE(dir + "/TxBuffer" + suffix, txText)) {
+        return false;
+    }
+
+    std::vector<size_t> sizes;
+    const char* p = numText.c_str();
+    while (*p) {
+        char* end;
+        unsigned long v = strtoul(p, &end, 0);
+        if (end == p) {
+            p++;
+            continue;
+        }
+        sizes.push_back(v);
+        p = end;
+    }
+
+    // 字节和名称分别按出现顺序收集
+    std::vector<uint8_t> bytes;
+    std::vector<std::string> names;
+    p = txText.c_str();
+    while (*p) {
+        if (p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+            char* end;
+            bytes.push_back(uint8_t(strtoul(p, &end, 16)));
+            p = end;
+        }
+        else if (p[0] == '/' && p[1] == '*') {
+            const char* close = strstr(p, "*/");
+            if (!close) {
+                break;
+            }
+            std::string comment(p + 2, close);
+            // "(n) IC 1.NAME" 或 "(n) Program Data"
+            size_t paren = comment.find(')');
+            std::string name = comment.substr(paren == std::string::npos ? 0 : paren + 1);
+            while (!name.empty() && name.front() == ' ') {
+                name.erase(0, 1);
+            }
+            if (name.compare(0, 3, "IC ") == 0 && name.find('.') != std::string::npos) {
+                name.erase(0, name.find('.') + 1);
+            }
+            while (!name.empty() && name.back() == ' ') {
+                name.pop_back();
+            }
+            names.push_back(name);
+            p = close + 2;
+        }
+        else {
+            p++;
+        }
+    }
+
+    entries.clear();
+    size_t pos = 0;
+    for (size_t i = 0; i < sizes.size(); i++) {
+        if (sizes[i] < 2 || pos + sizes[i] > bytes.size()) {
+            return false;
+        }
+        SigmaTxEntry e;
+        e.address = uint16_t((bytes[pos] << 8) | bytes[pos + 1]);
+        e.data.assign(bytes.begin() + pos + 2, bytes.begin() + pos + sizes[i]);
+        e.name = i < names.size() ? names[i] : std::string();
+        entries.push_back(e);
+        pos += sizes[i];
+    }
+    return pos == bytes.size();
+}
+
+#endif // __SIGMA_TX_BUFFER_H__
@@ -0,0 +1,106 @@
+#ifndef __HOST_WIRE_H__
+#define __HOST_WIRE_H__
+/*
+ * 主机构建用的 Wire 替身：缓冲区语义与 Arduino TwoWire 一致，
+ * endTransmission()/requestFrom() 时把整个事务交给当前总线后端。
+ * 与多数32位内核一样另有第二个控制器 Wire1；给某个控制器设置 bus 后
+ * 它的流量只交给这个后端，模拟互相独立的两条总线。
+ */
+#include "Arduino.h"
+
+// 与AVR Wire库相同的默认缓冲区长度
+#ifndef WIRE_BUFFER_SIZE
+  #define WIRE_BUFFER_SIZE 32
+#endif
+
+#define WIRE_HAS_TIMEOUT
+
+class TwoWire {
+public:
+    SigmaBusBackend* bus = nullptr;    // 这个控制器自己的后端，nullptr 时用当前后端
+
+    void begin() {}
+    void end() {}
+
+    void setClock(uint32_t hz) {
+        clock_ = hz;
+        backend()->setClock(hz);
+    }
+    uint32_t getClock() const { return clock_; }
+
+    void setWireTimeout(uint32_t timeout_us, bool reset_with_timeout) {
+        (void)timeout_us;
+        (void)reset_with_timeout;
+    }
+
+    void beginTransmission(int address) {
+        txAddress_ = uint8_t(address);
+        txLength_ = 0;
+        txOverflow_ = false;
+    }
+
+    size_t write(uint8_t data) {
+        if (txLength_ >= WIRE_BUFFER_SIZE) {
+            txOverflow_ = true;
+            return 0;
+        }
+        txBuffer_[txLength_++] = data;
+        return 1;
+    }
+
+    size_t write(const uint8_t* data, size_t length) {
+        for (size_t i = 0; i < length; i++) {
+            if (!write(data[i])) {
+                return i;
+            }
+        }
+        return length;
+    }
+
+    // 0=成功，1=数据超出发送缓冲区，其余由后端决定
+    uint8_t endTransmission(bool sendStop = true) {
+        if (txOverflow_) {
+            txLength_ = 0;
+            return 1;
+        }
+        uint8_t status = backend()->i2cWrite(txAddress_, txBuffer_, txLength_, sendStop);
+        txLength_ = 0;
+        return status;
+    }
+
+    size_t requestFrom(int address, size_t quantity, bool sendStop = true) {
+        (void)sendStop;
+        if (quantity > WIRE_BUFFER_SIZE) {
+            quantity = WIRE_BUFFER_SIZE;
+        }
+        rxLength_ = backend()->i2cRead(uint8_t(address), rxBuffer_, quantity);
+        rxIndex_ = 0;
+        return rxLength_;
+    }
+
+    int available() const { return int(rxLength_ - rxIndex_); }
+
+    int read() {
+        if (rxIndex_ >= rxLength_) {
+            return -1;
+        }
+        return rxBuffer_[rxIndex_++];
+    }
+
+private:
+    SigmaBusBackend* backend() const { return bus ? bus : SIGMA_HOST_BUS(); }
+
+    uint32_t clock_ = 100000;
+    uint8_t txAddress_ = 0;
+    uint8_t txBuffer_[WIRE_BUFFER_SIZE];
+    size_t txLength_ = 0;
+    bool txOverflow_ = false;
+    uint8_t rxBuffer_[WIRE_BUFFER_SIZE];
+    size_t rxLength_ = 0;
+    size_t rxIndex_ = 0;
+};
+
+inline TwoWire Wire;
+inline TwoWire Wire1;
+
+#endif // __HOST_WIRE_H__
@@ -0,0 +1,239 @@
+/*
+ * SigmaStudioFW.h 热点函数的微基准测试（计数型总线后端，下载项接 ADAU1452 模型）。
+ *
+ * 每项给出 ns/op、ns/byte、每次操作的事务数和开销字节数。ns 数值是主机
+ * CPU 上的结果，只用于比较前后变化；事务数和开销字节是确定的，可以精确
+ * 对比。
+ *
+ * 用法:
+ *   sigma_bench                 打印结果（格式与基准文件相同）
+ *   sigma_bench --check FILE    与基准文件比较，事务数或开销字节变多时失败
+ */
+#define SIGMA_LZ_ENABLE true    // 使用压缩序列
+#include <chrono>
+#include <map>
+#include <string>
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#include "ADAU1452_EN_B_I2C_IC_1_PARAM.h"
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ_LZ.h"
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ_SPARSE.h"
+#include "SigmaDspEmulator.h"
+#include "defines.h"
+
+struct BenchResult {
+    std::string name;
+    double nsPerOp;
+    double nsPerByte;
+    double txnsPerOp;
+    double overheadPerOp;
+};
+
+static SigmaBusCounter g_bus;
+static SigmaDspEmulator g_dsp(DSP_I2C_ADDR);    // 下载过程中回答PLL_LOCK等状态轮询
+static volatile uint32_t g_sink;
+
+// 重复运行直到累计至少 20ms，取3轮中最快的一轮
+template <typename Fn>
+static double measureNs(Fn fn) {
+    double best = 1e30;
+    for (int round = 0; round < 3; round++) {
+        size_t iters = 0;
+        auto start = std::chrono::steady_clock::now();
+        double elapsed = 0;
+        do {
+            for (int i = 0; i < 16; i++) {
+                fn();
+            }
+            iters += 16;
+            elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        } while (elapsed < 20e6);
+        if (elapsed / iters < best) {
+            best = elapsed / iters;
+        }
+    }
+    return best;
+}
+
+// bytes 为每次操作处理的数据字节数；事务统计取单次操作的结果
+template <typename Fn>
+static BenchResult bench(const char* name, size_t bytes, Fn fn) {
+    g_bus.reset();
+    fn();
+    BenchResult r;
+    r.name = name;
+    r.txnsPerOp = double(g_bus.transactions);
+    r.overheadPerOp = double(g_bus.overheadBytes);
+    r.nsPerOp = measureNs(fn);
+    r.nsPerByte = bytes ? r.nsPerOp / bytes : 0;
+    return r;
+}
+
+static std::vector<BenchResult> runAll() {
+    static byte ramBlock[1024];
+    for (size_t i = 0; i < sizeof(ramBlock); i++) {
+        ramBlock[i] = byte(i);
+    }
+    byte param[4] = {0x00, 0x80, 0x00, 0x00};
+
+    std::vector<BenchResult> results;
+    results.push_back(bench("write_block_ram_param", 4, [&] {
+        SIGMA_WRITE_REGISTER_BLOCK(DSP_I2C_ADDR, MOD_GEN1STORDER1_ALG0_PARAMB0_1_ADDR, 4, param);
+    }));
+    results.push_back(bench("write_block_ram_1k", sizeof(ramBlock), [&] {
+        SIGMA_WRITE_REGISTER_BLOCK(DSP_I2C_ADDR, PARAM_ADDR_IC_1, int(sizeof(ramBlock)), ramBlock);
+    }));
+    results.push_back(bench("write_block_progmem_program", PROGRAM_SIZE_IC_1, [&] {
+        SIGMA_WRITE_REGISTER_BLOCK(DEVICE_ADDR_IC_1, PROGRAM_ADDR_IC_1, PROGRAM_SIZE_IC_1, Program_Data_IC_1);
+    }));
+    results.push_back(bench("write_block_progmem_param", PARAM_SIZE_IC_1, [&] {
+        SIGMA_WRITE_REGISTER_BLOCK(DEVICE_ADDR_IC_1, PARAM_ADDR_IC_1, PARAM_SIZE_IC_1, Param_Data_IC_1);
+    }));
+    results.push_back(bench("write_block_progmem_register", 2, [&] {
+        SIGMA_WRITE_REGISTER_BLOCK(DEVICE_ADDR_IC_1, REG_SOUT_SOURCE0_IC_1_ADDR, REG_SOUT_SOURCE0_IC_1_BYTE,
+                                   R26_SOUT_SOURCE0_IC_1_Default);
+    }));
+    g_bus.target = &g_dsp;
+    results.push_back(bench("default_download_IC_1", BufferSize_IC_1, [&] {
+        sequence_download_IC_1();
+    }));
+    results.push_back(bench("default_download_IC_1_planned", BufferSize_IC_1, [&] {
+        SIGMA_DOWNLOAD_BEGIN();
+        sequence_download_IC_1();
+        SIGMA_DOWNLOAD_END();
+    }));
+    // 压缩序列：总线事务与未压缩的序列相同，多出的是解压的CPU时间
+    results.push_back(bench("default_download_IC_1_lz", BufferSize_IC_1, [&] {
+        sequence_download_LZ_IC_1();
+    }));
+    // 稀疏序列，内存已知为零：零段不上总线
+    results.push_back(bench("default_download_IC_1_sparse", BufferSize_IC_1, [&] {
+        SIGMA_RUN_SEQUENCE(DEVICE_ADDR_IC_1, Sequence_SPARSE_IC_1, SEQUENCE_SPARSE_SIZE_IC_1,
+                           Sequence_SPARSE_Blob_IC_1, SIGMA_ZERO_ASSUME);
+    }));
+    // 下载后读回校验的开销，与下载分开统计
+    results.push_back(bench("verify_sections_IC_1", PROGRAM_SIZE_IC_1 + PARAM_SIZE_IC_1 + DM1_DATA_SIZE_IC_1, [&] {
+        g_sink = SIGMA_VERIFY_SECTIONS(DEVICE_ADDR_IC_1, Sections_IC_1, SECTION_COUNT_IC_1);
+    }));
+    // MCU复位后判断DSP是否仍在运行同一镜像（签名匹配，全部检查都会执行）
+    SIGMA_WRITE_SIGNATURE(DEVICE_ADDR_IC_1, &Signature_IC_1, Signature_IC_1.value);
+    results.push_back(bench("warm_boot_match_IC_1", 0, [&] {
+        g_sink = SIGMA_WARM_BOOT_MATCH(DEVICE_ADDR_IC_1, &Signature_IC_1);
+    }));
+    g_bus.target = nullptr;
+#if USE_SPI == false
+    results.push_back(bench("getMemoryDepth", 0, [&] {
+        uint32_t sum = 0;
+        for (uint32_t a = 0xEFF0; a < 0xF010; a++) {
+            sum += getMemoryDepth(a);
+        }
+        g_sink = sum;
+    }));
+#endif
+    results.push_back(bench("pgm_read_byte_near_loop", PROGRAM_SIZE_IC_1, [&] {
+        uint32_t sum = 0;
+        for (int i = 0; i < PROGRAM_SIZE_IC_1; i++) {
+            sum += pgm_read_byte_near(Program_Data_IC_1 + i);
+        }
+        g_sink = sum;
+    }));
+    // 只解压，不接总线：ns/byte 要远小于总线上一个字节的时间，解压才不会拖慢下载
+    size_t lzBytes = 0;
+    for (int i = 0; i < SEQUENCE_LZ_SIZE_IC_1; i++) {
+        if (Sequence_LZ_IC_1[i].opcode == SIGMA_SEQ_WRITE_LZ) {
+            lzBytes += Sequence_LZ_IC_1[i].length;
+        }
+    }
+    results.push_back(bench("lz_decode_blob", lzBytes, [&] {
+        static SigmaLzState lz;
+        uint32_t sum = 0;
+        for (int i = 0; i < SEQUENCE_LZ_SIZE_IC_1; i++) {
+            const SigmaSeqEntry& e = Sequence_LZ_IC_1[i];
+            if (e.opcode == SIGMA_SEQ_WRITE_LZ) {
+                SIGMA_LZ_START(&lz, Sequence_LZ_Blob_IC_1 + e.offset);
+                for (int n = 0; n < e.length; n++) {
+                    sum += SIGMA_LZ_NEXT(&lz);
+                }
+            }
+        }
+        g_sink = sum;
+    }));
+    results.push_back(bench("fixpoint_convert", 0, [&] {
+        static double v = 0.123456;
+        v = -v;
+        g_sink = uint32_t(SIGMASTUDIOTYPE_FIXPOINT_CONVERT(v));
+    }));
+    results.push_back(bench("write_register_float", 4, [&] {
+        SIGMA_WRITE_REGISTER_FLOAT(MOD_GEN1STORDER1_ALG0_PARAMB0_1_ADDR, 0.5);
+    }));
+    results.push_back(bench("read_register_float", 4, [&] {
+        g_sink = uint32_t(SIGMA_READ_REGISTER_FLOAT(MOD_GEN1STORDER1_ALG0_PARAMB0_1_ADDR));
+    }));
+    return results;
+}
+
+static void print(const std::vector<BenchResult>& results) {
+    printf("# %-30s %12s %10s %8s %10s\n", "name", "ns/op", "ns/byte", "txns/op", "ovh/op");
+    for (const BenchResult& r : results) {
+        printf("%-32s %12.1f %10.3f %8.0f %10.0f\n", r.name.c_str(), r.nsPerOp, r.nsPerByte,
+               r.txnsPerOp, r.overheadPerOp);
+    }
+}
+
+static bool loadBaseline(const char* path, std::map<std::string, BenchResult>& out) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        return false;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        char name[64];
+        BenchResult r;
+        if (line[0] == '#' ||
+            sscanf(line, "%63s %lf %lf %lf %lf", name, &r.nsPerOp, &r.nsPerByte, &r.txnsPerOp, &r.overheadPerOp) != 5) {
+            continue;
+        }
+        r.name = name;
+        out[r.name] = r;
+    }
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    SIGMA_HOST_SET_BUS(&g_bus);
+    SIGMA_I2C_INIT();
+
+    std::vector<BenchResult> results = runAll();
+    print(results);
+
+    if (argc < 3 || std::string(argv[1]) != "--check") {
+        return 0;
+    }
+    std::map<std::string, BenchResult> baseline;
+    if (!loadBaseline(argv[2], baseline)) {
+        printf("cannot read baseline %s\n", argv[2]);
+        return 1;
+    }
+    int failures = 0;
+    for (const BenchResult& r : results) {
+        auto it = baseline.find(r.name);
+        if (it == baseline.end()) {
+            printf("NEW  %s (not in baseline)\n", r.name.c_str());
+            continue;
+        }
+        const BenchResult& b = it->second;
+        if (r.txnsPerOp > b.txnsPerOp || r.overheadPerOp > b.overheadPerOp) {
+            printf("FAIL %s: %.0f txns / %.0f overhead bytes, baseline %.0f / %.0f\n", r.name.c_str(),
+                   r.txnsPerOp, r.overheadPerOp, b.txnsPerOp, b.overheadPerOp);
+            failures++;
+        }
+        else if (r.txnsPerOp < b.txnsPerOp || r.overheadPerOp < b.overheadPerOp) {
+            printf("BETTER %s: %.0f txns / %.0f overhead bytes (baseline %.0f / %.0f), refresh the baseline\n",
+                   r.name.c_str(), r.txnsPerOp, r.overheadPerOp, b.txnsPerOp, b.overheadPerOp);
+        }
+        if (r.nsPerOp > 3 * b.nsPerOp) {
+            printf("SLOW %s: %.1f ns/op, baseline %.1f\n", r.name.c_str(), r.nsPerOp, b.nsPerOp);
+        }
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,165 @@
+/*
+ * 总线时序模型报告：录制 default_download_IC_1() 的全部物理事务，
+ * 按 NumBytes_IC_1.dat 的逻辑事务分组，给出各总线时钟下的线上时间。
+ *
+ * 用法: sigma_bus_timing [导出目录] [MCU事务间隙ns]
+ */
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#include "SigmaBusTiming.h"
+#include "SigmaDspEmulator.h"
+#include "SigmaTxBuffer.h"
+
+#if USE_SPI
+static const uint32_t kClocks[] = {1000000, 4000000, 10000000, 20000000, SIGMA_SPI_CLOCK_MAX};
+static const char* kBusName = "SPI";
+#else
+static const uint32_t kClocks[] = {100000, 400000, 1000000};
+static const char* kBusName = "I2C";
+#endif
+static const size_t kNumClocks = sizeof(kClocks) / sizeof(kClocks[0]);
+
+struct EntryRange {
+    size_t first;
+    size_t last;
+    double delayMs;
+};
+
+static size_t headerBytes(const SigmaBusTransaction& t) {
+    return t.kind == SIGMA_BUS_SPI ? 3 : 2;
+}
+
+// 状态轮询产生的事务：I2C读、只含子地址的I2C写、SPI读
+static bool isPoll(const SigmaBusTransaction& t) {
+    if (t.kind == SIGMA_BUS_I2C_READ) {
+        return true;
+    }
+    if (t.kind == SIGMA_BUS_SPI) {
+        return !t.data.empty() && (t.data[0] & 0x01);
+    }
+    return t.data.size() <= 2;
+}
+
+static uint16_t subAddress(const SigmaBusTransaction& t) {
+    size_t h = headerBytes(t);
+    return uint16_t((t.data[h - 2] << 8) | t.data[h - 1]);
+}
+
+int main(int argc, char** argv) {
+    std::string dir = argc > 1 ? argv[1] : SIGMA_EXPORT_DIR;
+    double mcuGapNs = argc > 2 ? atof(argv[2]) : 0;
+
+    std::vector<SigmaTxEntry> entries;
+    if (!SIGMA_LOAD_TX_BUFFER(dir, 1, entries)) {
+        fprintf(stderr, "cannot load TxBuffer/NumBytes from %s\n", dir.c_str());
+        return 1;
+    }
+
+    SigmaDspEmulator dsp(DSP_I2C_ADDR);
+    SigmaBusRecorder bus;
+    bus.target = &dsp;
+    SIGMA_HOST_SET_BUS(&bus);
+    SIGMA_I2C_INIT();
+    bus.clear();
+    uint64_t start = SIGMA_HOST_TIME_US();
+    default_download_IC_1();
+    uint64_t end = SIGMA_HOST_TIME_US();
+    const std::vector<SigmaBusTransaction>& log = bus.log;
+
+    // 把物理事务归到逻辑事务
+    std::vector<EntryRange> ranges;
+    size_t pos = 0;
+    for (size_t i = 0; i < entries.size(); i++) {
+        EntryRange r = {pos, pos, 0};
+        if (entries[i].isDelay()) {
+            // 可能被替换为状态轮询，轮询事务计入该延迟
+            uint64_t before = pos > 0 ? log[pos - 1].timeUs : start;
+            while (pos < log.size() && isPoll(log[pos])) {
+                pos++;
+            }
+            uint64_t after = pos < log.size() ? log[pos].timeUs : end;
+            r.delayMs = (after - before) / 1000.0;
+        }
+        else {
+            if (pos >= log.size() || subAddress(log[pos]) != entries[i].address) {
+                fprintf(stderr, "entry %zu (%s): trace does not start at 0x%04X\n",
+                        i, entries[i].name.c_str(), entries[i].address);
+                return 1;
+            }
+            size_t payload = 0;
+            while (pos < log.size() && payload < entries[i].data.size()) {
+                payload += log[pos].data.size() - headerBytes(log[pos]);
+                pos++;
+            }
+            if (payload != entries[i].data.size()) {
+                fprintf(stderr, "entry %zu (%s): payload %zu != %zu\n",
+                        i, entries[i].name.c_str(), payload, entries[i].data.size());
+                return 1;
+            }
+        }
+        r.last = pos;
+        ranges.push_back(r);
+    }
+
+    std::vector<SigmaI2CTiming> i2c;
+    std::vector<SigmaSPITiming> spi;
+    for (size_t c = 0; c < kNumClocks; c++) {
+        i2c.push_back(SIGMA_I2C_TIMING(kClocks[c], mcuGapNs));
+        spi.push_back(SIGMA_SPI_TIMING(kClocks[c], mcuGapNs));
+    }
+
+    printf("default_download_IC_1() over %s, %zu logical / %zu physical transactions\n\n",
+           kBusName, entries.size(), log.size());
+    printf("%3s  %-20s %6s %6s %5s", "#", "name", "addr", "bytes", "txns");
+    for (size_t c = 0; c < kNumClocks; c++) {
+        printf(" %9.0fk", kClocks[c] / 1000.0);
+    }
+    printf("   (us)\n");
+
+    std::vector<double> totalNs(kNumClocks, 0);
+    double delayMs = 0;
+    for (size_t i = 0; i < entries.size(); i++) {
+        const EntryRange& r = ranges[i];
+        printf("%3zu  %-20.20s 0x%04X %6zu %5zu", i, entries[i].name.c_str(),
+               entries[i].address, entries[i].data.size(), r.last - r.first);
+        if (entries[i].isDelay()) {
+            if (r.last > r.first) {
+                printf("   poll %.1f ms (%zu txns)\n", r.delayMs, r.last - r.first);
+            }
+            else {
+                printf("   delay %.1f ms\n", r.delayMs);
+            }
+            delayMs += r.delayMs;
+            continue;
+        }
+        for (size_t c = 0; c < kNumClocks; c++) {
+            double ns = SIGMA_BUS_WIRE_NS(log, r.first, r.last, i2c[c], spi[c]);
+            totalNs[c] += ns;
+            printf(" %10.1f", ns / 1000.0);
+        }
+        printf("\n");
+    }
+
+    printf("\n%-40s", "total wire time (ms)");
+    for (size_t c = 0; c < kNumClocks; c++) {
+        printf(" %10.3f", totalNs[c] / 1e6);
+    }
+    printf("\n%-40s", "throughput (kB/s)");
+    for (size_t c = 0; c < kNumClocks; c++) {
+        printf(" %10.0f", bus.wireBytes() / (totalNs[c] / 1e9) / 1000);
+    }
+    printf("\n%-40s %10.3f\n", "host-side delays (ms)", delayMs);
+    printf("%-40s %10lu\n", "saved by status polling (ms)", (unsigned long)SIGMA_WAIT_SAVED_MS());
+    printf("%-40s %10zu\n", "wire bytes", bus.wireBytes());
+    printf("%-40s %10zu\n", "payload bytes", bus.payloadBytes());
+
+    // 读回校验单独统计，不计入下载时间
+    bus.clear();
+    uint8_t verify = SIGMA_VERIFY_SECTIONS(DEVICE_ADDR_IC_1, Sections_IC_1, SECTION_COUNT_IC_1);
+    printf("\n%-40s", "readback verify (ms)");
+    for (size_t c = 0; c < kNumClocks; c++) {
+        printf(" %10.3f", SIGMA_BUS_WIRE_NS(bus.log, 0, bus.log.size(), i2c[c], spi[c]) / 1e6);
+    }
+    printf("\n%-40s %10zu\n", "readback transactions", bus.log.size());
+    printf("%-40s %10s\n", "readback result", verify == SIGMA_SUCCESS ? "OK" : "MISMATCH");
+    return verify == SIGMA_SUCCESS ? 0 : 1;
+}
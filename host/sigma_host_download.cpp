@@ -0,0 +1,65 @@
+/*
+ * 主机上运行 default_download_IC_1() 和常用 SIGMA_* 接口，
+ * 打印总线流量统计。可直接在 perf/valgrind 下运行。
+ */
+#define SIGMA_LZ_ENABLE true    // 使用压缩序列
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#include "ADAU1452_EN_B_I2C_IC_2.h"
+#include "ADAU1452_EN_B_I2C_IC_1_PARAM.h"
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ_LZ.h"
+#include "SigmaDspEmulator.h"
+
+static void printSummary(const char* name, const SigmaBusRecorder& bus) {
+    printf("%-24s %6zu transactions  %6zu payload bytes  %6zu wire bytes\n",
+           name, bus.writeCount(), bus.payloadBytes(), bus.wireBytes());
+}
+
+int main() {
+    SigmaDspEmulator dsp(DSP_I2C_ADDR);    // 回答状态轮询和参数读回
+    SigmaBusRecorder bus;
+    bus.target = &dsp;
+    SIGMA_HOST_SET_BUS(&bus);
+
+    SIGMA_I2C_INIT();
+    bus.clear();
+
+    uint64_t start = SIGMA_HOST_TIME_US();
+    default_download_IC_1();
+    default_download_IC_2();
+    printSummary("default_download_IC_1", bus);
+    printf("%-24s %6llu ms in delays  %6lu ms saved by status polling\n", "",
+           (unsigned long long)((SIGMA_HOST_TIME_US() - start) / 1000), (unsigned long)SIGMA_WAIT_SAVED_MS());
+    printf("boot phases (IC 1, delays and polling only; bus time is not modelled here):\n");
+    SIGMA_PRINT_BOOT_TIMING();
+
+    // 压缩序列：总线流量不变，闪存中只存压缩后的数据块
+    bus.clear();
+    SIGMA_RUN_SEQUENCE(DEVICE_ADDR_IC_1, Sequence_LZ_IC_1, SEQUENCE_LZ_SIZE_IC_1, Sequence_LZ_Blob_IC_1);
+    printSummary("compressed sequence", bus);
+    for (int i = 0; i < SEQUENCE_LZ_SIZE_IC_1; i++) {
+        const SigmaSeqEntry& e = Sequence_LZ_IC_1[i];
+        if (e.opcode == SIGMA_SEQ_WRITE_LZ) {
+            uint32_t end = i + 1 < SEQUENCE_LZ_SIZE_IC_1 ? Sequence_LZ_IC_1[i + 1].offset : SEQUENCE_LZ_BLOB_SIZE_IC_1;
+            printf("%-24s 0x%04X %6u -> %6lu bytes (%.2f:1)\n", "", e.address, e.length,
+                   (unsigned long)(end - e.offset), double(e.length) / (end - e.offset));
+        }
+    }
+    printf("%-24s blob   %6u -> %6u bytes (%.2f:1)\n", "", unsigned(SEQUENCE_BLOB_SIZE_IC_1),
+           unsigned(SEQUENCE_LZ_BLOB_SIZE_IC_1), double(SEQUENCE_BLOB_SIZE_IC_1) / SEQUENCE_LZ_BLOB_SIZE_IC_1);
+
+    bus.clear();
+    SIGMA_VERIFY_SECTIONS(DEVICE_ADDR_IC_1, Sections_IC_1, SECTION_COUNT_IC_1);
+    printSummary("verify_sections_IC_1", bus);
+
+    bus.clear();
+    SIGMA_WRITE_REGISTER_FLOAT(MOD_GEN1STORDER1_ALG0_PARAMB0_1_ADDR, 0.5);
+    double value = SIGMA_READ_REGISTER_FLOAT(MOD_GEN1STORDER1_ALG0_PARAMB0_1_ADDR);
+    (void)value;
+    printSummary("write+read float", bus);
+
+    if (SIGMA_GET_LAST_ERROR() != SIGMA_SUCCESS) {
+        SIGMA_PRINT_ERROR();
+        return 1;
+    }
+    return 0;
+}
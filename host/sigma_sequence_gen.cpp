@@ -0,0 +1,510 @@
+/*
+ * 从 TxBuffer_IC_x.dat/NumBytes_IC_x.dat 生成表驱动下载序列头文件，
+ * 供 SigmaStudioFW.h 的 SIGMA_RUN_SEQUENCE() 执行。
+ *
+ * 所有事务的数据（不含地址）依次放进一个PROGMEM数据块，序列表每条记录
+ * {操作, 组, 地址, 长度, 偏移}。延迟按导出文件中的名称（"... Delay"）识别。
+ * 另外为每段写入DSP内存（程序、DM0、DM1，不含控制寄存器）的数据生成
+ * {地址, 长度, CRC32} 表，供下载后 SIGMA_VERIFY_SECTIONS() 读回校验，
+ * 以及热启动签名（SIGMA_BOOT_SEQUENCE()）：整个镜像（寄存器和内存）的CRC32存放在DM1数据
+ * 之后第一个未用的字（SIGNATURE_ADDR_IC_n，下一个字 SCRATCH_ADDR_IC_n 供时钟鉴定），两字落进
+ * 导出头文件的任何内存段时生成失败、旧的 _SEQ.h 编译报错；另取若干程序字抽样比较；再按组（控制、时钟、其余
+ * 寄存器、程序、DM0、DM1）生成哈希，供 SIGMA_BOOT_INCREMENTAL() 判断哪些变了。
+ *
+ * --lz 时把大块内存写入压缩成 SIGMA_SEQ_WRITE_LZ 条目（格式见 SigmaStudioFW.h 的
+ * SIGMA_LZ_*），符号名加 _LZ 后缀，段表/签名/组哈希仍使用未压缩序列头文件中的。
+ * --sparse 时把DM0/DM1写入中的长串零字拆成不带数据的 SIGMA_SEQ_ZERO 条目，
+ * 符号名加 _SPARSE 后缀；DSP内存已知为零时执行序列可以跳过它们（见 SIGMA_SEQ_SET_ZERO_MODE()）。
+ * --image 时不生成头文件，而是把序列写成二进制镜像（格式见 SigmaStudioFW.h 的 SIGMA_IMAGE_*），
+ * 复制到 LittleFS/SPIFFS/SD 上由 SIGMA_RUN_IMAGE() 加载；可与 --sparse 同用，不能与 --lz 同用。
+ *
+ * 用法: sigma_sequence_gen [--sparse] [--lz] [导出目录] [IC编号] [工程名] > 工程名_IC_n_SEQ[_SPARSE][_LZ].h
+ *       sigma_sequence_gen --image [--sparse] [导出目录] [IC编号] [工程名] > 工程名_IC_n.sigi
+ */
+#include <algorithm>
+#include "SigmaTxBuffer.h"
+
+// ADAU145x 内存映射：DM0、DM1、程序内存、控制寄存器的起始地址
+static const uint16_t kDm1Base = 0x6000;
+static const uint16_t kProgramBase = 0xC000;
+static const uint16_t kRegisterBase = 0xF000;
+
+// 与 SigmaStudioFW.h 的 SIGMA_SIGNATURE_SAMPLES 一致
+static const int kSignatureSamples = 8;
+
+// 与 SigmaStudioFW.h 的 SIGMA_CRC32() 相同（zlib crc32，可分段累加）
+static uint32_t crc32(uint32_t crc, const std::vector<uint8_t>& data) {
+    crc = ~crc;
+    for (uint8_t b : data) {
+        crc ^= b;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+// 条目所属的组（与 SigmaStudioFW.h 的 SIGMA_GROUP_* 对应）
+static const char* groupOf(const SigmaTxEntry& e) {
+    if (e.isDelay()) {
+        return "SIGMA_GROUP_CONTROL";
+    }
+    if (e.address >= kRegisterBase) {
+        // SOFT_RESET、HIBERNATE、START_PULSE、START_CORE、KILL_CORE、START_ADDRESS
+        if (e.address == 0xF890 || (e.address >= 0xF400 && e.address <= 0xF404)) {
+            return "SIGMA_GROUP_CONTROL";
+        }
+        return e.address < 0xF100 ? "SIGMA_GROUP_CLOCK" : "SIGMA_GROUP_IO";
+    }
+    if (e.address >= kProgramBase) {
+        return "SIGMA_GROUP_PROGRAM";
+    }
+    return e.address >= kDm1Base ? "SIGMA_GROUP_DM1" : "SIGMA_GROUP_DM0";
+}
+
+static const char* const kGroups[] = {
+    "SIGMA_GROUP_CONTROL", "SIGMA_GROUP_CLOCK", "SIGMA_GROUP_IO",
+    "SIGMA_GROUP_PROGRAM", "SIGMA_GROUP_DM0", "SIGMA_GROUP_DM1"
+};
+
+// 地址（大端）加数据，组哈希和签名都按这个字节流计算
+static std::vector<uint8_t> entryBytes(const SigmaTxEntry& e) {
+    std::vector<uint8_t> bytes(2 + e.data.size());
+    bytes[0] = uint8_t(e.address >> 8);
+    bytes[1] = uint8_t(e.address);
+    std::copy(e.data.begin(), e.data.end(), bytes.begin() + 2);
+    return bytes;
+}
+
+// 短于此长度的条目（寄存器、延迟）不压缩
+static const size_t kLzMinBytes = 64;
+
+// 与 SigmaStudioFW.h 的 SIGMA_LZ_NEXT() 对应的贪心编码：零字节串、窗口内
+// （256字节）最长匹配、字面字节串
+static std::vector<uint8_t> lzCompress(const std::vector<uint8_t>& data) {
+    std::vector<uint8_t> out;
+    std::vector<uint8_t> literals;
+    auto flushLiterals = [&]() {
+        if (!literals.empty()) {
+            out.push_back(uint8_t(literals.size() - 1));
+            out.insert(out.end(), literals.begin(), literals.end());
+            literals.clear();
+        }
+    };
+    size_t n = data.size();
+    size_t i = 0;
+    while (i < n) {
+        size_t zeros = 0;
+        while (i + zeros < n && data[i + zeros] == 0 && zeros < 64) {
+            zeros++;
+        }
+        size_t best = 0;
+        size_t bestDistance = 0;
+        for (size_t d = 1; d <= 256 && d <= i; d++) {
+            size_t len = 0;
+            while (i + len < n && data[i + len - d] == data[i + len] && len < 66) {
+                len++;
+            }
+            if (len > best) {
+                best = len;
+                bestDistance = d;
+            }
+        }
+        if (zeros >= 2 && zeros >= best) {
+            flushLiterals();
+            out.push_back(uint8_t(0x80 + zeros - 1));
+            i += zeros;
+        }
+        else if (best >= 3) {
+            flushLiterals();
+            out.push_back(uint8_t(0xC0 + best - 3));
+            out.push_back(uint8_t(bestDistance - 1));
+            i += best;
+        }
+        else {
+            literals.push_back(data[i++]);
+            if (literals.size() == 128) {
+                flushLiterals();
+            }
+        }
+    }
+    flushLiterals();
+    return out;
+}
+
+// 至少这么多个连续零字才拆出去：更短的零串留在写入中，比多一个事务（地址头）更省
+static const size_t kSparseMinZeroWords = 4;
+
+// 把一个DM0/DM1写入拆成非零段（SIGMA_SEQ_WRITE）和零段（SIGMA_SEQ_ZERO，zero 为 true）
+static void splitSparse(const SigmaTxEntry& e, std::vector<SigmaTxEntry>& out, std::vector<bool>& zero) {
+    size_t words = e.data.size() / 4;
+    auto isZero = [&](size_t w) {
+        return e.data[w * 4] == 0 && e.data[w * 4 + 1] == 0 && e.data[w * 4 + 2] == 0 && e.data[w * 4 + 3] == 0;
+    };
+    size_t w = 0;
+    while (w < words) {
+        size_t run = 0;
+        while (w + run < words && isZero(w + run)) {
+            run++;
+        }
+        bool skip = run >= kSparseMinZeroWords;
+        size_t end = w + run;
+        if (!skip) {
+            // 非零段延伸到下一个足够长的零串为止
+            end = w;
+            while (end < words) {
+                size_t zeros = 0;
+                while (end + zeros < words && isZero(end + zeros)) {
+                    zeros++;
+                }
+                if (zeros >= kSparseMinZeroWords) {
+                    break;
+                }
+                end += zeros ? zeros : 1;
+            }
+        }
+        SigmaTxEntry part;
+        part.address = uint16_t(e.address + w);
+        part.data.assign(e.data.begin() + w * 4, e.data.begin() + end * 4);
+        char suffix[16];
+        snprintf(suffix, sizeof(suffix), " @0x%04X", part.address);
+        part.name = e.name + suffix;
+        out.push_back(part);
+        zero.push_back(skip);
+        w = end;
+    }
+}
+
+// 二进制镜像：16字节文件头（"SIGI"、版本、保留、记录数、记录区字节数、记录区CRC32），
+// 随后每条记录 {操作, 组, 地址, 长度} 加数据，零条目不带数据。多字节字段均为大端
+static const uint8_t kImageVersion = 1;
+
+static void putBig(std::vector<uint8_t>& out, uint32_t value, int bytes) {
+    for (int i = bytes - 1; i >= 0; i--) {
+        out.push_back(uint8_t(value >> (8 * i)));
+    }
+}
+
+static int writeImage(const std::vector<SigmaTxEntry>& entries, const std::vector<bool>& zero) {
+    std::vector<uint8_t> body;
+    for (size_t i = 0; i < entries.size(); i++) {
+        const SigmaTxEntry& e = entries[i];
+        const char* group = groupOf(e);
+        int g = int(std::find_if(std::begin(kGroups), std::end(kGroups),
+                                 [&](const char* k) { return strcmp(k, group) == 0; }) - std::begin(kGroups));
+        body.push_back(e.isDelay() ? 1 : zero[i] ? 3 : 0);    // SIGMA_SEQ_DELAY/ZERO/WRITE
+        body.push_back(uint8_t(g));
+        putBig(body, e.address, 2);
+        putBig(body, uint32_t(e.data.size()), 2);
+        if (!zero[i]) {
+            body.insert(body.end(), e.data.begin(), e.data.end());
+        }
+    }
+    std::vector<uint8_t> header = {'S', 'I', 'G', 'I', kImageVersion, 0};
+    putBig(header, uint32_t(entries.size()), 2);
+    putBig(header, uint32_t(body.size()), 4);
+    putBig(header, crc32(0, body), 4);
+    fwrite(header.data(), 1, header.size(), stdout);
+    fwrite(body.data(), 1, body.size(), stdout);
+    return ferror(stdout) ? 1 : 0;
+}
+
+static uint32_t wordAt(const std::vector<uint8_t>& data, size_t word) {
+    const uint8_t* p = &data[word * 4];
+    return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | p[3];
+}
+
+// 导出头文件中的一段内存：NAME_ADDR_IC_n（字地址）和 NAME_SIZE_IC_n（字节数）
+struct ExportSection {
+    std::string name;
+    uint32_t address;
+    uint32_t bytes;
+};
+
+// 从导出的 工程名_IC_n.h 中找出所有内存段（寄存器的 Rxx_..._IC_n_ADDR 形式不同，不会匹配）
+static std::vector<ExportSection> loadExportSections(const std::string& path, int ic) {
+    std::vector<ExportSection> sections;
+    FILE* f = fopen(path.c_str(), "r");
+    if (!f) {
+        return sections;
+    }
+    std::string addrSuffix = "_ADDR_IC_" + std::to_string(ic);
+    std::string sizeSuffix = "_SIZE_IC_" + std::to_string(ic);
+    std::vector<std::pair<std::string, uint32_t>> addrs;
+    std::vector<std::pair<std::string, uint32_t>> sizes;
+    char line[512];
+    char name[256];
+    unsigned long value;
+    while (fgets(line, sizeof(line), f)) {
+        if (sscanf(line, " #define %255s %lu", name, &value) != 2) {
+            continue;
+        }
+        std::string n = name;
+        for (const std::string* suffix : {&addrSuffix, &sizeSuffix}) {
+            if (n.size() > suffix->size() && n.compare(n.size() - suffix->size(), suffix->size(), *suffix) == 0) {
+                (suffix == &addrSuffix ? addrs : sizes).push_back({n.substr(0, n.size() - suffix->size()), value});
+            }
+        }
+    }
+    fclose(f);
+    for (const auto& a : addrs) {
+        for (const auto& z : sizes) {
+            if (a.first == z.first && a.second < kRegisterBase) {
+                sections.push_back({a.first, a.second, z.second});
+            }
+        }
+    }
+    return sections;
+}
+
+// 序列的入口函数，与导出文件的 default_download_IC_n() 并列，导出文件本身不改动
+static void printEntryPoint(int ic, const char* sfx, bool sparse) {
+    printf("/*\n * Table-driven counterpart of default_download_IC_%d(); returns the SIGMA_RUN_SEQUENCE() result.\n */\n", ic);
+    printf("template <typename Bus = SigmaDefaultTransport>\n");
+    printf("uint8_t sequence_download%s_IC_%d(byte devAddress = DEVICE_ADDR_IC_%d%s) {\n", sfx, ic, ic,
+           sparse ? ", uint8_t zeroMode = SIGMA_ZERO_WRITE" : "");
+    printf("\treturn SIGMA_RUN_SEQUENCE<Bus>( devAddress, Sequence%s_IC_%d, SEQUENCE%s_SIZE_IC_%d, Sequence%s_Blob_IC_%d%s );\n",
+           sfx, ic, sfx, ic, sfx, ic, sparse ? ", zeroMode" : "");
+    printf("}\n\n");
+}
+
+int main(int argc, char** argv) {
+    bool lz = false;
+    bool sparse = false;
+    bool image = false;
+    while (argc > 1 && strncmp(argv[1], "--", 2) == 0) {
+        lz = lz || strcmp(argv[1], "--lz") == 0;
+        sparse = sparse || strcmp(argv[1], "--sparse") == 0;
+        image = image || strcmp(argv[1], "--image") == 0;
+        argc--;
+        argv++;
+    }
+    if (image && lz) {
+        fprintf(stderr, "--image does not support --lz\n");
+        return 1;
+    }
+    std::string dir = argc > 1 ? argv[1] : SIGMA_EXPORT_DIR;
+    int ic = argc > 2 ? atoi(argv[2]) : 1;
+    std::string project = argc > 3 ? argv[3] : "ADAU1452_EN_B_I2C";
+    std::string suffix = std::string(sparse ? "_SPARSE" : "") + (lz ? "_LZ" : "");
+    const char* sfx = suffix.c_str();
+    bool derived = lz || sparse;    // 段表/签名/组哈希只在基本序列头文件中生成
+
+    std::vector<SigmaTxEntry> entries;
+    if (!SIGMA_LOAD_TX_BUFFER(dir, ic, entries)) {
+        fprintf(stderr, "cannot load TxBuffer/NumBytes from %s\n", dir.c_str());
+        return 1;
+    }
+    size_t exported = entries.size();    // 拆分前的条目数，对应导出的 DEFAULT_DOWNLOAD_SIZE
+    std::vector<bool> zero(entries.size(), false);
+    size_t zeroBytes = 0;
+    if (sparse) {
+        std::vector<SigmaTxEntry> split;
+        zero.clear();
+        for (const SigmaTxEntry& e : entries) {
+            if (!e.isDelay() && e.address < kProgramBase && e.data.size() % 4 == 0) {
+                splitSparse(e, split, zero);
+            }
+            else {
+                split.push_back(e);
+                zero.push_back(false);
+            }
+        }
+        entries.swap(split);
+        for (size_t i = 0; i < entries.size(); i++) {
+            zeroBytes += zero[i] ? entries[i].data.size() : 0;
+        }
+    }
+    if (image) {
+        return writeImage(entries, zero);
+    }
+
+    // 每个条目在数据块中存放的字节：原始数据，或 --lz 时压缩后更短的流
+    size_t rawSize = 0;
+    size_t blobSize = 0;
+    std::vector<size_t> sections;
+    std::vector<std::vector<uint8_t>> stored;
+    std::vector<bool> compressed;
+    for (size_t i = 0; i < entries.size(); i++) {
+        const SigmaTxEntry& e = entries[i];
+        std::vector<uint8_t> packed;
+        if (lz && !zero[i] && !e.isDelay() && e.data.size() >= kLzMinBytes) {
+            packed = lzCompress(e.data);
+        }
+        compressed.push_back(!packed.empty() && packed.size() < e.data.size());
+        stored.push_back(zero[i] ? std::vector<uint8_t>() : compressed.back() ? packed : e.data);
+        rawSize += e.data.size();
+        blobSize += stored.back().size();
+        if (!e.isDelay() && e.address < kRegisterBase) {
+            sections.push_back(i);
+        }
+    }
+
+    // 签名字放在DM1数据（没有时为DM0数据）之后第一个字，时钟鉴定的测试字紧随其后
+    uint16_t signatureAddr = 0;
+    const SigmaTxEntry* program = nullptr;
+    for (size_t i : sections) {
+        const SigmaTxEntry& e = entries[i];
+        uint16_t end = uint16_t(e.address + e.data.size() / 4);
+        if (e.address >= kProgramBase) {
+            program = &e;
+        }
+        else if (e.address >= kDm1Base || signatureAddr < kDm1Base) {
+            signatureAddr = std::max(signatureAddr, end);
+        }
+    }
+    std::string exportHeader = dir + "/" + project + "_IC_" + std::to_string(ic) + ".h";
+    std::vector<ExportSection> memory = loadExportSections(exportHeader, ic);
+    if (!derived) {
+        if (memory.empty()) {
+            fprintf(stderr, "no memory sections in %s\n", exportHeader.c_str());
+            return 1;
+        }
+        for (const ExportSection& x : memory) {
+            if (signatureAddr + 2u > x.address && signatureAddr < x.address + x.bytes / 4) {
+                fprintf(stderr, "signature words 0x%04X-0x%04X overlap %s\n", signatureAddr, signatureAddr + 1,
+                        x.name.c_str());
+                return 1;
+            }
+        }
+    }
+
+    std::string guard = "__" + project + "_IC_" + std::to_string(ic) + "_SEQ" + sfx + "_H__";
+    printf("/*\n");
+    printf(" * File:           %s_IC_%d_SEQ%s.h\n", project.c_str(), ic, sfx);
+    printf(" *\n");
+    printf(" * Description:    IC %d default download sequence%s, generated by\n", ic,
+           sparse && lz ? " (sparse, compressed)" : sparse ? " (sparse)" : lz ? " (compressed)" : "");
+    printf(" *                 host/sigma_sequence_gen from TxBuffer_IC_%d.dat/NumBytes_IC_%d.dat.\n", ic, ic);
+    printf(" *                 Do not edit; regenerate after re-exporting the project.\n");
+    if (derived) {
+        printf(" *\n");
+        if (sparse) {
+            printf(" *                 %zu zero bytes in SIGMA_SEQ_ZERO entries.\n", zeroBytes);
+        }
+        printf(" *                 %zu -> %zu bytes (%.2f:1). Sections, signature and group\n", rawSize, blobSize,
+               double(rawSize) / blobSize);
+        printf(" *                 hashes are in %s_IC_%d_SEQ.h.\n", project.c_str(), ic);
+    }
+    printf(" */\n");
+    printf("#ifndef %s\n", guard.c_str());
+    printf("#define %s\n\n", guard.c_str());
+    printf("#include \"%s_IC_%d.h\"\n\n", project.c_str(), ic);
+    if (std::find(compressed.begin(), compressed.end(), true) != compressed.end()) {
+        printf("#if !SIGMA_LZ_ENABLE\n");
+        printf("#error \"%s_IC_%d_SEQ%s.h needs the decompressor, define SIGMA_LZ_ENABLE true before including it\"\n",
+               project.c_str(), ic, sfx);
+        printf("#endif\n\n");
+    }
+    printf("#define SEQUENCE%s_SIZE_IC_%d %zu\n", sfx, ic, entries.size());
+    printf("#define SEQUENCE%s_BLOB_SIZE_IC_%d %zu\n", sfx, ic, blobSize);
+    if (!derived) {
+        printf("#define SECTION_COUNT_IC_%d %zu\n", ic, sections.size());
+        printf("\n/*\n");
+        printf(" * Warm-boot signature word and the clock qualification scratch word after it. They\n");
+        printf(" * sit past the exported data memory and are written at runtime, so the DSP program\n");
+        printf(" * must not use them: every data word the program touches has to be in an exported\n");
+        printf(" * section (SigmaStudio exports filter state as well as parameters). A re-export whose\n");
+        printf(" * sections cover them stops here; regenerate this file to move them.\n");
+        printf(" */\n");
+        printf("#define SIGNATURE_ADDR_IC_%d 0x%04X\n", ic, signatureAddr);
+        printf("#define SCRATCH_ADDR_IC_%d 0x%04X\n", ic, signatureAddr + 1);
+        for (const ExportSection& x : memory) {
+            printf("#if SCRATCH_ADDR_IC_%d >= %s_ADDR_IC_%d && SIGNATURE_ADDR_IC_%d < %s_ADDR_IC_%d + %s_SIZE_IC_%d / 4\n",
+                   ic, x.name.c_str(), ic, ic, x.name.c_str(), ic, x.name.c_str(), ic);
+            printf("#error \"SIGNATURE_ADDR_IC_%d/SCRATCH_ADDR_IC_%d overlap %s, regenerate %s_IC_%d_SEQ.h\"\n", ic, ic,
+                   x.name.c_str(), project.c_str(), ic);
+            printf("#endif\n");
+        }
+    }
+    // 每个变体都检查导出文件是否已经更新（稀疏表拆分了条目，按拆分前的条目数比较）
+    printf("\n#if DEFAULT_DOWNLOAD_SIZE_IC_%d != %zu\n", ic, exported);
+    printf("#error \"%s_IC_%d_SEQ%s.h is out of date, regenerate it with host/sigma_sequence_gen\"\n",
+           project.c_str(), ic, sfx);
+    printf("#endif\n");
+    printf("\n");
+
+    printf("ADI_REG_TYPE Sequence%s_Blob_IC_%d[SEQUENCE%s_BLOB_SIZE_IC_%d] = {\n", sfx, ic, sfx, ic);
+    for (size_t i = 0; i < entries.size(); i++) {
+        const std::vector<uint8_t>& d = stored[i];
+        // 每行4字节，事务首行后注明序号和名称
+        for (size_t j = 0; j < d.size(); j++) {
+            printf("0x%02X, ", d[j]);
+            if ((j % 4) == 3 || j + 1 == d.size()) {
+                if (j < 4) {
+                    printf("\t\t\t/* (%zu) %s */", i, entries[i].name.c_str());
+                }
+                printf("\n");
+            }
+        }
+    }
+    printf("};\n\n");
+
+    printf("const SigmaSeqEntry Sequence%s_IC_%d[SEQUENCE%s_SIZE_IC_%d] PROGMEM = {\n", sfx, ic, sfx, ic);
+    size_t offset = 0;
+    for (size_t i = 0; i < entries.size(); i++) {
+        const SigmaTxEntry& e = entries[i];
+        printf("\t{ %s, %s, 0x%04X, %zu, %zu },\t/* (%zu) %s */\n",
+               e.isDelay() ? "SIGMA_SEQ_DELAY" : zero[i] ? "SIGMA_SEQ_ZERO" :
+               compressed[i] ? "SIGMA_SEQ_WRITE_LZ" : "SIGMA_SEQ_WRITE",
+               groupOf(e), e.address, e.data.size(), offset, i, e.name.c_str());
+        offset += stored[i].size();
+    }
+    printf("};\n\n");
+    printEntryPoint(ic, sfx, sparse);
+    if (derived) {
+        printf("#endif\n");
+        return 0;
+    }
+
+    printf("const SigmaSeqSection Sections_IC_%d[SECTION_COUNT_IC_%d] PROGMEM = {\n", ic, ic);
+    for (size_t i : sections) {
+        const SigmaTxEntry& e = entries[i];
+        printf("\t{ 0x%04X, %zu, 0x%08Xu },\t/* (%zu) %s */\n", e.address, e.data.size(), crc32(0, e.data), i,
+               e.name.c_str());
+    }
+    printf("};\n\n");
+
+    // 签名覆盖控制组以外的全部条目（寄存器和内存）；抽样的程序字均匀分布，含首尾
+    uint32_t signature = 0;
+    for (const SigmaTxEntry& e : entries) {
+        if (strcmp(groupOf(e), "SIGMA_GROUP_CONTROL") != 0) {
+            signature = crc32(signature, entryBytes(e));
+        }
+    }
+    size_t programWords = program ? program->data.size() / 4 : 0;
+    if (programWords < size_t(kSignatureSamples)) {
+        fprintf(stderr, "program data too short for %d signature samples\n", kSignatureSamples);
+        return 1;
+    }
+    printf("const SigmaSignature Signature_IC_%d PROGMEM = {\n", ic);
+    printf("\tSIGNATURE_ADDR_IC_%d, 0x%08Xu,\t/* CRC32 of all non-control entries */\n", ic, signature);
+    std::vector<size_t> samples;
+    for (int k = 0; k < kSignatureSamples; k++) {
+        samples.push_back(k * (programWords - 1) / (kSignatureSamples - 1));
+    }
+    printf("\t{");
+    for (size_t k = 0; k < samples.size(); k++) {
+        printf(" 0x%04zX%s", program->address + samples[k], k + 1 < samples.size() ? "," : "");
+    }
+    printf(" },\n\t{");
+    for (size_t k = 0; k < samples.size(); k++) {
+        printf(" 0x%08Xu%s", wordAt(program->data, samples[k]), k + 1 < samples.size() ? "," : "");
+    }
+    printf(" }\n};\n\n");
+
+    // 组哈希：组内各条目的地址（大端）和数据依次计算CRC32
+    printf("const uint32_t GroupHash_IC_%d[SIGMA_GROUP_COUNT] PROGMEM = {\n", ic);
+    for (const char* group : kGroups) {
+        uint32_t hash = 0;
+        for (const SigmaTxEntry& e : entries) {
+            if (strcmp(groupOf(e), group) == 0) {
+                hash = crc32(hash, entryBytes(e));
+            }
+        }
+        printf("\t0x%08Xu,\t/* %s */\n", hash, group);
+    }
+    printf("};\n\n");
+    printf("#endif\n");
+    return 0;
+}
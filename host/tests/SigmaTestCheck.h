@@ -0,0 +1,30 @@
+#ifndef __SIGMA_TEST_CHECK_H__
+#define __SIGMA_TEST_CHECK_H__
+/*
+ * 主机测试共用的检查宏。CHECK() 失败时打印位置和消息并计数，测试继续运行，
+ * 一次运行就能看到所有失败；main() 最后返回 SIGMA_TEST_RESULT()。
+ */
+#include <stdio.h>
+
+inline int g_failures = 0;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { \
+        g_failures++; \
+        printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+    } \
+} while (0)
+
+// 打印结果，返回进程退出码
+inline int SIGMA_TEST_RESULT() {
+    if (g_failures) {
+        printf("%d failure(s)\n", g_failures);
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
+
+#endif // __SIGMA_TEST_CHECK_H__
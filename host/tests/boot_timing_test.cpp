@@ -0,0 +1,138 @@
+/*
+ * 启动阶段计时：在 ADAU1452 模型上下载 IC 1，总线按时序模型推进虚拟时钟，验证
+ *   - 各阶段的事务数、数据字节之和与总线上实际的一致，内存阶段的字节数等于导出数据的长度；
+ *   - 各阶段按启动顺序出现，耗时之和等于总耗时，复位/PLL锁定/启动等待落在对应阶段；
+ *   - 计划器合并时统计仍然完整；
+ *   - SIGMA_TIMING_BEGIN()/END() 包住的下载和之后的写入计入同一次统计，结束后的写入不再计入。
+ */
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#include "ADAU1452_EN_B_I2C_IC_1_PARAM.h"
+#include "SigmaBusTiming.h"
+#include "SigmaDspEmulator.h"
+#include "SigmaTestCheck.h"
+
+// 计数并按 I2C_CLOCK_SPEED（SPI 为 10MHz）的线上时间推进虚拟时钟
+class TimedBus : public SigmaBusCounter {
+public:
+    uint8_t i2cWrite(uint8_t devAddress, const uint8_t* data, size_t length, bool sendStop) override {
+        SigmaBusTransaction t;
+        t.kind = SIGMA_BUS_I2C_WRITE;
+        t.sendStop = sendStop;
+        t.data.assign(data, data + length);
+        advance(SIGMA_I2C_TRANSACTION_NS(t, SIGMA_I2C_TIMING(I2C_CLOCK_SPEED)));
+        return SigmaBusCounter::i2cWrite(devAddress, data, length, sendStop);
+    }
+
+    size_t i2cRead(uint8_t devAddress, uint8_t* data, size_t length) override {
+        SigmaBusTransaction t;
+        t.kind = SIGMA_BUS_I2C_READ;
+        t.data.resize(length);
+        advance(SIGMA_I2C_TRANSACTION_NS(t, SIGMA_I2C_TIMING(I2C_CLOCK_SPEED)));
+        return SigmaBusCounter::i2cRead(devAddress, data, length);
+    }
+
+    uint8_t spiTransfer(uint8_t data) override {
+        spiBytes_++;
+        return SigmaBusCounter::spiTransfer(data);
+    }
+
+    void spiEnd() override {
+        SigmaBusTransaction t;
+        t.kind = SIGMA_BUS_SPI;
+        t.data.resize(spiBytes_);
+        spiBytes_ = 0;
+        advance(SIGMA_SPI_TRANSACTION_NS(t, SIGMA_SPI_TIMING(10000000)));
+        SigmaBusCounter::spiEnd();
+    }
+
+private:
+    size_t spiBytes_ = 0;
+    double ns_ = 0;
+
+    void advance(double ns) {
+        ns_ += ns;
+        SIGMA_HOST_ADVANCE_US(uint64_t(ns_ / 1000));
+        ns_ -= double(uint64_t(ns_ / 1000)) * 1000;
+    }
+};
+
+static void checkTotals(const char* label, const SigmaBootTiming* t, const TimedBus& bus) {
+    uint64_t txns = 0, bytes = 0, us = 0;
+    for (int i = 0; i < SIGMA_PHASE_COUNT; i++) {
+        txns += t->phase[i].transactions;
+        bytes += t->phase[i].bytes;
+        us += t->phase[i].us;
+    }
+    CHECK(txns == bus.transactions, "[%s] %llu transactions in phases, %zu on the bus", label,
+          (unsigned long long)txns, bus.transactions);
+    CHECK(bytes == bus.payloadBytes, "[%s] %llu bytes in phases, %zu on the bus", label,
+          (unsigned long long)bytes, bus.payloadBytes);
+    CHECK(us == t->totalUs, "[%s] phases add up to %llu us, total %lu us", label, (unsigned long long)us,
+          (unsigned long)t->totalUs);
+}
+
+static void checkDownload(const char* label, const SigmaBootTiming* t, const TimedBus& bus) {
+    checkTotals(label, t, bus);
+    CHECK(t->state == SIGMA_TIMING_IDLE, "[%s] timing still running", label);
+    CHECK(t->seen == (1 << SIGMA_PHASE_COUNT) - 1, "[%s] phases seen 0x%02X", label, t->seen);
+    for (int i = 1; i < SIGMA_PHASE_COUNT; i++) {
+        CHECK(t->phase[i].startUs >= t->phase[i - 1].startUs, "[%s] %s starts before %s", label,
+              SIGMA_PHASE_NAME(i), SIGMA_PHASE_NAME(i - 1));
+    }
+    CHECK(t->phase[SIGMA_PHASE_PROGRAM].bytes == PROGRAM_SIZE_IC_1, "[%s] program bytes %lu", label,
+          (unsigned long)t->phase[SIGMA_PHASE_PROGRAM].bytes);
+    CHECK(t->phase[SIGMA_PHASE_PARAM].bytes == PARAM_SIZE_IC_1, "[%s] param bytes %lu", label,
+          (unsigned long)t->phase[SIGMA_PHASE_PARAM].bytes);
+    CHECK(t->phase[SIGMA_PHASE_DM1].bytes == DM1_DATA_SIZE_IC_1, "[%s] DM1 bytes %lu", label,
+          (unsigned long)t->phase[SIGMA_PHASE_DM1].bytes);
+    // 复位和休眠按导出的固定延迟等待；PLL锁定在模型中需要 pllLockUs，轮询后立即继续
+    CHECK(t->phase[SIGMA_PHASE_RESET].us >= 1000, "[%s] reset took %lu us", label,
+          (unsigned long)t->phase[SIGMA_PHASE_RESET].us);
+    CHECK(t->phase[SIGMA_PHASE_PLL].us >= 3000 && t->phase[SIGMA_PHASE_PLL].us < 10000, "[%s] PLL took %lu us", label,
+          (unsigned long)t->phase[SIGMA_PHASE_PLL].us);
+    CHECK(t->phase[SIGMA_PHASE_PROGRAM].us > t->phase[SIGMA_PHASE_DM1].us, "[%s] program faster than DM1", label);
+}
+
+int main() {
+    SigmaDspEmulator dsp(DSP_I2C_ADDR);
+    TimedBus bus;
+    bus.target = &dsp;
+    SIGMA_HOST_SET_BUS(&bus);
+    SIGMA_I2C_INIT();
+
+    const SigmaBootTiming* t = SIGMA_GET_BOOT_TIMING();
+    CHECK(t != nullptr, "timing disabled");
+
+    // 序列自动计时
+    bus.reset();
+    sequence_download_IC_1();
+    checkDownload("sequence_download_IC_1", t, bus);
+    SIGMA_PRINT_BOOT_TIMING();
+
+    // 合并写入时，计划器中的写入在阶段切换时先发出，仍算在所属阶段
+    dsp.clear();
+    bus.reset();
+    SIGMA_DOWNLOAD_BEGIN();
+    sequence_download_IC_1();
+    SIGMA_DOWNLOAD_END();
+    checkDownload("planned", t, bus);
+
+    // 手动计时：下载加上之后的参数写入，序列结束时不结束计时
+    dsp.clear();
+    bus.reset();
+    SIGMA_TIMING_BEGIN();
+    sequence_download_IC_1();
+    CHECK(t->state == SIGMA_TIMING_MANUAL, "sequence ended the manual timing");
+    SIGMA_WRITE_REGISTER_FLOAT(MOD_GEN1STORDER1_ALG0_PARAMB0_1_ADDR, 0.5);
+    SIGMA_TIMING_END();
+    checkTotals("manual", t, bus);
+    CHECK(t->phase[SIGMA_PHASE_PARAM].bytes == PARAM_SIZE_IC_1 + 4, "manual param bytes %lu",
+          (unsigned long)t->phase[SIGMA_PHASE_PARAM].bytes);
+
+    // 计时结束后的写入不计入
+    uint32_t paramTxns = t->phase[SIGMA_PHASE_PARAM].transactions;
+    SIGMA_WRITE_REGISTER_FLOAT(MOD_GEN1STORDER1_ALG0_PARAMB0_1_ADDR, 0.25);
+    CHECK(t->phase[SIGMA_PHASE_PARAM].transactions == paramTxns, "write after SIGMA_TIMING_END() counted");
+
+    return SIGMA_TEST_RESULT();
+}
@@ -0,0 +1,11 @@
+# 检查提交的序列头文件与 sigma_sequence_gen 的输出一致
+# cmake -DGEN=<sigma_sequence_gen> -DEXPORT_DIR=<导出目录> -DHEADER=<头文件> -DOUT=<临时文件> [-DFLAGS=--lz] -P check_sequence_header.cmake
+execute_process(COMMAND ${GEN} ${FLAGS} ${EXPORT_DIR} 1 OUTPUT_FILE ${OUT} RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "sigma_sequence_gen failed: ${result}")
+endif()
+file(READ ${OUT} generated)
+file(READ ${HEADER} committed)
+if(NOT generated STREQUAL committed)
+  message(FATAL_ERROR "${HEADER} is stale, regenerate with: sigma_sequence_gen ${FLAGS} ${EXPORT_DIR} 1 > ${HEADER}")
+endif()
@@ -0,0 +1,118 @@
+/*
+ * 总线时钟鉴定：ADAU1452 模型的 maxClock 模拟线束能承受的最高时钟，验证
+ *   - 各档都可靠时选中不超过最高一档 SIGMA_CLOCK_MARGIN 的最快一档；有一档失败时选中不超过
+ *     其 SIGMA_CLOCK_MARGIN 的最快一档；
+ *   - 结果存进EEPROM，以后启动只核对一轮图样，不再逐档鉴定；
+ *   - 线束变差（记录的时钟核对失败）时重新鉴定并更新记录；
+ *   - 测试字原来的内容被写回，鉴定之后的下载结果不变；
+ *   - DSP运行中重新鉴定时，即使较快的时钟下子地址出错，测试字以外的内存和寄存器也不变；
+ *     SPI上命令字节出错会把读取变成写入，DSP运行时拒绝鉴定，不发起任何测试；
+ *   - 最慢一档也失败时返回 SIGMA_ERROR_BUS_CLOCK，时钟和记录不变。
+ */
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#include "SigmaDspEmulator.h"
+#include "SigmaTestCheck.h"
+
+typedef SigmaDefaultTransport Bus;
+
+// 整个地址空间：内存每字4字节，寄存器每字2字节
+static const size_t kImageBytes = size_t(SIGMA_EMU_REGISTER_ADDR) * 4 + 0x1000 * 2;
+
+#if USE_SPI
+static const uint32_t kAllPass = 16000000;         // 不超过最高一档 22MHz 的80%
+static const uint32_t kHarnessLimit = 18000000;    // 20MHz失败
+static const uint32_t kWithMargin = 16000000;      // 不超过 20MHz 的80%
+static const uint32_t kTooSlow = 500000;           // 1MHz也失败
+#else
+static const uint32_t kAllPass = 400000;           // 不超过最高一档 1MHz 的80%
+static const uint32_t kHarnessLimit = 500000;      // 1MHz失败
+static const uint32_t kWithMargin = 400000;
+static const uint32_t kTooSlow = 50000;
+#endif
+
+static uint32_t storedClock() {
+    SigmaClockRecord record;
+    EEPROM.get(SIGMA_NV_SLOT() + int(sizeof(SigmaNvRecord)), record);
+    return record.magic == SIGMA_CLOCK_MAGIC ? record.clock : 0;
+}
+
+int main() {
+    SigmaDspEmulator dsp(DSP_I2C_ADDR);
+    SigmaBusCounter bus;
+    bus.target = &dsp;
+    SIGMA_HOST_SET_BUS(&bus);
+    SIGMA_I2C_INIT();
+    EEPROM.erase();
+
+    const uint16_t scratch = SCRATCH_ADDR_IC_1;
+    const uint8_t kept[4] = {0x12, 0x34, 0x56, 0x78};
+    dsp.poke(scratch, kept, 4);
+    uint8_t word[4];
+
+    // 线束没有限制：最高一档也留出余量
+    bus.reset();
+    CHECK(SIGMA_QUALIFY_CLOCK(DEVICE_ADDR_IC_1, scratch) == SIGMA_SUCCESS, "qualification failed");
+    size_t sweep = bus.transactions;
+    CHECK(Bus::clock() == kAllPass, "chose %lu Hz, expected %lu", (unsigned long)Bus::clock(),
+          (unsigned long)kAllPass);
+    CHECK(storedClock() == kAllPass, "stored %lu Hz", (unsigned long)storedClock());
+    dsp.readMemory(scratch, word, 4);
+    CHECK(memcmp(word, kept, 4) == 0, "scratch word not restored");
+
+    // 以后启动：直接使用记录，只核对一轮
+    bus.reset();
+    size_t eepromWrites = EEPROM.writes;
+    CHECK(SIGMA_QUALIFY_CLOCK(DEVICE_ADDR_IC_1, scratch) == SIGMA_SUCCESS, "qualification from record failed");
+    CHECK(Bus::clock() == kAllPass, "record not used: %lu Hz", (unsigned long)Bus::clock());
+    CHECK(bus.transactions * SIGMA_QUALIFY_ROUNDS * 2 < sweep, "%zu transactions with a record, %zu for a sweep",
+          bus.transactions, sweep);
+    CHECK(EEPROM.writes == eepromWrites, "unchanged record rewritten");
+    printf("sweep: %zu transactions, boot with record: %zu\n", sweep, bus.transactions);
+
+    // 线束变差：记录的时钟核对失败，重新鉴定，留出余量
+    dsp.maxClock = kHarnessLimit;
+    CHECK(SIGMA_QUALIFY_CLOCK(DEVICE_ADDR_IC_1, scratch) == SIGMA_SUCCESS, "requalification failed");
+    CHECK(Bus::clock() == kWithMargin, "chose %lu Hz, expected %lu", (unsigned long)Bus::clock(),
+          (unsigned long)kWithMargin);
+    CHECK(storedClock() == kWithMargin, "record not updated: %lu Hz", (unsigned long)storedClock());
+    CHECK(SIGMA_GET_LAST_ERROR() == SIGMA_SUCCESS, "failures at faster clocks left error %u", SIGMA_GET_LAST_ERROR());
+    dsp.readMemory(scratch, word, 4);
+    CHECK(memcmp(word, kept, 4) == 0, "scratch word not restored after requalification");
+
+    // 选中的时钟下下载正常
+    dsp.clear();
+    sequence_download_IC_1();
+    CHECK(SIGMA_GET_LAST_ERROR() == SIGMA_SUCCESS, "download error %u", SIGMA_GET_LAST_ERROR());
+    CHECK(SIGMA_VERIFY_SECTIONS(DEVICE_ADDR_IC_1, Sections_IC_1, SECTION_COUNT_IC_1) == SIGMA_SUCCESS,
+          "download at the qualified clock does not verify");
+
+    // DSP运行中重新鉴定：I2C在未鉴定的时钟下只读，错位的子地址不会改写别处；
+    // SPI的命令字节出错会把读取变成写入，拒绝鉴定
+    std::vector<uint8_t> running = dsp.readMemory(0, kImageBytes);
+    bus.reset();
+#if USE_SPI
+    CHECK(SIGMA_QUALIFY_CLOCK(DEVICE_ADDR_IC_1, scratch, true) == SIGMA_ERROR_DSP_RUNNING,
+          "qualification while running not refused");
+    CHECK(bus.transactions == 1, "%zu transactions, expected only the CORE_STATUS read", bus.transactions);
+    SIGMA_CLEAR_ERROR();
+#else
+    CHECK(SIGMA_QUALIFY_CLOCK(DEVICE_ADDR_IC_1, scratch, true) == SIGMA_SUCCESS, "requalification while running failed");
+#endif
+    CHECK(Bus::clock() == kWithMargin, "chose %lu Hz while running", (unsigned long)Bus::clock());
+    std::vector<uint8_t> after = dsp.readMemory(0, kImageBytes);
+    size_t changed = 0;
+    for (size_t i = 0; i < after.size(); i++) {
+        changed += after[i] != running[i];
+    }
+    CHECK(changed == 0, "qualification changed %zu bytes of DSP state", changed);
+
+    // 最慢一档也不行：报错，时钟和记录不变
+    SIGMA_WRITE_REGISTER_INTEGER(DEVICE_ADDR_IC_1, SIGMA_REG_START_CORE, 0);    // 停止内核，SPI也可以鉴定
+    dsp.maxClock = kTooSlow;
+    CHECK(SIGMA_QUALIFY_CLOCK(DEVICE_ADDR_IC_1, scratch, true) == SIGMA_ERROR_BUS_CLOCK, "dead bus not reported");
+    CHECK(SIGMA_GET_LAST_ERROR() == SIGMA_ERROR_BUS_CLOCK, "last error %u", SIGMA_GET_LAST_ERROR());
+    CHECK(Bus::clock() == kWithMargin, "clock changed to %lu Hz", (unsigned long)Bus::clock());
+    CHECK(storedClock() == kWithMargin, "record overwritten: %lu Hz", (unsigned long)storedClock());
+
+    return SIGMA_TEST_RESULT();
+}
@@ -0,0 +1,90 @@
+/*
+ * 在 ADAU1452 模型上运行 sequence_download_IC_1()，
+ * 比较最终的程序/参数/DM1内存和控制寄存器与导出数据是否一致，
+ * 并与导出文件的 default_download_IC_1() 得到的内存状态比较。
+ */
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#include "ADAU1452_EN_B_I2C_IC_1_PARAM.h"
+#include "SigmaDspEmulator.h"
+#include "SigmaTxBuffer.h"
+#include "SigmaTestCheck.h"
+#include <map>
+
+static void checkSection(const SigmaDspEmulator& emu, const char* name,
+                         uint16_t address, const uint8_t* data, size_t length) {
+    size_t at = emu.compare(address, data, length);
+    CHECK(at == length, "%s differs at byte %zu", name, at);
+}
+
+int main() {
+    SigmaDspEmulator emu(DSP_I2C_ADDR);
+    SIGMA_HOST_SET_BUS(&emu);
+    SIGMA_I2C_INIT();
+
+    sequence_download_IC_1();
+
+    checkSection(emu, "Program_Data_IC_1", PROGRAM_ADDR_IC_1, Program_Data_IC_1, PROGRAM_SIZE_IC_1);
+    checkSection(emu, "Param_Data_IC_1", PARAM_ADDR_IC_1, Param_Data_IC_1, PARAM_SIZE_IC_1);
+    checkSection(emu, "DM1_DATA_Data_IC_1", DM1_DATA_ADDR_IC_1, DM1_DATA_Data_IC_1, DM1_DATA_SIZE_IC_1);
+    CHECK(emu.partialWords == 0, "%zu partial words", emu.partialWords);
+    CHECK(emu.nacks == 0, "%zu NACKed transactions", emu.nacks);
+
+    // 每个控制寄存器的最终值应等于导出序列中最后一次写入的值
+    std::vector<SigmaTxEntry> entries;
+    CHECK(SIGMA_LOAD_TX_BUFFER(SIGMA_EXPORT_DIR, 1, entries), "cannot load TxBuffer_IC_1.dat");
+    std::map<uint16_t, uint16_t> registers;
+    for (const SigmaTxEntry& e : entries) {
+        if (!e.isDelay() && e.address >= SIGMA_EMU_REGISTER_ADDR) {
+            for (size_t i = 0; i + 1 < e.data.size(); i += 2) {
+                registers[uint16_t(e.address + i / 2)] = uint16_t((e.data[i] << 8) | e.data[i + 1]);
+            }
+        }
+    }
+    for (const auto& r : registers) {
+        CHECK(emu.registerValue(r.first) == r.second, "register 0x%04X = 0x%04X, expected 0x%04X",
+              r.first, emu.registerValue(r.first), r.second);
+    }
+
+    // 一次读回整个程序内存（超过255字节，I2C按突发分块）
+    std::vector<uint8_t> program(PROGRAM_SIZE_IC_1);
+    CHECK(SIGMA_READ_REGISTER_BYTES(PROGRAM_ADDR_IC_1, PROGRAM_SIZE_IC_1, program.data()) == SIGMA_SUCCESS,
+          "program read back failed");
+    CHECK(memcmp(program.data(), Program_Data_IC_1, PROGRAM_SIZE_IC_1) == 0, "program read back differs");
+
+    // 构建时的CRC与导出数组一致，读回校验通过
+    CHECK(SIGMA_CRC32(0, Program_Data_IC_1, PROGRAM_SIZE_IC_1) == Sections_IC_1[0].crc, "program CRC mismatch");
+    CHECK(SIGMA_CRC32(0, Param_Data_IC_1, PARAM_SIZE_IC_1) == Sections_IC_1[1].crc, "param CRC mismatch");
+    CHECK(SIGMA_CRC32(0, DM1_DATA_Data_IC_1, DM1_DATA_SIZE_IC_1) == Sections_IC_1[2].crc, "DM1 CRC mismatch");
+    int section = 0;
+    CHECK(SIGMA_VERIFY_SECTIONS(DEVICE_ADDR_IC_1, Sections_IC_1, SECTION_COUNT_IC_1, &section) == SIGMA_SUCCESS &&
+          section == -1, "verify failed at section %d", section);
+
+    // 改动DM1中的一个字节后应检测到对应的段
+    uint8_t word[4];
+    memcpy(word, DM1_DATA_Data_IC_1 + DM1_DATA_SIZE_IC_1 - 4, 4);
+    word[3] ^= 0x01;
+    emu.poke(uint16_t(DM1_DATA_ADDR_IC_1 + DM1_DATA_SIZE_IC_1 / 4 - 1), word, 4);
+    CHECK(SIGMA_VERIFY_SECTIONS(DEVICE_ADDR_IC_1, Sections_IC_1, SECTION_COUNT_IC_1, &section) == SIGMA_ERROR_VERIFY &&
+          section == 2, "corrupted DM1 not detected (section %d)", section);
+    SIGMA_CLEAR_ERROR();
+
+    // 导出文件逐条展开的下载与序列表结果相同（在改动DM1之前的状态上比较）
+    SigmaDspEmulator unrolled(DSP_I2C_ADDR);
+    SIGMA_HOST_SET_BUS(&unrolled);
+    default_download_IC_1();
+    SIGMA_HOST_SET_BUS(&emu);
+    emu.poke(uint16_t(DM1_DATA_ADDR_IC_1 + DM1_DATA_SIZE_IC_1 / 4 - 1), DM1_DATA_Data_IC_1 + DM1_DATA_SIZE_IC_1 - 4, 4);
+    size_t imageBytes = size_t(SIGMA_EMU_REGISTER_ADDR) * 4 + 0x1000 * 2;
+    CHECK(unrolled.readMemory(0, imageBytes) == emu.readMemory(0, imageBytes),
+          "default_download_IC_1() and sequence_download_IC_1() differ");
+    CHECK(SIGMA_GET_LAST_ERROR() == SIGMA_SUCCESS, "default_download_IC_1() error %d", SIGMA_GET_LAST_ERROR());
+
+    // 参数读写往返
+    SIGMA_WRITE_REGISTER_FLOAT(MOD_GEN1STORDER1_ALG0_PARAMB0_1_ADDR, 0.25);
+    double value = SIGMA_READ_REGISTER_FLOAT(MOD_GEN1STORDER1_ALG0_PARAMB0_1_ADDR);
+    CHECK(value == 0.25, "read back %f", value);
+    CHECK(SIGMA_GET_LAST_ERROR() == SIGMA_SUCCESS, "last error %d", SIGMA_GET_LAST_ERROR());
+
+    printf("%zu words written in %zu transactions\n", emu.wordsWritten, emu.writeTransactions);
+    return SIGMA_TEST_RESULT();
+}
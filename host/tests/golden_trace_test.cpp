@@ -0,0 +1,265 @@
+/*
+ * 金标准轨迹回归测试：录制 default_download_IC_1() 和 sequence_download_IC_1() 的总线流量，
+ * 与 TxBuffer_IC_1.dat/NumBytes_IC_1.dat 比较逻辑写入流。
+ *
+ * 比较以"字写入"为单位（地址 + 字内容，按顺序），因此任意重新分块或
+ * 合并相邻写入都能通过，而遗漏、改写或重排写入都会失败。
+ * 延迟是排序屏障：任何物理事务都不能跨越导出序列中的延迟。延迟可能被
+ * 改为轮询状态寄存器，所以总线后面接 ADAU1452 模型来回答状态读取。
+ * 同一比较也覆盖直接回放导出文件的 SIGMA_RUN_TXBUFFER() 和压缩序列。
+ */
+#define SIGMA_LZ_ENABLE true    // 使用压缩序列
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ_LZ.h"
+#include "SigmaDspEmulator.h"
+#include "SigmaTxBuffer.h"
+#include "SigmaTestCheck.h"
+
+ADI_REG_TYPE TxBuffer_IC_1[] = {
+#include "TxBuffer_IC_1.dat"
+};
+
+ADI_DATA_U16 NumBytes_IC_1[] = {
+#include "NumBytes_IC_1.dat"
+};
+
+// 非阻塞执行：每步之间模拟主循环的其他工作，等待时每次只推进1ms
+static size_t g_max_step_transactions = 0;
+static bool g_progress_ok = true;
+
+static void stepped_run(const SigmaSeqEntry table[], int count, const uint8_t blob[]) {
+    SigmaBusRecorder* bus = static_cast<SigmaBusRecorder*>(SIGMA_HOST_BUS());
+    SigmaSeqState dl;
+    SIGMA_SEQ_START(&dl, DEVICE_ADDR_IC_1, table, count, blob);
+    uint32_t lastSent = 0;
+    bool more = true;
+    while (more) {
+        size_t before = bus->log.size();
+        more = SIGMA_SEQ_STEP(&dl);
+        g_max_step_transactions = std::max(g_max_step_transactions, bus->log.size() - before);
+        if (dl.bytesSent < lastSent || dl.bytesSent > dl.bytesTotal) {
+            g_progress_ok = false;
+        }
+        lastSent = dl.bytesSent;
+        if (SIGMA_SEQ_WAIT_MS(&dl)) {
+            delay(1);
+        }
+    }
+    // 数据块中除4个2字节延迟外都是写入数据
+    if (dl.bytesSent != dl.bytesTotal || dl.bytesTotal != SEQUENCE_BLOB_SIZE_IC_1 - 8) {
+        g_progress_ok = false;
+    }
+}
+
+static void table_download_IC_1() {
+    sequence_download_IC_1();
+}
+
+static void stepped_download_IC_1() {
+    stepped_run(Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1);
+}
+
+static void lz_download_IC_1() {
+    sequence_download_LZ_IC_1();
+}
+
+static void stepped_lz_download_IC_1() {
+    stepped_run(Sequence_LZ_IC_1, SEQUENCE_LZ_SIZE_IC_1, Sequence_LZ_Blob_IC_1);
+}
+
+static void replay_TxBuffer_IC_1() {
+    SIGMA_RUN_TXBUFFER(DEVICE_ADDR_IC_1, TxBuffer_IC_1, NumBytes_IC_1, sizeof(NumBytes_IC_1) / sizeof(NumBytes_IC_1[0]));
+}
+
+// 优化前（MAX_I2C_DATA_LENGTH=30，逐事务发送）的物理事务数，作为对比基准
+#if USE_SPI
+static const size_t kBaselineTransactions = 69;
+#else
+static const size_t kBaselineTransactions = 531;
+#endif
+#if USE_SPI == false && MAX_I2C_DATA_LENGTH == 30
+// 分块计划在编译期即可求值
+static_assert(SIGMA_CHUNK_COUNT(PROGRAM_ADDR_IC_1, PROGRAM_SIZE_IC_1) == 240, "program chunk plan");
+static_assert(SIGMA_CHUNK_COUNT(PARAM_ADDR_IC_1, PARAM_SIZE_IC_1) == 155, "param chunk plan");
+static_assert(SIGMA_CHUNK_COUNT(DM1_DATA_ADDR_IC_1, DM1_DATA_SIZE_IC_1) == 70, "DM1 chunk plan");
+static_assert(SIGMA_CHUNK_LENGTH(0xEFFE, 28) == 8, "chunks stop at the register boundary");
+#endif
+// 非阻塞执行时SPI的大块按 SIGMA_SPI_STEP_BYTES 切分，允许多出相应的事务
+#if USE_SPI
+static const size_t kSteppedTransactions = kBaselineTransactions + SEQUENCE_BLOB_SIZE_IC_1 / SIGMA_SPI_STEP_BYTES;
+#else
+static const size_t kSteppedTransactions = kBaselineTransactions;
+#endif
+static const size_t kOverheadPerTransaction = 3;   // I2C: 设备地址+2字节子地址；SPI: 命令+2字节地址
+
+struct WordWrite {
+    uint16_t address;
+    uint32_t value;
+    size_t barrier;     // 之前经过的延迟个数
+    size_t physical;    // 所属物理事务序号（导出序列中为逻辑事务序号）
+
+    bool operator==(const WordWrite& o) const {
+        return address == o.address && value == o.value && barrier == o.barrier;
+    }
+};
+
+static uint8_t wordWidth(uint16_t address) {
+    return address < 0xF000 ? 4 : 2;
+}
+
+// 把一次写入展开为字序列，返回不完整尾字的字节数
+static size_t expand(uint16_t address, const uint8_t* data, size_t length, size_t barrier,
+                     size_t physical, std::vector<WordWrite>& out) {
+    size_t pos = 0;
+    while (pos < length) {
+        uint8_t width = wordWidth(address);
+        if (length - pos < width) {
+            return length - pos;
+        }
+        uint32_t value = 0;
+        for (uint8_t i = 0; i < width; i++) {
+            value = (value << 8) | data[pos + i];
+        }
+        out.push_back(WordWrite{address, value, barrier, physical});
+        pos += width;
+        address++;
+    }
+    return 0;
+}
+
+// 录制一次下载并与期望的字写入流比较
+static void checkTrace(const char* label, void (*download)(), bool planned, const std::vector<SigmaTxEntry>& entries,
+                      const std::vector<WordWrite>& expected, size_t logicalWrites,
+                      size_t maxTransactions = kBaselineTransactions) {
+    SigmaDspEmulator dsp(DSP_I2C_ADDR);
+    SigmaBusRecorder bus;
+    bus.target = &dsp;
+    SIGMA_HOST_SET_BUS(&bus);
+    SIGMA_I2C_INIT();
+    bus.clear();
+    uint64_t start = SIGMA_HOST_TIME_US();
+    if (planned) {
+        SIGMA_DOWNLOAD_BEGIN();
+    }
+    download();
+    if (planned) {
+        SIGMA_DOWNLOAD_END();
+    }
+    uint64_t waitMs = (SIGMA_HOST_TIME_US() - start) / 1000;
+
+    // 物理轨迹中的延迟屏障由虚拟时钟的推进或状态轮询（读事务）识别
+    std::vector<WordWrite> actual;
+    size_t physical = 0;
+    size_t partial = 0;
+    size_t barriers = 0;
+    bool pendingBarrier = false;
+    uint64_t lastTime = bus.log.empty() ? 0 : bus.log.front().timeUs;
+    for (const SigmaBusTransaction& t : bus.log) {
+        if (t.timeUs != lastTime) {
+            pendingBarrier = true;
+            lastTime = t.timeUs;
+        }
+        size_t header = t.kind == SIGMA_BUS_SPI ? 3 : 2;
+        if (t.kind == SIGMA_BUS_I2C_READ || t.data.size() <= header ||
+            (t.kind == SIGMA_BUS_SPI && (t.data[0] & 0x01))) {
+            pendingBarrier = true;
+            continue;
+        }
+        if (pendingBarrier) {
+            barriers++;
+            pendingBarrier = false;
+        }
+        uint16_t address = uint16_t((t.data[header - 2] << 8) | t.data[header - 1]);
+        size_t first = actual.size();
+        partial += expand(address, t.data.data() + header, t.data.size() - header, barriers,
+                          physical, actual);
+        // 屏障寄存器必须单独成为一个事务
+        for (size_t i = first; i < actual.size(); i++) {
+            CHECK(!SIGMA_IS_BARRIER_REGISTER(actual[i].address) || actual.size() - first == 1,
+                  "[%s] barrier register 0x%04X shares transaction %zu with %zu other words", label,
+                  actual[i].address, physical, actual.size() - first - 1);
+        }
+        physical++;
+    }
+
+    CHECK(partial == 0, "[%s] %zu bytes of partial words on the bus", label, partial);
+    size_t n = expected.size() < actual.size() ? expected.size() : actual.size();
+    size_t i = 0;
+    while (i < n && expected[i] == actual[i]) {
+        i++;
+    }
+    CHECK(i == n, "[%s] word %zu (%s): expected 0x%04X=0x%08X barrier %zu, got 0x%04X=0x%08X barrier %zu",
+          label, i, entries[expected[i].physical].name.c_str(), expected[i].address, expected[i].value,
+          expected[i].barrier, actual[i].address, actual[i].value, actual[i].barrier);
+    CHECK(expected.size() == actual.size(), "[%s] expected %zu words, bus carried %zu", label, expected.size(),
+          actual.size());
+    CHECK(physical <= maxTransactions, "[%s] %zu physical write transactions, limit is %zu", label, physical,
+          maxTransactions);
+
+    // 固定延迟总和 = 实际等待 + 轮询节省；导出文件逐条展开的下载（SIGMA_WRITE_DELAY）不轮询
+    bool polled = SIGMA_POLL_READY && download != default_download_IC_1;
+    uint64_t fixedMs = 0;
+    for (const SigmaTxEntry& e : entries) {
+        if (e.isDelay()) {
+            fixedMs += SIGMA_DELAY_MS(int(e.data.size()), e.data.data());
+        }
+    }
+    CHECK(waitMs + SIGMA_WAIT_SAVED_MS() == fixedMs && (!polled || SIGMA_WAIT_SAVED_MS() != 0),
+          "[%s] waited %llu ms, saved %lu ms, exported delays total %llu ms", label, (unsigned long long)waitMs,
+          (unsigned long)SIGMA_WAIT_SAVED_MS(), (unsigned long long)fixedMs);
+
+    size_t overhead = physical * kOverheadPerTransaction;
+    size_t baselineOverhead = kBaselineTransactions * kOverheadPerTransaction;
+    printf("[%s]\n", label);
+    printf("  logical writes:        %zu (+%zu delays)\n", logicalWrites, barriers);
+    printf("  words:                 %zu\n", actual.size());
+    printf("  physical transactions: %zu (baseline %zu, %.1f%% fewer)\n", physical, kBaselineTransactions,
+           100.0 * (double(kBaselineTransactions) - physical) / kBaselineTransactions);
+    printf("  overhead bytes:        %zu (baseline %zu, %.1f%% fewer)\n", overhead, baselineOverhead,
+           100.0 * (double(baselineOverhead) - overhead) / baselineOverhead);
+    printf("  host wait:             %llu ms (fixed delays %llu ms, %lu ms saved by polling)\n",
+           (unsigned long long)waitMs, (unsigned long long)fixedMs, (unsigned long)SIGMA_WAIT_SAVED_MS());
+}
+
+int main() {
+    std::vector<SigmaTxEntry> entries;
+    if (!SIGMA_LOAD_TX_BUFFER(SIGMA_EXPORT_DIR, 1, entries)) {
+        CHECK(false, "cannot load TxBuffer_IC_1.dat/NumBytes_IC_1.dat");
+        return SIGMA_TEST_RESULT();
+    }
+
+    std::vector<WordWrite> expected;
+    size_t barriers = 0;
+    size_t logicalWrites = 0;
+    for (size_t i = 0; i < entries.size(); i++) {
+        const SigmaTxEntry& e = entries[i];
+        if (e.isDelay()) {
+            barriers++;
+            continue;
+        }
+        logicalWrites++;
+        expand(e.address, e.data.data(), e.data.size(), barriers, i, expected);
+    }
+
+#if USE_SPI == false
+    printf("I2C burst: %d data bytes\n", MAX_I2C_DATA_LENGTH);
+#endif
+    checkTrace("default_download_IC_1", default_download_IC_1, false, entries, expected, logicalWrites);
+    checkTrace("planned download", default_download_IC_1, true, entries, expected, logicalWrites);
+    checkTrace("sequence_download_IC_1", table_download_IC_1, false, entries, expected, logicalWrites);
+    checkTrace("planned sequence download", table_download_IC_1, true, entries, expected, logicalWrites);
+    checkTrace("stepped download", stepped_download_IC_1, false, entries, expected, logicalWrites,
+               kSteppedTransactions);
+    checkTrace("planned stepped download", stepped_download_IC_1, true, entries, expected, logicalWrites,
+               kSteppedTransactions);
+    checkTrace("compressed download", lz_download_IC_1, false, entries, expected, logicalWrites);
+    checkTrace("planned compressed download", lz_download_IC_1, true, entries, expected, logicalWrites);
+    checkTrace("stepped compressed download", stepped_lz_download_IC_1, false, entries, expected,
+               logicalWrites, kSteppedTransactions);
+    // I2C每步最多一个突发；状态轮询和计划器冲刷加发送各为两个事务
+    CHECK(g_max_step_transactions <= 2 && g_progress_ok, "[stepped download] up to %zu transactions per step, "
+          "progress %s", g_max_step_transactions, g_progress_ok ? "ok" : "inconsistent");
+    checkTrace("TxBuffer replay", replay_TxBuffer_IC_1, false, entries, expected, logicalWrites);
+    checkTrace("planned TxBuffer replay", replay_TxBuffer_IC_1, true, entries, expected, logicalWrites);
+    return SIGMA_TEST_RESULT();
+}
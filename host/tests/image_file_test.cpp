@@ -0,0 +1,241 @@
+/*
+ * 从文件系统加载镜像：在 ADAU1452 模型上用目录映射的 LittleFS 替身执行
+ * sigma_sequence_gen --image 生成的镜像，验证
+ *   - 整个地址空间与执行编译进闪存的序列相同，总线事务数和字节数也相同（含计划器合并；
+ *     SPI按暂存区分块，多出的事务每个至少带一整块）；
+ *   - 稀疏镜像（零段不存数据）的结果相同；
+ *   - 文件按块读取，核对和执行各读一遍，延迟期间预读了下一块；
+ *   - 损坏、被截断或不存在的文件返回 SIGMA_ERROR_IMAGE，且没有任何总线事务；
+ *   - 读文件时没有进行中的SPI事务（SD卡与DSP共用SPI总线），核对之后读取失败时
+ *     不再写入，也没有留下要提交的半个事务。
+ */
+#include <string>
+#include <vector>
+#include <LittleFS.h>
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#include "SigmaDspEmulator.h"
+#include "SigmaTestCheck.h"
+
+#if USE_SPI
+static const char* kTag = "_spi";
+#else
+static const char* kTag = "";
+#endif
+
+// 整个地址空间：内存每字4字节，寄存器每字2字节
+static const size_t kImageBytes = size_t(SIGMA_EMU_REGISTER_ADDR) * 4 + 0x1000 * 2;
+
+// 记录SPI片选是否有效
+class SpiWatch : public SigmaBusCounter {
+public:
+    bool selected = false;
+
+    void spiBegin() override {
+        selected = true;
+        SigmaBusCounter::spiBegin();
+    }
+
+    void spiEnd() override {
+        SigmaBusCounter::spiEnd();
+        selected = false;
+    }
+};
+
+// 包一层文件：统计SPI事务进行中的读取，第 failAt 次读取（从1开始，0 不失败）什么也读不到
+struct WatchedFile {
+    File file;
+    const SpiWatch* bus;
+    size_t failAt;
+    size_t reads = 0;
+    size_t readsWhileSelected = 0;
+    size_t transactionsAtFailure = 0;
+    bool selectedAtFailure = false;
+
+    size_t read(uint8_t* buf, size_t size) {
+        reads++;
+        readsWhileSelected += bus->selected ? 1 : 0;
+        if (reads == failAt) {
+            transactionsAtFailure = bus->transactions;
+            selectedAtFailure = bus->selected;
+            return 0;
+        }
+        return file.read(buf, size);
+    }
+
+    bool seek(uint32_t pos) { return file.seek(pos); }
+    size_t size() const { return file.size(); }
+};
+
+struct Run {
+    uint8_t result;
+    size_t transactions;
+    size_t payloadBytes;
+    std::vector<uint8_t> image;
+};
+
+static Run finish(SigmaDspEmulator& dsp, SigmaBusCounter& bus, uint8_t result) {
+    Run r;
+    r.result = result;
+    r.transactions = bus.transactions;
+    r.payloadBytes = bus.payloadBytes;
+    r.image = dsp.readMemory(0, kImageBytes);
+    return r;
+}
+
+static Run fromFlash(SigmaDspEmulator& dsp, SpiWatch& bus, bool planned) {
+    dsp.clear();
+    bus.reset();
+    if (planned) {
+        SIGMA_DOWNLOAD_BEGIN();
+    }
+    uint8_t result = SIGMA_RUN_SEQUENCE(DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1);
+    if (planned) {
+        uint8_t end = SIGMA_DOWNLOAD_END();
+        result = result != SIGMA_SUCCESS ? result : end;
+    }
+    return finish(dsp, bus, result);
+}
+
+static Run fromFile(SigmaDspEmulator& dsp, SpiWatch& bus, const std::string& path, bool planned,
+                    SigmaImageReader* reader, size_t* fileReads = nullptr) {
+    dsp.clear();
+    bus.reset();
+    SIGMA_CLEAR_ERROR();
+    WatchedFile file = {LittleFS.open(path.c_str(), "r"), &bus, 0};
+    if (planned) {
+        SIGMA_DOWNLOAD_BEGIN();
+    }
+    uint8_t result = SIGMA_RUN_IMAGE(DEVICE_ADDR_IC_1, file, reader);
+    if (planned) {
+        uint8_t end = SIGMA_DOWNLOAD_END();
+        result = result != SIGMA_SUCCESS ? result : end;
+    }
+    if (fileReads) {
+        *fileReads = file.reads;
+    }
+    CHECK(file.readsWhileSelected == 0, "[%s] %zu file reads inside an SPI transaction", path.c_str(),
+          file.readsWhileSelected);
+    return finish(dsp, bus, result);
+}
+
+static void checkSame(const char* label, const Run& flash, const Run& r) {
+    size_t at = 0;
+    while (at < flash.image.size() && flash.image[at] == r.image[at]) {
+        at++;
+    }
+    CHECK(r.result == SIGMA_SUCCESS, "[%s] result %u", label, r.result);
+    CHECK(at == flash.image.size(), "[%s] memory differs at byte offset 0x%zX", label, at);
+#if USE_SPI
+    CHECK(r.transactions >= flash.transactions &&
+              r.transactions - flash.transactions <= flash.payloadBytes / SIGMA_IMAGE_STAGE,
+          "[%s] %zu transactions, %zu from flash", label, r.transactions, flash.transactions);
+#else
+    CHECK(r.transactions == flash.transactions, "[%s] %zu transactions, %zu from flash", label, r.transactions,
+          flash.transactions);
+#endif
+    CHECK(r.payloadBytes == flash.payloadBytes, "[%s] %zu payload bytes, %zu from flash", label, r.payloadBytes,
+          flash.payloadBytes);
+}
+
+static std::vector<uint8_t> readHostFile(const std::string& path) {
+    std::vector<uint8_t> data;
+    FILE* f = fopen(path.c_str(), "rb");
+    if (f) {
+        int c;
+        while ((c = fgetc(f)) != EOF) {
+            data.push_back(uint8_t(c));
+        }
+        fclose(f);
+    }
+    return data;
+}
+
+static void writeHostFile(const std::string& path, const std::vector<uint8_t>& data) {
+    FILE* f = fopen(path.c_str(), "wb");
+    if (f) {
+        fwrite(data.data(), 1, data.size(), f);
+        fclose(f);
+    }
+}
+
+// 有问题的文件：不写入DSP
+static void checkRejected(const char* label, SigmaDspEmulator& dsp, SpiWatch& bus, const std::string& path,
+                          SigmaImageReader* reader) {
+    Run r = fromFile(dsp, bus, path, false, reader);
+    CHECK(r.result == SIGMA_ERROR_IMAGE, "[%s] result %u", label, r.result);
+    CHECK(SIGMA_GET_LAST_ERROR() == SIGMA_ERROR_IMAGE, "[%s] last error %u", label, SIGMA_GET_LAST_ERROR());
+    CHECK(r.transactions == 0, "[%s] %zu bus transactions before the image was rejected", label, r.transactions);
+}
+
+int main() {
+    SigmaDspEmulator dsp(DSP_I2C_ADDR);
+    SpiWatch bus;
+    bus.target = &dsp;
+    SIGMA_HOST_SET_BUS(&bus);
+    SIGMA_I2C_INIT();
+
+    LittleFS.root = SIGMA_IMAGE_DIR;
+    CHECK(LittleFS.begin(), "LittleFS.begin() failed");
+    const std::string plain = "/ADAU1452_EN_B_I2C_IC_1.sigi";
+    const std::string sparse = "/ADAU1452_EN_B_I2C_IC_1_SPARSE.sigi";
+    static SigmaImageReader reader;
+
+    Run flash = fromFlash(dsp, bus, false);
+    CHECK(flash.result == SIGMA_SUCCESS, "flash download result %u", flash.result);
+
+    // 文件头1次读取，核对和执行各按块读一遍
+    size_t fileReads = 0;
+    Run file = fromFile(dsp, bus, plain, false, &reader, &fileReads);
+    checkSame("image", flash, file);
+    std::vector<uint8_t> bytes = readHostFile(SIGMA_IMAGE_DIR + plain);
+    size_t blocks = (bytes.size() - SIGMA_IMAGE_HEADER + SIGMA_IMAGE_BLOCK - 1) / SIGMA_IMAGE_BLOCK;
+    CHECK(fileReads == 1 + 2 * blocks, "%zu file reads for %zu blocks", fileReads, blocks);
+    CHECK(reader.prefetched > 0, "nothing read ahead during delays");
+    printf("image: %zu bytes, %zu file reads, %lu blocks read ahead during delays\n", bytes.size(), fileReads,
+           (unsigned long)reader.prefetched);
+
+    const SigmaBootTiming* timing = SIGMA_GET_BOOT_TIMING();
+    CHECK(timing->phase[SIGMA_PHASE_PROGRAM].bytes == PROGRAM_SIZE_IC_1, "program phase %lu bytes",
+          (unsigned long)timing->phase[SIGMA_PHASE_PROGRAM].bytes);
+
+    Run flashPlanned = fromFlash(dsp, bus, true);
+    Run filePlanned = fromFile(dsp, bus, plain, true, &reader);
+    checkSame("image, planned", flashPlanned, filePlanned);
+
+    Run fileSparse = fromFile(dsp, bus, sparse, false, &reader);
+    CHECK(fileSparse.result == SIGMA_SUCCESS, "sparse image result %u", fileSparse.result);
+    CHECK(fileSparse.image == flash.image, "sparse image memory differs");
+    CHECK(readHostFile(SIGMA_IMAGE_DIR + sparse).size() < bytes.size(), "sparse image is not smaller");
+
+    // 中间一个字节被改坏
+    std::string corrupt = "/corrupt" + std::string(kTag) + ".sigi";
+    std::vector<uint8_t> damaged = bytes;
+    damaged[damaged.size() / 2] ^= 0x10;
+    writeHostFile(SIGMA_IMAGE_DIR + corrupt, damaged);
+    checkRejected("corrupt", dsp, bus, corrupt, &reader);
+
+    // 只复制了一半
+    std::string truncated = "/truncated" + std::string(kTag) + ".sigi";
+    writeHostFile(SIGMA_IMAGE_DIR + truncated, std::vector<uint8_t>(bytes.begin(), bytes.begin() + bytes.size() / 2));
+    checkRejected("truncated", dsp, bus, truncated, &reader);
+
+    checkRejected("missing", dsp, bus, "/missing.sigi", &reader);
+
+    // 核对通过后文件读不出来了（执行阶段中间的一块）：停在失败处，之后没有事务
+    dsp.clear();
+    bus.reset();
+    WatchedFile failing = {LittleFS.open(plain.c_str(), "r"), &bus, 1 + blocks + blocks / 2};
+    CHECK(SIGMA_RUN_IMAGE(DEVICE_ADDR_IC_1, failing, &reader) == SIGMA_ERROR_IMAGE, "failed read not reported");
+    CHECK(failing.reads == failing.failAt, "%zu file reads, failure injected at %zu", failing.reads, failing.failAt);
+    CHECK(!failing.selectedAtFailure, "SPI transaction open when the file read failed");
+    CHECK(bus.transactions == failing.transactionsAtFailure, "%zu bus transactions after the failed read",
+          bus.transactions - failing.transactionsAtFailure);
+
+    // 不带读取缓冲区的重载使用内部静态的一份
+    dsp.clear();
+    File again = LittleFS.open(plain.c_str(), "r");
+    CHECK(SIGMA_RUN_IMAGE(DEVICE_ADDR_IC_1, again) == SIGMA_SUCCESS, "SIGMA_RUN_IMAGE without reader failed");
+    CHECK(dsp.readMemory(0, kImageBytes) == flash.image, "memory differs without reader");
+
+    return SIGMA_TEST_RESULT();
+}
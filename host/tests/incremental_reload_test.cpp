@@ -0,0 +1,158 @@
+/*
+ * 增量重载：在 ADAU1452 模型和内存中的 EEPROM 上模拟固件更新，验证
+ *   - 没有记录时完整下载并保存各组哈希；
+ *   - 只改了参数（DM0）时只重写DM0，不复位、不停止内核；
+ *   - 改了寄存器组时只重写该组；
+ *   - 改了程序或DSP掉过电时完整下载；
+ *   - 生成的 Signature_IC_1/GroupHash_IC_1 与序列表和数据块一致。
+ */
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#include "SigmaDspEmulator.h"
+#include "SigmaTestCheck.h"
+
+// 一个完整的镜像：序列表、数据块，以及按生成器的规则重新计算的签名和组哈希
+struct Image {
+    std::vector<SigmaSeqEntry> table;
+    std::vector<uint8_t> blob;
+    SigmaSignature signature;
+    uint32_t hash[SIGMA_GROUP_COUNT];
+
+    const uint8_t* entryData(int group) {
+        for (const SigmaSeqEntry& e : table) {
+            if (e.group == group && e.opcode == SIGMA_SEQ_WRITE) {
+                return &blob[e.offset];
+            }
+        }
+        return nullptr;
+    }
+
+    void rehash() {
+        signature.value = 0;
+        for (int g = 0; g < SIGMA_GROUP_COUNT; g++) {
+            hash[g] = 0;
+        }
+        for (const SigmaSeqEntry& e : table) {
+            uint8_t address[2] = {uint8_t(e.address >> 8), uint8_t(e.address)};
+            hash[e.group] = SIGMA_CRC32(SIGMA_CRC32(hash[e.group], address, 2), &blob[e.offset], e.length);
+            if (e.group != SIGMA_GROUP_CONTROL) {
+                signature.value = SIGMA_CRC32(SIGMA_CRC32(signature.value, address, 2), &blob[e.offset], e.length);
+            }
+        }
+    }
+};
+
+static Image exportedImage() {
+    Image image;
+    image.table.assign(Sequence_IC_1, Sequence_IC_1 + SEQUENCE_SIZE_IC_1);
+    image.blob.assign(Sequence_Blob_IC_1, Sequence_Blob_IC_1 + SEQUENCE_BLOB_SIZE_IC_1);
+    image.signature = Signature_IC_1;
+    image.rehash();
+    return image;
+}
+
+// 按写入的起始地址检查下载期间写过哪些寄存器（I2C读取的子地址阶段和SPI读命令不算）
+class ControlWatcher : public SigmaBusRecorder {
+public:
+    template <typename Pred>
+    size_t writesTo(Pred pred) const {
+        size_t n = 0;
+        for (const SigmaBusTransaction& t : log) {
+            size_t header = t.kind == SIGMA_BUS_SPI ? 1 : 0;
+            if (t.kind != SIGMA_BUS_I2C_READ && t.data.size() > header + 2 &&
+                !(t.kind == SIGMA_BUS_SPI && t.data[0] != 0) &&
+                pred(uint16_t((t.data[header] << 8) | t.data[header + 1]))) {
+                n++;
+            }
+        }
+        return n;
+    }
+
+    bool touched(uint16_t address) const {
+        return writesTo([&](uint16_t a) { return a == address; }) > 0;
+    }
+
+    size_t registerWrites() const {
+        return writesTo([](uint16_t a) { return a >= SIGMA_EMU_REGISTER_ADDR; });
+    }
+};
+
+static uint8_t boot(Image& image, ControlWatcher& bus) {
+    bus.clear();
+    return SIGMA_BOOT_INCREMENTAL(DEVICE_ADDR_IC_1, image.table.data(), int(image.table.size()), image.blob.data(),
+                                  &image.signature, image.hash);
+}
+
+static void checkLoaded(const char* label, SigmaDspEmulator& dsp, Image& image) {
+    for (const SigmaSeqEntry& e : image.table) {
+        if (e.opcode == SIGMA_SEQ_WRITE && e.address < 0xF000) {
+            size_t at = dsp.compare(e.address, &image.blob[e.offset], e.length);
+            CHECK(at == e.length, "[%s] memory at 0x%04X differs at byte %zu", label, e.address, at);
+        }
+    }
+    CHECK(SIGMA_WARM_BOOT_MATCH(DEVICE_ADDR_IC_1, &image.signature), "[%s] DSP does not report the new image", label);
+    SigmaNvRecord record;
+    CHECK(SIGMA_NV_LOAD(&record) && record.image == image.signature.value &&
+          memcmp(record.hash, image.hash, sizeof(record.hash)) == 0, "[%s] EEPROM record not updated", label);
+}
+
+int main() {
+    SigmaDspEmulator dsp(DSP_I2C_ADDR);
+    ControlWatcher bus;
+    bus.target = &dsp;
+    SIGMA_HOST_SET_BUS(&bus);
+    SIGMA_I2C_INIT();
+
+    Image v1 = exportedImage();
+    CHECK(v1.signature.value == Signature_IC_1.value, "Signature_IC_1 is stale");
+    CHECK(memcmp(v1.hash, GroupHash_IC_1, sizeof(v1.hash)) == 0, "GroupHash_IC_1 is stale");
+
+    // 首次启动：EEPROM为空
+    CHECK(boot(v1, bus) == SIGMA_SUCCESS, "first boot failed");
+    CHECK(SIGMA_BOOT_MODE() == SIGMA_BOOT_MODE_COLD && SIGMA_BOOT_GROUPS() == SIGMA_GROUP_ALL, "first boot mode %u",
+          SIGMA_BOOT_MODE());
+    size_t fullWrites = bus.writeCount();
+    checkLoaded("first boot", dsp, v1);
+
+    // 同一固件再次启动
+    CHECK(boot(v1, bus) == SIGMA_SUCCESS && SIGMA_BOOT_MODE() == SIGMA_BOOT_MODE_WARM, "warm boot mode %u",
+          SIGMA_BOOT_MODE());
+
+    // 只改参数：只重写DM0，内核不停
+    Image v2 = v1;
+    const_cast<uint8_t*>(v2.entryData(SIGMA_GROUP_DM0))[3] ^= 0x40;
+    v2.rehash();
+    CHECK(boot(v2, bus) == SIGMA_SUCCESS, "param update failed");
+    CHECK(SIGMA_BOOT_MODE() == SIGMA_BOOT_MODE_INCREMENTAL && SIGMA_BOOT_GROUPS() == SIGMA_GROUP_BIT(SIGMA_GROUP_DM0),
+          "param update mode %u, groups 0x%02X", SIGMA_BOOT_MODE(), SIGMA_BOOT_GROUPS());
+    CHECK(bus.registerWrites() == 0, "param update wrote %zu control registers", bus.registerWrites());
+    printf("param update: %zu write transactions (full download %zu)\n", bus.writeCount(), fullWrites);
+    checkLoaded("param update", dsp, v2);
+
+    // 改一个路由寄存器：只重写IO组
+    Image v3 = v2;
+    const_cast<uint8_t*>(v3.entryData(SIGMA_GROUP_IO))[1] ^= 0x01;
+    v3.rehash();
+    CHECK(boot(v3, bus) == SIGMA_SUCCESS, "register update failed");
+    CHECK(SIGMA_BOOT_MODE() == SIGMA_BOOT_MODE_INCREMENTAL && SIGMA_BOOT_GROUPS() == SIGMA_GROUP_BIT(SIGMA_GROUP_IO),
+          "register update mode %u, groups 0x%02X", SIGMA_BOOT_MODE(), SIGMA_BOOT_GROUPS());
+    printf("register update: %zu write transactions\n", bus.writeCount());
+    checkLoaded("register update", dsp, v3);
+
+    // 改程序：完整下载（停止内核）
+    Image v4 = v3;
+    const_cast<uint8_t*>(v4.entryData(SIGMA_GROUP_PROGRAM))[100] ^= 0x01;
+    v4.rehash();
+    CHECK(boot(v4, bus) == SIGMA_SUCCESS, "program update failed");
+    CHECK(SIGMA_BOOT_MODE() == SIGMA_BOOT_MODE_COLD && bus.touched(SIGMA_EMU_START_CORE), "program update mode %u",
+          SIGMA_BOOT_MODE());
+    checkLoaded("program update", dsp, v4);
+
+    // DSP掉电后换回只改了参数的固件：记录的镜像已不在DSP中，完整下载
+    dsp.clear();
+    CHECK(boot(v2, bus) == SIGMA_SUCCESS, "boot after power cycle failed");
+    CHECK(SIGMA_BOOT_MODE() == SIGMA_BOOT_MODE_COLD, "boot after power cycle mode %u", SIGMA_BOOT_MODE());
+    checkLoaded("power cycle", dsp, v2);
+    CHECK(SIGMA_GET_LAST_ERROR() == SIGMA_SUCCESS, "last error %u", SIGMA_GET_LAST_ERROR());
+
+    return SIGMA_TEST_RESULT();
+}
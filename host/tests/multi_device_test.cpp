@@ -0,0 +1,193 @@
+/*
+ * 多DSP：同一条I2C总线上挂两个 ADAU1452 模型（I2C 0x39、0x3A，即导出地址 0x72、0x74）
+ * 和一个默认地址的模型，验证
+ *   - 登记之后带设备地址的调用发往该设备，同一个导出序列下载到两片DSP，结果相同；
+ *   - 最后的错误、重试计数、事务计数各设备一份，一片DSP断开不影响另一片的状态；
+ *   - 各设备鉴定出的总线时钟分别记住，切换设备时传输改用该设备的时钟；
+ *   - 增量重载/热启动的EEPROM记录和结果各设备一份；
+ *   - 计划器中待发的写入在切换设备前发往原来的设备，不与另一设备的写入合并；
+ *   - 未登记的地址仍发往传输的地址（DSP_I2C_ADDR），但没有EEPROM记录，不改写第一个设备的记录；
+ *   - OVERRIDE_SIGMASTUDIO_DEVICE_ADDRESS 时只给导出地址登记的第一片用 DSP_I2C_ADDR，其余各片被拒绝。
+ */
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#include "SigmaDspEmulator.h"
+#include "SigmaTestCheck.h"
+
+// 整个地址空间：内存每字4字节，寄存器每字2字节
+static const size_t kImageBytes = size_t(SIGMA_EMU_REGISTER_ADDR) * 4 + 0x1000 * 2;
+
+static const byte kDevA = DEVICE_ADDR_IC_1;    // 0x72 -> 0x39
+static const byte kDevB = 0x74;                // 0x3A
+static const byte kUnregistered = 0x76;
+
+// 记录中发往某个I2C地址的事务都满足 pred
+template <typename Pred>
+static bool allTo(const SigmaBusRecorder& bus, size_t from, uint8_t i2cAddress, Pred pred) {
+    size_t seen = 0;
+    for (size_t i = from; i < bus.log.size(); i++) {
+        if (bus.log[i].devAddress == i2cAddress) {
+            seen++;
+            if (!pred(bus.log[i])) {
+                return false;
+            }
+        }
+    }
+    return seen > 0;
+}
+
+static uint32_t storedClock(int index) {
+    SigmaClockRecord record;
+    EEPROM.get(SIGMA_NV_ADDR + index * int(SIGMA_NV_SLOT_BYTES) + int(sizeof(SigmaNvRecord)), record);
+    return record.magic == SIGMA_CLOCK_MAGIC ? record.clock : 0;
+}
+
+int main() {
+    SigmaDspEmulator dspA(kDevA >> 1);
+    SigmaDspEmulator dspB(kDevB >> 1);
+    SigmaDspEmulator dspDefault(DSP_I2C_ADDR);
+    SigmaBusShared shared;
+    shared.devices = {&dspA, &dspB, &dspDefault};
+    SigmaBusRecorder bus;
+    bus.target = &shared;
+    SIGMA_HOST_SET_BUS(&bus);
+    SIGMA_I2C_INIT();
+    EEPROM.erase();
+
+    // 没有登记设备：设备地址被忽略，发往 DSP_I2C_ADDR
+    sequence_download_IC_1();
+    CHECK(SIGMA_GET_LAST_ERROR() == SIGMA_SUCCESS, "single-device download error %u", SIGMA_GET_LAST_ERROR());
+    CHECK(dspA.writeTransactions == 0 && dspB.writeTransactions == 0, "unregistered download reached 0x39/0x3A");
+    std::vector<uint8_t> expected = dspDefault.readMemory(0, kImageBytes);
+
+    // 导出地址不是板上的地址：第一片默认 DSP_I2C_ADDR，第二片必须给出I2C地址
+    SigmaDevice* a = SIGMA_ADD_DEVICE(kDevA);
+    CHECK(a && a->i2cAddress == DSP_I2C_ADDR, "first device not at DSP_I2C_ADDR");
+    CHECK(SIGMA_ADD_DEVICE(kDevB) == nullptr && SIGMA_GET_LAST_ERROR() == SIGMA_ERROR_INVALID_PARAM,
+          "second device registered without an I2C address");
+    SIGMA_CLEAR_ERROR();
+    a = SIGMA_ADD_DEVICE(kDevA, kDevA >> 1);
+    SigmaDevice* b = SIGMA_ADD_DEVICE(kDevB, kDevB >> 1);
+    CHECK(a && a->i2cAddress == 0x39 && b && b->i2cAddress == 0x3A, "devices not at 0x39/0x3A");
+
+    // 同一个序列下载到两片DSP
+    dspDefault.clear();
+    bus.clear();
+    CHECK(SIGMA_RUN_SEQUENCE(kDevA, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1) == SIGMA_SUCCESS,
+          "download to 0x72 failed");
+    size_t split = bus.log.size();
+    CHECK(SIGMA_RUN_SEQUENCE(kDevB, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1) == SIGMA_SUCCESS,
+          "download to 0x74 failed");
+    CHECK(dspA.readMemory(0, kImageBytes) == expected, "memory of 0x72 differs from the single-device download");
+    CHECK(dspB.readMemory(0, kImageBytes) == expected, "memory of 0x74 differs from the single-device download");
+    CHECK(dspDefault.writeTransactions == 0, "registered downloads reached DSP_I2C_ADDR");
+    bool separated = true;
+    for (size_t i = 0; i < bus.log.size(); i++) {
+        separated = separated && bus.log[i].devAddress == (i < split ? 0x39 : 0x3A);
+    }
+    CHECK(separated, "download traffic not addressed to the selected device");
+    CHECK(SIGMA_VERIFY_SECTIONS(kDevA, Sections_IC_1, SECTION_COUNT_IC_1) == SIGMA_SUCCESS, "0x72 does not verify");
+    CHECK(SIGMA_VERIFY_SECTIONS(kDevB, Sections_IC_1, SECTION_COUNT_IC_1) == SIGMA_SUCCESS, "0x74 does not verify");
+
+    // 参数只写到指定的设备，不带设备地址的读取作用于当前设备
+    SIGMA_WRITE_REGISTER_INTEGER(kDevB, 0x0010, 0x00400000);
+    CHECK(SIGMA_READ_REGISTER_INTEGER(0x0010, 4) == 0x00400000, "current device is not 0x74");
+    CHECK(SIGMA_READ_REGISTER_INTEGER(kDevA, 0x0010, 4) != 0x00400000, "write to 0x74 changed 0x72");
+    CHECK(SIGMA_READ_REGISTER_FLOAT(kDevB, 0x0010) == 0.5, "float read from 0x74 %f", SIGMA_READ_REGISTER_FLOAT(kDevB, 0x0010));
+
+    // 各设备的事务计数
+    uint32_t aTransactions = SIGMA_GET_DEVICE(kDevA)->transactions;
+    uint32_t bTransactions = SIGMA_GET_DEVICE(kDevB)->transactions;
+    SIGMA_WRITE_REGISTER_INTEGER(kDevB, 0x0011, 1);
+    CHECK(SIGMA_GET_DEVICE(kDevA)->transactions == aTransactions, "write to 0x74 counted for 0x72");
+    CHECK(SIGMA_GET_DEVICE(kDevB)->transactions == bTransactions + 1, "0x74 counted %u transactions for one write",
+          unsigned(SIGMA_GET_DEVICE(kDevB)->transactions - bTransactions));
+
+    // 一片DSP断开：错误和重试只记在它名下
+    shared.devices = {&dspA, &dspDefault};
+    SIGMA_CLEAR_RETRY_COUNTS();
+    CHECK(SIGMA_WRITE_REGISTER_INTEGER(kDevB, 0x0010, 0) != SIGMA_SUCCESS, "write to a missing DSP succeeded");
+    CHECK(SIGMA_WRITE_REGISTER_INTEGER(kDevA, 0x0010, 0x00200000) == SIGMA_SUCCESS, "write to 0x72 failed");
+    CHECK(SIGMA_GET_LAST_ERROR() == SIGMA_SUCCESS, "0x72 reports error %u", SIGMA_GET_LAST_ERROR());
+    CHECK(SIGMA_GET_LAST_ERROR(kDevA) == SIGMA_SUCCESS, "0x72 reports error %u", SIGMA_GET_LAST_ERROR(kDevA));
+    CHECK(SIGMA_GET_LAST_ERROR(kDevB) != SIGMA_SUCCESS, "0x74 lost its error");
+    CHECK(SIGMA_GET_RETRY_COUNT() == 0, "retries on 0x74 counted for 0x72");
+    CHECK(SIGMA_GET_DEVICE(kDevB)->retries > 0, "0x74 has no retries");
+    shared.devices = {&dspA, &dspB, &dspDefault};
+
+    // 各自的总线时钟：0x72 各档都通过（1MHz 留出余量为 400kHz），0x74 的线束只能跑到 300kHz
+    const uint16_t scratch = SCRATCH_ADDR_IC_1;
+    dspB.maxClock = 300000;
+    CHECK(SIGMA_QUALIFY_CLOCK(kDevA, scratch) == SIGMA_SUCCESS, "qualification of 0x72 failed");
+    CHECK(SIGMA_QUALIFY_CLOCK(kDevB, scratch) == SIGMA_SUCCESS, "qualification of 0x74 failed");
+    CHECK(a->clock == 400000 && b->clock == 100000, "qualified %lu/%lu Hz", (unsigned long)a->clock,
+          (unsigned long)b->clock);
+    CHECK(storedClock(0) == 400000 && storedClock(1) == 100000, "stored %lu/%lu Hz", (unsigned long)storedClock(0),
+          (unsigned long)storedClock(1));
+    bus.clear();
+    SIGMA_WRITE_REGISTER_INTEGER(kDevA, 0x0011, 2);
+    SIGMA_WRITE_REGISTER_INTEGER(kDevB, 0x0011, 3);
+    SIGMA_WRITE_REGISTER_INTEGER(kDevA, 0x0012, 4);
+    CHECK(allTo(bus, 0, 0x39, [](const SigmaBusTransaction& t) { return t.clock == 400000; }),
+          "0x72 not clocked at its qualified clock");
+    CHECK(allTo(bus, 0, 0x3A, [](const SigmaBusTransaction& t) { return t.clock == 100000; }),
+          "0x74 not clocked at its qualified clock");
+    CHECK(SIGMA_READ_REGISTER_INTEGER(kDevB, 0x0011, 4) == 3, "0x74 readback at its clock");
+
+    // 增量重载：记录和结果各设备一份
+    dspA.clear();
+    dspB.clear();
+    CHECK(SIGMA_BOOT_INCREMENTAL(kDevA, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1, &Signature_IC_1,
+                                 GroupHash_IC_1) == SIGMA_SUCCESS, "boot of 0x72 failed");
+    CHECK(SIGMA_BOOT_INCREMENTAL(kDevB, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1, &Signature_IC_1,
+                                 GroupHash_IC_1) == SIGMA_SUCCESS, "boot of 0x74 failed");
+    CHECK(SIGMA_GET_DEVICE(kDevA)->bootMode == SIGMA_BOOT_MODE_COLD &&
+          SIGMA_GET_DEVICE(kDevB)->bootMode == SIGMA_BOOT_MODE_COLD, "first boots not cold");
+    dspB.hardwareReset();    // 只有 0x74 掉过电
+    SIGMA_BOOT_INCREMENTAL(kDevA, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1, &Signature_IC_1, GroupHash_IC_1);
+    SIGMA_BOOT_INCREMENTAL(kDevB, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1, &Signature_IC_1, GroupHash_IC_1);
+    CHECK(SIGMA_GET_DEVICE(kDevA)->bootMode == SIGMA_BOOT_MODE_WARM && SIGMA_GET_DEVICE(kDevA)->warmBoot,
+          "0x72 boot mode %u, expected warm", SIGMA_GET_DEVICE(kDevA)->bootMode);
+    CHECK(SIGMA_GET_DEVICE(kDevB)->bootMode == SIGMA_BOOT_MODE_COLD && !SIGMA_GET_DEVICE(kDevB)->warmBoot,
+          "0x74 boot mode %u, expected cold", SIGMA_GET_DEVICE(kDevB)->bootMode);
+    CHECK(SIGMA_BOOT_MODE() == SIGMA_BOOT_MODE_COLD, "global boot mode is not the current device's");
+    CHECK(dspB.readMemory(0, kImageBytes) == dspA.readMemory(0, kImageBytes), "cold boot of 0x74 differs");
+    CHECK(storedClock(0) == 400000 && storedClock(1) == 100000, "boot records overwrote the clock records");
+
+    // 计划器：0x72 待发的写入在切换到 0x74 之前发往 0x72
+    const uint8_t gain[8] = {0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00};
+    uint8_t before[4];
+    dspA.readMemory(0x0013, before, 4);
+    SIGMA_DOWNLOAD_BEGIN();
+    SIGMA_WRITE_REGISTER_BLOCK(kDevA, 0x0012, 4, gain);
+    SIGMA_WRITE_REGISTER_BLOCK(kDevB, 0x0013, 4, gain + 4);
+    CHECK(SIGMA_DOWNLOAD_END() == SIGMA_SUCCESS, "planner error");
+    uint8_t word[4];
+    dspA.readMemory(0x0012, word, 4);
+    CHECK(memcmp(word, gain, 4) == 0, "planned write to 0x72 lost");
+    dspB.readMemory(0x0013, word, 4);
+    CHECK(memcmp(word, gain + 4, 4) == 0, "planned write to 0x74 lost");
+    dspA.readMemory(0x0013, word, 4);
+    CHECK(memcmp(word, before, 4) == 0, "write to 0x74 merged into 0x72's run");
+
+    // 未登记的地址
+    dspDefault.clear();
+    SIGMA_WRITE_REGISTER_INTEGER(kUnregistered, 0x0010, 0x00100000);
+    CHECK(SIGMA_GET_LAST_ERROR(kUnregistered) == SIGMA_SUCCESS, "unregistered write error %u",
+          SIGMA_GET_LAST_ERROR(kUnregistered));
+    CHECK(dspDefault.writeTransactions == 1, "unregistered address not sent to DSP_I2C_ADDR");
+
+    // 未登记的地址没有EEPROM记录：鉴定和增量重载都不改写第一个设备的记录
+    size_t nvWrites = EEPROM.writes;
+    dspDefault.maxClock = 300000;
+    CHECK(SIGMA_QUALIFY_CLOCK(kUnregistered, scratch) == SIGMA_SUCCESS, "qualification of 0x76 failed");
+    CHECK(SIGMA_GET_DEVICE(kUnregistered)->clock == 100000, "0x76 qualified %lu Hz",
+          (unsigned long)SIGMA_GET_DEVICE(kUnregistered)->clock);
+    CHECK(SIGMA_BOOT_INCREMENTAL(kUnregistered, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1,
+                                 &Signature_IC_1, GroupHash_IC_1) == SIGMA_SUCCESS, "boot of 0x76 failed");
+    CHECK(SIGMA_GET_DEVICE(kUnregistered)->bootMode == SIGMA_BOOT_MODE_COLD, "0x76 boot mode %u, expected cold",
+          SIGMA_GET_DEVICE(kUnregistered)->bootMode);
+    CHECK(EEPROM.writes == nvWrites, "unregistered address wrote %zu EEPROM bytes", EEPROM.writes - nvWrites);
+    CHECK(storedClock(0) == 400000, "0x72 clock record overwritten with %lu Hz", (unsigned long)storedClock(0));
+
+    return SIGMA_TEST_RESULT();
+}
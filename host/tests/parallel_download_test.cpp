@@ -0,0 +1,130 @@
+/*
+ * 并行下载：几个 ADAU1452 模型各在自己的总线上，总线按时序模型占用虚拟时钟
+ * （SigmaBusTimed，阻塞传输），验证
+ *   - 两个I2C控制器（Wire、Wire1）以及I2C加SPI上的两片DSP交替下载，结果与单独下载相同；
+ *   - 总时间接近最慢的一片（各片的延迟互相重叠，只多出另一片的线上时间），远小于依次下载；
+ *   - 一片DSP没有应答时另一片照常完成，SIGMA_PARALLEL_RUN() 返回该错误，失败的一片可以继续；
+ *   - 同一总线上登记过的两片DSP也可以并行，各自收到完整的镜像。
+ */
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#include "SigmaBusTiming.h"
+#include "SigmaDspEmulator.h"
+#include "SigmaTestCheck.h"
+
+// 整个地址空间：内存每字4字节，寄存器每字2字节
+static const size_t kImageBytes = size_t(SIGMA_EMU_REGISTER_ADDR) * 4 + 0x1000 * 2;
+
+typedef SigmaI2cTransport<DSP_I2C_ADDR, &Wire> LeftBus;
+typedef SigmaI2cTransport<DSP_I2C_ADDR, &Wire1> RightBus;
+typedef SigmaSpiTransport<> SpiBus;
+
+template <typename Bus>
+static double timeSingle(SigmaDspEmulator& dsp) {
+    dsp.clear();
+    uint64_t start = SIGMA_HOST_TIME_US();
+    CHECK(SIGMA_RUN_SEQUENCE<Bus>(DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1) ==
+              SIGMA_SUCCESS, "single download failed");
+    return (SIGMA_HOST_TIME_US() - start) / 1000.0;
+}
+
+// 两片并行下载的时间（毫秒）
+template <typename BusA, typename BusB>
+static double timeParallel(SigmaSeqState* a, SigmaSeqState* b, byte devA, byte devB, uint8_t* result) {
+    SIGMA_SEQ_START(a, devA, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1);
+    SIGMA_SEQ_START(b, devB, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1);
+    SigmaParallel boot;
+    SIGMA_PARALLEL_BEGIN(&boot);
+    CHECK(SIGMA_PARALLEL_ADD<BusA>(&boot, a) && SIGMA_PARALLEL_ADD<BusB>(&boot, b), "targets not added");
+    uint64_t start = SIGMA_HOST_TIME_US();
+    *result = SIGMA_PARALLEL_RUN(&boot);
+    return (SIGMA_HOST_TIME_US() - start) / 1000.0;
+}
+
+// 两片DSP各在一条总线上：并行的时间不超过最慢的一片加上另一片的线上时间
+template <typename BusA, typename BusB>
+static void checkPair(const char* label, SigmaDspEmulator& dspA, SigmaDspEmulator& dspB, const SigmaBusTimed& busA,
+                      const SigmaBusTimed& busB, const std::vector<uint8_t>& expected) {
+    double wireA0 = busA.busyNs();
+    double singleA = timeSingle<BusA>(dspA);
+    double wireA = (busA.busyNs() - wireA0) / 1e6;
+    double wireB0 = busB.busyNs();
+    double singleB = timeSingle<BusB>(dspB);
+    double wireB = (busB.busyNs() - wireB0) / 1e6;
+
+    dspA.clear();
+    dspB.clear();
+    SigmaSeqState a;
+    SigmaSeqState b;
+    uint8_t result;
+    double parallel = timeParallel<BusA, BusB>(&a, &b, DEVICE_ADDR_IC_1, DEVICE_ADDR_IC_1, &result);
+    CHECK(result == SIGMA_SUCCESS, "[%s] parallel download error %u", label, result);
+    CHECK(dspA.readMemory(0, kImageBytes) == expected, "[%s] first DSP differs", label);
+    CHECK(dspB.readMemory(0, kImageBytes) == expected, "[%s] second DSP differs", label);
+
+    double slowest = singleA > singleB ? singleA : singleB;
+    double otherWire = singleA > singleB ? wireB : wireA;
+    printf("%s: %.1f ms + %.1f ms one after another, %.1f ms in parallel (wire %.1f/%.1f ms)\n", label, singleA,
+           singleB, parallel, wireA, wireB);
+    CHECK(parallel <= slowest + otherWire + 2, "[%s] parallel %.1f ms, slowest single %.1f ms + %.1f ms on the wire",
+          label, parallel, slowest, otherWire);
+    CHECK(parallel < 0.75 * (singleA + singleB), "[%s] parallel %.1f ms barely beats %.1f ms", label, parallel,
+          singleA + singleB);
+}
+
+int main() {
+    SigmaDspEmulator dspA(DSP_I2C_ADDR);
+    SigmaDspEmulator dspB(DSP_I2C_ADDR);
+    SigmaDspEmulator dspSpi(DSP_I2C_ADDR);
+    SigmaBusTimed left;
+    SigmaBusTimed right;
+    SigmaBusTimed spi;
+    left.target = &dspA;
+    right.target = &dspB;
+    spi.target = &dspSpi;
+    Wire.bus = &left;
+    Wire1.bus = &right;
+    SIGMA_HOST_SET_BUS(&spi);    // SPI 经当前后端
+    LeftBus::begin();
+    RightBus::begin();
+    SpiBus::begin();
+
+    // 参考：单独下载
+    timeSingle<LeftBus>(dspA);
+    std::vector<uint8_t> expected = dspA.readMemory(0, kImageBytes);
+
+    checkPair<LeftBus, RightBus>("Wire + Wire1", dspA, dspB, left, right, expected);
+    checkPair<LeftBus, SpiBus>("Wire + SPI", dspA, dspSpi, left, spi, expected);
+
+    // 一片没有应答：另一片完成，失败的一片在线路恢复后继续
+    SigmaDspEmulator absent(0x20);
+    right.target = &absent;
+    dspA.clear();
+    dspB.clear();
+    SigmaSeqState a;
+    SigmaSeqState b;
+    uint8_t result;
+    timeParallel<LeftBus, RightBus>(&a, &b, DEVICE_ADDR_IC_1, DEVICE_ADDR_IC_1, &result);
+    CHECK(result != SIGMA_SUCCESS && b.failed, "missing DSP not reported");
+    CHECK(SIGMA_SEQ_DONE(&a) && !a.failed, "healthy DSP stopped at %d/%d", a.index, a.count);
+    CHECK(dspA.readMemory(0, kImageBytes) == expected, "healthy DSP differs");
+    right.target = &dspB;
+    SIGMA_SEQ_RESUME(&b);
+    CHECK(SIGMA_SEQ_RUN<RightBus>(&b) == SIGMA_SUCCESS, "resumed download failed");
+    CHECK(dspB.readMemory(0, kImageBytes) == expected, "resumed DSP differs");
+
+    // 同一总线上的两片DSP（0x39、0x3A）：只有延迟重叠
+    SigmaDspEmulator dspC(DEVICE_ADDR_IC_1 >> 1);
+    SigmaDspEmulator dspD(0x74 >> 1);
+    SigmaBusShared shared;
+    shared.devices = {&dspC, &dspD};
+    left.target = &shared;
+    SIGMA_ADD_DEVICE<LeftBus>(DEVICE_ADDR_IC_1, DEVICE_ADDR_IC_1 >> 1);
+    SIGMA_ADD_DEVICE<LeftBus>(0x74, 0x74 >> 1);
+    double sharedMs = timeParallel<LeftBus, LeftBus>(&a, &b, DEVICE_ADDR_IC_1, 0x74, &result);
+    CHECK(result == SIGMA_SUCCESS, "shared-bus parallel download error %u", result);
+    CHECK(dspC.readMemory(0, kImageBytes) == expected, "0x72 on the shared bus differs");
+    CHECK(dspD.readMemory(0, kImageBytes) == expected, "0x74 on the shared bus differs");
+    printf("one bus, two DSPs: %.1f ms in parallel\n", sharedMs);
+
+    return SIGMA_TEST_RESULT();
+}
@@ -0,0 +1,173 @@
+/*
+ * 不稳定总线上的下载：在 ADAU1452 模型前面接故障注入后端，验证
+ *   - 零星的NACK由分块重试吸收，下载结果不变，只多花几毫秒；
+ *   - 连续失败超过重试次数时序列停在失败的块上，SIGMA_SEQ_RESUME()
+ *     后从这一块继续，而不是从 SOFT_RESET 重新下载；压缩序列也一样，
+ *     解压器状态保留，失败的块原样重发；
+ *   - 直接回放导出文件（SIGMA_RUN_TXBUFFER()）时，无论是否合并写入都返回失败。
+ * SPI没有应答，不适用，只构建I2C版本。
+ */
+#define SIGMA_LZ_ENABLE true    // 使用压缩序列
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ_LZ.h"
+#include "SigmaDspEmulator.h"
+#include "SigmaTxBuffer.h"
+#include "SigmaTestCheck.h"
+
+ADI_REG_TYPE TxBuffer_IC_1[] = {
+#include "TxBuffer_IC_1.dat"
+};
+
+ADI_DATA_U16 NumBytes_IC_1[] = {
+#include "NumBytes_IC_1.dat"
+};
+
+static std::vector<SigmaTxEntry> g_entries;
+
+// 每个写入条目覆盖的地址范围上，最终内存应与按顺序直接写入的结果相同
+static void checkImage(const char* label, const SigmaDspEmulator& emu) {
+    SigmaDspEmulator expected(DSP_I2C_ADDR);
+    for (const SigmaTxEntry& e : g_entries) {
+        if (!e.isDelay()) {
+            expected.poke(e.address, e.data.data(), e.data.size());
+        }
+    }
+    for (const SigmaTxEntry& e : g_entries) {
+        if (e.isDelay()) {
+            continue;
+        }
+        std::vector<uint8_t> want = expected.readMemory(e.address, e.data.size());
+        size_t at = emu.compare(e.address, want.data(), want.size());
+        CHECK(at == want.size(), "[%s] %s at 0x%04X differs at byte %zu", label, e.name.c_str(), e.address, at);
+    }
+    CHECK(emu.partialWords == 0, "[%s] %zu partial words", label, emu.partialWords);
+}
+
+// 无故障时的写事务数和等待时间
+static size_t g_clean_writes = 0;
+static uint64_t g_clean_ms = 0;
+
+static void runClean(SigmaDspEmulator& dsp, SigmaBusFaultInjector& bus) {
+    dsp.clear();
+    bus.reset();
+    uint64_t start = SIGMA_HOST_TIME_US();
+    CHECK(SIGMA_RUN_SEQUENCE(DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1) == SIGMA_SUCCESS,
+          "clean download failed");
+    g_clean_ms = (SIGMA_HOST_TIME_US() - start) / 1000;
+    g_clean_writes = bus.writes;
+    checkImage("clean", dsp);
+}
+
+// 零星故障：每 every 个写事务失败一次
+static void runTransient(SigmaDspEmulator& dsp, SigmaBusFaultInjector& bus, size_t every) {
+    dsp.clear();
+    bus.reset();
+    bus.failEvery = every;
+    SIGMA_CLEAR_RETRY_COUNTS();
+    uint64_t start = SIGMA_HOST_TIME_US();
+    uint8_t result = SIGMA_RUN_SEQUENCE(DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1);
+    uint64_t ms = (SIGMA_HOST_TIME_US() - start) / 1000;
+    bus.failEvery = 0;
+
+    CHECK(result == SIGMA_SUCCESS, "[transient] result %u", result);
+    CHECK(SIGMA_GET_RETRY_COUNT() == bus.injected, "[transient] %lu retries for %zu faults",
+          (unsigned long)SIGMA_GET_RETRY_COUNT(), bus.injected);
+    CHECK(SIGMA_GET_RETRY_FAILURES() == 0, "[transient] %lu chunks gave up", (unsigned long)SIGMA_GET_RETRY_FAILURES());
+    CHECK(bus.writes == g_clean_writes + bus.injected, "[transient] %zu writes, expected %zu",
+          bus.writes, g_clean_writes + bus.injected);
+    checkImage("transient", dsp);
+    printf("[transient] 1 in %zu writes NACKed: %zu faults, %lu retries, +%llu ms\n", every, bus.injected,
+           (unsigned long)SIGMA_GET_RETRY_COUNT(), (unsigned long long)(ms - g_clean_ms));
+}
+
+// 连续故障超过重试次数：停在失败的块上，继续后完成
+static void runResume(SigmaDspEmulator& dsp, SigmaBusFaultInjector& bus, size_t failAt, bool planned,
+                      bool compressed = false) {
+    const char* label = compressed ? (planned ? "resume, planned, compressed" : "resume, compressed")
+                                   : (planned ? "resume, planned" : "resume");
+    dsp.clear();
+    bus.reset();
+    bus.failAt = failAt;
+    bus.failBurst = SIGMA_RETRY_COUNT + 3;
+    SIGMA_CLEAR_RETRY_COUNTS();
+
+    if (planned) {
+        SIGMA_DOWNLOAD_BEGIN();
+    }
+    SigmaSeqState dl;
+    if (compressed) {
+        SIGMA_SEQ_START(&dl, DEVICE_ADDR_IC_1, Sequence_LZ_IC_1, SEQUENCE_LZ_SIZE_IC_1, Sequence_LZ_Blob_IC_1);
+    } else {
+        SIGMA_SEQ_START(&dl, DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1);
+    }
+    uint8_t result = SIGMA_SEQ_RUN(&dl);
+    CHECK(result == SIGMA_ERROR_I2C_DATA, "[%s] first run returned %u", label, result);
+    CHECK(dl.failed && !SIGMA_SEQ_DONE(&dl), "[%s] sequence did not stop at the failed chunk", label);
+    int stoppedAt = dl.index;
+    uint32_t sentBefore = dl.bytesSent;
+
+    SIGMA_SEQ_RESUME(&dl);
+    result = SIGMA_SEQ_RUN(&dl);
+    if (planned) {
+        SIGMA_DOWNLOAD_END();
+    }
+    bus.failBurst = 0;
+
+    CHECK(result == SIGMA_SUCCESS, "[%s] resumed run returned %u", label, result);
+    CHECK(SIGMA_SEQ_DONE(&dl) && dl.resumes == 1, "[%s] done %d, resumes %u", label, SIGMA_SEQ_DONE(&dl), dl.resumes);
+    CHECK(dl.bytesSent == dl.bytesTotal, "[%s] progress %lu/%lu", label, (unsigned long)dl.bytesSent,
+          (unsigned long)dl.bytesTotal);
+    CHECK(SIGMA_GET_RETRY_FAILURES() == 1, "[%s] %lu chunks gave up", label, (unsigned long)SIGMA_GET_RETRY_FAILURES());
+    checkImage(label, dsp);
+    printf("[%s] stopped at entry %d (%s) after %lu/%lu bytes, %zu writes (clean %zu)\n", label, stoppedAt,
+           g_entries[stoppedAt].name.c_str(), (unsigned long)sentBefore, (unsigned long)dl.bytesTotal,
+           bus.writes, g_clean_writes);
+    if (!planned) {
+        // 只多出失败的事务，没有从头重发
+        CHECK(bus.writes == g_clean_writes + bus.injected, "[%s] %zu writes, expected %zu", label, bus.writes,
+              g_clean_writes + bus.injected);
+    }
+}
+
+// 回放导出文件时连续故障超过重试次数：合并写入时失败同样要报告
+static void runReplay(SigmaDspEmulator& dsp, SigmaBusFaultInjector& bus, size_t failAt, bool planned) {
+    const char* label = planned ? "replay, planned" : "replay";
+    dsp.clear();
+    bus.reset();
+    bus.failAt = failAt;
+    bus.failBurst = SIGMA_RETRY_COUNT + 3;
+    if (planned) {
+        SIGMA_DOWNLOAD_BEGIN();
+    }
+    uint8_t result = SIGMA_RUN_TXBUFFER(DEVICE_ADDR_IC_1, TxBuffer_IC_1, NumBytes_IC_1,
+                                        sizeof(NumBytes_IC_1) / sizeof(NumBytes_IC_1[0]));
+    if (planned) {
+        SIGMA_DOWNLOAD_END();
+    }
+    bus.failBurst = 0;
+    CHECK(result == SIGMA_ERROR_I2C_DATA, "[%s] returned %u after %zu injected faults", label, result, bus.injected);
+    SIGMA_CLEAR_ERROR();
+}
+
+int main() {
+    CHECK(SIGMA_LOAD_TX_BUFFER(SIGMA_EXPORT_DIR, 1, g_entries), "cannot load TxBuffer_IC_1.dat");
+
+    SigmaDspEmulator dsp(DSP_I2C_ADDR);
+    SigmaBusFaultInjector bus;
+    bus.target = &dsp;
+    SIGMA_HOST_SET_BUS(&bus);
+    SIGMA_I2C_INIT();
+
+    runClean(dsp, bus);
+    runTransient(dsp, bus, 37);
+    runResume(dsp, bus, 20, false);      // 控制寄存器区
+    runResume(dsp, bus, 300, false);     // 程序内存中间
+    runResume(dsp, bus, 20, true);
+    runResume(dsp, bus, 300, true);
+    runResume(dsp, bus, 300, false, true);
+    runResume(dsp, bus, 300, true, true);
+    runReplay(dsp, bus, 300, false);
+    runReplay(dsp, bus, 300, true);
+
+    return SIGMA_TEST_RESULT();
+}
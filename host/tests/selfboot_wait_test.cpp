@@ -0,0 +1,48 @@
+/*
+ * DSP从EEPROM自启动时的MCU一侧（EEPROM的字节格式由 SigmaStudio 决定，这里不模拟）：
+ *   - 自启动加载完成后 SIGMA_WAIT_SELF_BOOT() 成功，MCU只读状态、不写入任何内容；
+ *   - 自启动后的内存与MCU下载相同，之后的参数写入照常工作；
+ *   - EEPROM为空时 SIGMA_WAIT_SELF_BOOT() 超时，由MCU下载后内核运行。
+ */
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#include "SigmaDspEmulator.h"
+#include "SigmaTestCheck.h"
+
+static const size_t kMemoryBytes = size_t(SIGMA_EMU_REGISTER_ADDR) * 4;
+
+int main() {
+    SigmaDspEmulator dsp(DSP_I2C_ADDR);
+    SigmaBusCounter bus;
+    bus.target = &dsp;
+    SIGMA_HOST_SET_BUS(&bus);
+    SIGMA_I2C_INIT();
+
+    std::vector<SigmaTxEntry> entries;
+    CHECK(SIGMA_LOAD_TX_BUFFER(SIGMA_EXPORT_DIR, 1, entries), "cannot load the IC 1 export");
+
+    // MCU下载作为参照
+    dsp.clear();
+    sequence_download_IC_1();
+    std::vector<uint8_t> downloaded = dsp.readMemory(0, kMemoryBytes);
+
+    // 自启动：MCU只读状态
+    dsp.clear();
+    dsp.selfBoot(entries);
+    bus.reset();
+    CHECK(SIGMA_WAIT_SELF_BOOT(DEVICE_ADDR_IC_1) == SIGMA_SUCCESS, "core not running after self-boot");
+    CHECK(SIGMA_GET_LAST_ERROR() == SIGMA_SUCCESS, "last error %u", SIGMA_GET_LAST_ERROR());
+    CHECK(bus.payloadBytes <= 8, "MCU sent %zu payload bytes", bus.payloadBytes);
+    CHECK(dsp.readMemory(0, kMemoryBytes) == downloaded, "self-booted memory differs from the MCU download");
+
+    // EEPROM为空：超时，错误被记录，MCU下载后内核运行
+    dsp.clear();
+    dsp.selfBoot(std::vector<SigmaTxEntry>());
+    CHECK(SIGMA_WAIT_SELF_BOOT(DEVICE_ADDR_IC_1, 20) == SIGMA_ERROR_DSP_TIMEOUT, "blank EEPROM: no timeout");
+    CHECK(SIGMA_GET_LAST_ERROR() == SIGMA_ERROR_DSP_TIMEOUT, "blank EEPROM: last error %u", SIGMA_GET_LAST_ERROR());
+    CHECK(dsp.readMemory(0, kMemoryBytes) == std::vector<uint8_t>(kMemoryBytes, 0), "blank EEPROM wrote memory");
+    SIGMA_CLEAR_ERROR();
+    sequence_download_IC_1();
+    CHECK(SIGMA_WAIT_SELF_BOOT(DEVICE_ADDR_IC_1, 20) == SIGMA_SUCCESS, "core not running after the fallback download");
+
+    return SIGMA_TEST_RESULT();
+}
@@ -0,0 +1,186 @@
+/*
+ * 稀疏序列：在 ADAU1452 模型上比较 Sequence_SPARSE_IC_1 与完整序列下载后的整个地址空间，验证
+ *   - 内存为零（刚上电）时 SIGMA_ZERO_ASSUME 跳过零段，总线流量更少，SIGMA_ZERO_CHECK 读回确认后跳过，
+ *     结果都相同；
+ *   - 内存中残留旧镜像时默认的 SIGMA_ZERO_WRITE 照常写零，SIGMA_ZERO_CHECK 发现残留后也写零；
+ *   - 残留只在零段中间（首尾字为零）时 SIGMA_ZERO_CHECK 也能发现，只给有残留的块写零；
+ *   - SIGMA_ZERO_CHECK 每步最多读回一块，非阻塞执行的每一步仍然有界；
+ *   - 残留旧镜像却假定为零时结果确实不同（零段不是多余的）。
+ */
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ_SPARSE.h"
+#include "SigmaDspEmulator.h"
+#include "SigmaTestCheck.h"
+
+// 整个地址空间：内存每字4字节，寄存器每字2字节
+static const size_t kImageBytes = size_t(SIGMA_EMU_REGISTER_ADDR) * 4 + 0x1000 * 2;
+
+struct Run {
+    uint8_t result;
+    size_t transactions;
+    size_t busBytes;
+    uint32_t skipped;
+    std::vector<uint8_t> image;
+};
+
+enum Memory { kZeroed, kStale, kStaleInside };
+
+// 上电状态，DM0/DM1残留上一个镜像（这里用非零图案代替），或只在各零段中间残留一个字
+static void powerUp(SigmaDspEmulator& dsp, Memory memory) {
+    dsp.clear();
+    if (memory == kStaleInside) {
+        const uint8_t junk[4] = {0x00, 0x00, 0x01, 0x00};
+        for (int i = 0; i < SEQUENCE_SPARSE_SIZE_IC_1; i++) {
+            const SigmaSeqEntry& e = Sequence_SPARSE_IC_1[i];
+            if (e.opcode == SIGMA_SEQ_ZERO) {
+                dsp.poke(uint16_t(e.address + e.length / 4 / 2), junk, 4);
+            }
+        }
+    }
+    if (memory == kStale) {
+        std::vector<uint8_t> junk(0x1000 * 4);
+        for (size_t i = 0; i < junk.size(); i++) {
+            junk[i] = uint8_t(0xA5 ^ i);
+        }
+        dsp.poke(SIGMA_EMU_DM0_ADDR, junk.data(), junk.size());
+        dsp.poke(SIGMA_EMU_DM1_ADDR, junk.data(), junk.size());
+    }
+}
+
+static Run download(SigmaDspEmulator& dsp, SigmaBusCounter& bus, Memory memory, bool sparse, uint8_t zeroMode,
+                    bool planned = false) {
+    powerUp(dsp, memory);
+    bus.reset();
+    if (planned) {
+        SIGMA_DOWNLOAD_BEGIN();
+    }
+    SigmaSeqState dl;
+    if (sparse) {
+        SIGMA_SEQ_START(&dl, DEVICE_ADDR_IC_1, Sequence_SPARSE_IC_1, SEQUENCE_SPARSE_SIZE_IC_1,
+                        Sequence_SPARSE_Blob_IC_1);
+    }
+    else {
+        SIGMA_SEQ_START(&dl, DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1);
+    }
+    SIGMA_SEQ_SET_ZERO_MODE(&dl, zeroMode);
+    Run r;
+    r.result = SIGMA_SEQ_RUN(&dl);
+    if (planned) {
+        uint8_t end = SIGMA_DOWNLOAD_END();
+        r.result = r.result != SIGMA_SUCCESS ? r.result : end;
+    }
+    CHECK(dl.bytesSent == dl.bytesTotal, "progress %lu/%lu", (unsigned long)dl.bytesSent,
+          (unsigned long)dl.bytesTotal);
+    r.transactions = bus.transactions;
+    r.busBytes = bus.payloadBytes + bus.overheadBytes;
+    r.skipped = dl.bytesSkipped;
+    r.image = dsp.readMemory(0, kImageBytes);
+    return r;
+}
+
+static size_t firstDifference(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b) {
+    size_t i = 0;
+    while (i < a.size() && a[i] == b[i]) {
+        i++;
+    }
+    return i;
+}
+
+static void checkSame(const char* label, const Run& full, const Run& r) {
+    size_t at = firstDifference(full.image, r.image);
+    CHECK(r.result == SIGMA_SUCCESS, "[%s] result %u", label, r.result);
+    CHECK(at == full.image.size(), "[%s] memory differs at byte offset 0x%zX", label, at);
+    printf("[%s] %zu transactions, %zu bus bytes (full %zu / %zu), %lu zero bytes skipped\n", label,
+           r.transactions, r.busBytes, full.transactions, full.busBytes, (unsigned long)r.skipped);
+}
+
+int main() {
+    SigmaDspEmulator dsp(DSP_I2C_ADDR);
+    SigmaBusCounter bus;
+    bus.target = &dsp;
+    SIGMA_HOST_SET_BUS(&bus);
+    SIGMA_I2C_INIT();
+
+    uint32_t zeroBytes = 0;
+    for (int i = 0; i < SEQUENCE_SPARSE_SIZE_IC_1; i++) {
+        if (Sequence_SPARSE_IC_1[i].opcode == SIGMA_SEQ_ZERO) {
+            zeroBytes += Sequence_SPARSE_IC_1[i].length;
+        }
+    }
+    CHECK(zeroBytes > 0, "no zero entries in the sparse sequence");
+
+    // 上电后内存为零
+    Run full = download(dsp, bus, kZeroed, false, SIGMA_ZERO_WRITE);
+    CHECK(full.result == SIGMA_SUCCESS, "full download result %u", full.result);
+
+    Run written = download(dsp, bus, kZeroed, true, SIGMA_ZERO_WRITE);
+    checkSame("sparse, zeros written", full, written);
+    CHECK(written.skipped == 0, "zeros skipped in SIGMA_ZERO_WRITE mode");
+
+    Run assumed = download(dsp, bus, kZeroed, true, SIGMA_ZERO_ASSUME);
+    checkSame("sparse, assume zero", full, assumed);
+    CHECK(assumed.skipped == zeroBytes, "%lu of %lu zero bytes skipped", (unsigned long)assumed.skipped,
+          (unsigned long)zeroBytes);
+    // 省下的是零段本身，减去拆开的条目各多出的地址头
+    CHECK(assumed.busBytes + zeroBytes * 9 / 10 <= full.busBytes, "assume zero saved too little: %zu bus bytes",
+          assumed.busBytes);
+#if USE_SPI == false
+    // SPI每个条目本来就是一个事务，拆开后事务变多；I2C按突发分块，跳过的零段省下的块更多
+    CHECK(assumed.transactions < full.transactions, "assume zero: %zu transactions", assumed.transactions);
+#endif
+
+    Run checked = download(dsp, bus, kZeroed, true, SIGMA_ZERO_CHECK);
+    checkSame("sparse, checked zero", full, checked);
+    CHECK(checked.skipped == zeroBytes, "check did not trust zeroed memory");
+
+    Run planned = download(dsp, bus, kZeroed, true, SIGMA_ZERO_ASSUME, true);
+    Run fullPlanned = download(dsp, bus, kZeroed, false, SIGMA_ZERO_WRITE, true);
+    checkSame("sparse, assume zero, planned", fullPlanned, planned);
+
+    // DM0/DM1中残留旧内容
+    Run staleFull = download(dsp, bus, kStale, false, SIGMA_ZERO_WRITE);
+    Run staleWritten = download(dsp, bus, kStale, true, SIGMA_ZERO_WRITE);
+    checkSame("stale, zeros written", staleFull, staleWritten);
+
+    Run staleChecked = download(dsp, bus, kStale, true, SIGMA_ZERO_CHECK);
+    checkSame("stale, checked zero", staleFull, staleChecked);
+    CHECK(staleChecked.skipped == 0, "check trusted stale memory");
+
+    // 只有零段中间残留：首尾字为零，每一块都要读回
+    Run insideFull = download(dsp, bus, kStaleInside, false, SIGMA_ZERO_WRITE);
+    Run insideChecked = download(dsp, bus, kStaleInside, true, SIGMA_ZERO_CHECK);
+    checkSame("stale inside runs, checked zero", insideFull, insideChecked);
+    int zeroEntries = 0;
+    for (int i = 0; i < SEQUENCE_SPARSE_SIZE_IC_1; i++) {
+        zeroEntries += Sequence_SPARSE_IC_1[i].opcode == SIGMA_SEQ_ZERO;
+    }
+    CHECK(insideChecked.skipped < zeroBytes && insideChecked.skipped + zeroEntries * SIGMA_ZERO_CHECK_BYTES >= zeroBytes,
+          "%lu of %lu zero bytes skipped with one stale word in each of %d runs",
+          (unsigned long)insideChecked.skipped, (unsigned long)zeroBytes, zeroEntries);
+    Run insideAssumed = download(dsp, bus, kStaleInside, true, SIGMA_ZERO_ASSUME);
+    CHECK(firstDifference(insideFull.image, insideAssumed.image) < insideFull.image.size(),
+          "stale words inside zero runs do not matter");
+
+    // 非阻塞执行：零条目的每一步最多一次读回（I2C为子地址写入加读取两个事务）
+    powerUp(dsp, kStaleInside);
+    SigmaSeqState dl;
+    SIGMA_SEQ_START(&dl, DEVICE_ADDR_IC_1, Sequence_SPARSE_IC_1, SEQUENCE_SPARSE_SIZE_IC_1, Sequence_SPARSE_Blob_IC_1);
+    SIGMA_SEQ_SET_ZERO_MODE(&dl, SIGMA_ZERO_CHECK);
+    size_t worstStep = 0;
+    for (bool more = true; more; ) {
+        bool zeroStep = dl.index < dl.count && Sequence_SPARSE_IC_1[dl.index].opcode == SIGMA_SEQ_ZERO;
+        bus.reset();
+        more = SIGMA_SEQ_STEP(&dl);
+        worstStep = zeroStep && bus.transactions > worstStep ? bus.transactions : worstStep;
+        delay(SIGMA_SEQ_WAIT_MS(&dl));
+    }
+    CHECK(!dl.failed && dl.error == SIGMA_SUCCESS, "stepped download failed: %u", dl.failed ? dl.failure : dl.error);
+    CHECK(worstStep <= 2, "a zero step took %zu bus transactions", worstStep);
+    CHECK(dsp.readMemory(0, kImageBytes) == insideFull.image, "stepped checked download differs");
+
+    Run staleAssumed = download(dsp, bus, kStale, true, SIGMA_ZERO_ASSUME);
+    CHECK(firstDifference(staleFull.image, staleAssumed.image) < staleFull.image.size(),
+          "stale memory with skipped zero entries matches the full download");
+
+    return SIGMA_TEST_RESULT();
+}
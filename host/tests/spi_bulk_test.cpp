@@ -0,0 +1,92 @@
+/*
+ * SPI块传输和高速SPI（只在SPI构建中运行），验证
+ *   - 数据按暂存区分块以 SPI.transfer(buf, n) 发出，不再逐字节调用；
+ *   - begin() 的三次空写把复位后处于I2C模式的DSP切换到SPI，之前的写入被DSP忽略；
+ *   - 最高时钟 SIGMA_SPI_CLOCK_MAX 下下载结果相同，事务按传输的时钟发出；
+ *   - 按总线时序模型，SPI_SPEED 打开到 20MHz 时整个下载的线上时间在十毫秒以内（导出序列自带的延迟另计）。
+ */
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#include "SigmaBusTiming.h"
+#include "SigmaDspEmulator.h"
+#include "SigmaTestCheck.h"
+
+// 整个地址空间：内存每字4字节，寄存器每字2字节
+static const size_t kImageBytes = size_t(SIGMA_EMU_REGISTER_ADDR) * 4 + 0x1000 * 2;
+
+typedef SigmaSpiTransport<DSP_SS_PIN, SIGMA_SPI_CLOCK_MAX> FastBus;
+
+// 块传输时每个事务的 transfer() 调用数：命令和地址一次，数据每个暂存区一次（读取一次）
+static size_t expectedCalls(const std::vector<SigmaBusTransaction>& log) {
+    size_t calls = 0;
+    for (const SigmaBusTransaction& t : log) {
+        size_t payload = t.data.size() > 3 ? t.data.size() - 3 : 0;
+        bool read = !t.data.empty() && (t.data[0] & 0x01);
+        calls += 1 + (read ? 1 : (payload + SIGMA_SPI_STAGE - 1) / SIGMA_SPI_STAGE);
+    }
+    return calls;
+}
+
+int main() {
+    SigmaDspEmulator dsp(DSP_I2C_ADDR);
+    SigmaBusRecorder bus;
+    bus.target = &dsp;
+    SIGMA_HOST_SET_BUS(&bus);
+
+    // 复位后未切换到SPI：写入被忽略
+    dsp.hardwareReset();
+    byte gain[4] = {0x00, 0x80, 0x00, 0x00};
+    SIGMA_WRITE_REGISTER_BLOCK(DEVICE_ADDR_IC_1, 0x0010, 4, gain);
+    CHECK(dsp.writeTransactions == 0, "DSP in I2C mode accepted an SPI write");
+
+    // begin() 的三次空写之后才接收
+    dsp.hardwareReset();
+    bus.clear();
+    SIGMA_I2C_INIT();
+    CHECK(bus.log.size() == 3, "latch used %zu transactions", bus.log.size());
+    CHECK(dsp.spiMode, "DSP still in I2C mode after begin()");
+    SIGMA_WRITE_REGISTER_BLOCK(DEVICE_ADDR_IC_1, 0x0010, 4, gain);
+    CHECK(SIGMA_READ_REGISTER_INTEGER(0x0010, 4) == 0x00800000, "write after latch lost");
+
+    // SPI_SPEED（本测试构建为20MHz）下载：块传输
+    dsp.clear();
+    bus.clear();
+    SPI.transferCalls = 0;
+    uint64_t start = SIGMA_HOST_TIME_US();
+    sequence_download_IC_1();
+    double delayMs = (SIGMA_HOST_TIME_US() - start) / 1000.0;
+    std::vector<uint8_t> expected = dsp.readMemory(0, kImageBytes);
+    CHECK(SIGMA_GET_LAST_ERROR() == SIGMA_SUCCESS, "download error %u", SIGMA_GET_LAST_ERROR());
+    CHECK(SPI.transferCalls == expectedCalls(bus.log), "%zu transfer() calls, %zu expected with block transfers",
+          SPI.transferCalls, expectedCalls(bus.log));
+    CHECK(SPI.transferCalls * 8 < bus.payloadBytes(), "%zu transfer() calls for %zu payload bytes",
+          SPI.transferCalls, bus.payloadBytes());
+    bool clockOk = true;
+    for (const SigmaBusTransaction& t : bus.log) {
+        clockOk = clockOk && t.clock == SPI_SPEED;
+    }
+    CHECK(clockOk, "transactions not clocked at SPI_SPEED");
+
+    double wireMs = SIGMA_BUS_WIRE_NS(bus.log, 0, bus.log.size(), SIGMA_I2C_TIMING(400000),
+                                      SIGMA_SPI_TIMING(SPI_SPEED)) / 1e6;
+    double rate = bus.wireBytes() / (wireMs / 1000.0);
+    printf("SPI %.1f MHz: %zu bytes, %.3f ms on the wire (%.0f kB/s), %.1f ms delays, %zu transfer() calls\n",
+           SPI_SPEED / 1e6, bus.wireBytes(), wireMs, rate / 1000, delayMs, SPI.transferCalls);
+    CHECK(wireMs < 10, "download takes %.1f ms on the wire", wireMs);
+
+    // 最高时钟
+    dsp.hardwareReset();
+    bus.clear();
+    FastBus::begin();
+    CHECK(SIGMA_RUN_SEQUENCE<FastBus>(DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1) ==
+              SIGMA_SUCCESS, "sequence at %ld Hz failed", SIGMA_SPI_CLOCK_MAX);
+    CHECK(dsp.readMemory(0, kImageBytes) == expected, "memory differs at %ld Hz", SIGMA_SPI_CLOCK_MAX);
+    clockOk = true;
+    for (const SigmaBusTransaction& t : bus.log) {
+        clockOk = clockOk && t.clock == SIGMA_SPI_CLOCK_MAX;
+    }
+    CHECK(clockOk, "transactions not clocked at SIGMA_SPI_CLOCK_MAX");
+    CHECK(SIGMA_VERIFY_SECTIONS<FastBus>(DEVICE_ADDR_IC_1, Sections_IC_1, SECTION_COUNT_IC_1) == SIGMA_SUCCESS,
+          "readback at %ld Hz failed", SIGMA_SPI_CLOCK_MAX);
+
+    return SIGMA_TEST_RESULT();
+}
@@ -0,0 +1,160 @@
+/*
+ * 传输策略：同一个程序里编译I2C和SPI两种传输（SIGMA_WITH_I2C/SIGMA_WITH_SPI），验证
+ *   - I2C上的DSP和SPI上的DSP各自下载后，内存与默认传输下载的结果相同，流量不串到另一条总线；
+ *   - 两个下载交替执行（非阻塞，各自一份序列状态）结果也相同；
+ *   - 每个传输有自己的计划器，一个传输上的合并不影响另一个；
+ *   - 记录型传输记下的写入正是序列表中的写入，模型传输直接写入 SigmaDspEmulator。
+ */
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#include "SigmaTransports.h"
+#include "SigmaTestCheck.h"
+
+// 整个地址空间：内存每字4字节，寄存器每字2字节
+static const size_t kImageBytes = size_t(SIGMA_EMU_REGISTER_ADDR) * 4 + 0x1000 * 2;
+
+typedef SigmaI2cTransport<> I2cBus;
+typedef SigmaSpiTransport<> SpiBus;
+
+// I2C流量交给一个后端，SPI流量交给另一个：两条独立的总线
+class SplitBus : public SigmaBusBackend {
+public:
+    SigmaBusBackend* i2c = nullptr;
+    SigmaBusBackend* spi = nullptr;
+
+    uint8_t i2cWrite(uint8_t devAddress, const uint8_t* data, size_t length, bool sendStop) override {
+        return i2c->i2cWrite(devAddress, data, length, sendStop);
+    }
+    size_t i2cRead(uint8_t devAddress, uint8_t* data, size_t length) override {
+        return i2c->i2cRead(devAddress, data, length);
+    }
+    void spiBegin() override { spi->spiBegin(); }
+    uint8_t spiTransfer(uint8_t data) override { return spi->spiTransfer(data); }
+    void spiEnd() override { spi->spiEnd(); }
+};
+
+static SigmaDspEmulator g_dspA(DSP_I2C_ADDR);    // I2C
+static SigmaDspEmulator g_dspB(DSP_I2C_ADDR);    // SPI
+static SigmaDspEmulator g_dspC(DSP_I2C_ADDR);    // 不经总线的模型传输
+typedef SigmaEmulatorTransport<&g_dspC> EmuBus;
+typedef SigmaRecordingTransport<1> RecBus;
+
+static void checkImage(const char* label, const std::vector<uint8_t>& expected, const SigmaDspEmulator& dsp) {
+    std::vector<uint8_t> actual = dsp.readMemory(0, kImageBytes);
+    size_t at = 0;
+    while (at < expected.size() && expected[at] == actual[at]) {
+        at++;
+    }
+    CHECK(at == expected.size(), "[%s] memory differs at byte offset 0x%zX", label, at);
+}
+
+int main() {
+    SigmaBusCounter i2cBus;
+    SigmaBusCounter spiBus;
+    i2cBus.target = &g_dspA;
+    spiBus.target = &g_dspB;
+    SplitBus split;
+    split.i2c = &i2cBus;
+    split.spi = &spiBus;
+    SIGMA_HOST_SET_BUS(&split);
+    I2cBus::begin();
+    SpiBus::begin();
+
+    // 参考：导出函数经默认传输下载
+    sequence_download_IC_1();
+    const SigmaDspEmulator& reference = USE_SPI ? g_dspB : g_dspA;
+    std::vector<uint8_t> expected = reference.readMemory(0, kImageBytes);
+    CHECK(g_dspA.writeTransactions + g_dspB.writeTransactions == reference.writeTransactions,
+          "default transport wrote to both DSPs");
+    CHECK(SIGMA_GET_LAST_ERROR() == SIGMA_SUCCESS, "default download error %u", SIGMA_GET_LAST_ERROR());
+
+    // 两个DSP各自的传输，依次下载
+    g_dspA.clear();
+    g_dspB.clear();
+    i2cBus.reset();
+    spiBus.reset();
+    CHECK(SIGMA_RUN_SEQUENCE<I2cBus>(DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1) ==
+              SIGMA_SUCCESS, "I2C sequence failed");
+    CHECK(spiBus.transactions == 0, "I2C download produced %zu SPI transactions", spiBus.transactions);
+    size_t i2cTransactions = i2cBus.transactions;
+    CHECK(SIGMA_RUN_SEQUENCE<SpiBus>(DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1) ==
+              SIGMA_SUCCESS, "SPI sequence failed");
+    CHECK(i2cBus.transactions == i2cTransactions, "SPI download produced I2C transactions");
+    checkImage("I2C", expected, g_dspA);
+    checkImage("SPI", expected, g_dspB);
+    printf("sequential: %zu I2C transactions, %zu SPI transactions\n", i2cTransactions, spiBus.transactions);
+
+    // 交替执行：每个DSP一份序列状态，两个都在等待时推进虚拟时钟
+    g_dspA.clear();
+    g_dspB.clear();
+    SigmaSeqState a;
+    SigmaSeqState b;
+    SIGMA_SEQ_START(&a, DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1);
+    SIGMA_SEQ_START(&b, DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1);
+    uint64_t start = SIGMA_HOST_TIME_US();
+    while (!SIGMA_SEQ_DONE(&a) || !SIGMA_SEQ_DONE(&b)) {
+        bool progressA = SIGMA_SEQ_STEP<I2cBus>(&a);
+        bool progressB = SIGMA_SEQ_STEP<SpiBus>(&b);
+        if (a.failed || b.failed || (!progressA && !progressB)) {
+            break;
+        }
+        uint32_t waitA = SIGMA_SEQ_DONE(&a) ? 0xFFFFFFFF : SIGMA_SEQ_WAIT_MS(&a);
+        uint32_t waitB = SIGMA_SEQ_DONE(&b) ? 0xFFFFFFFF : SIGMA_SEQ_WAIT_MS(&b);
+        uint32_t waitMs = waitA < waitB ? waitA : waitB;
+        if (waitMs && waitMs != 0xFFFFFFFF) {
+            delay(waitMs);
+        }
+    }
+    CHECK(SIGMA_SEQ_DONE(&a) && SIGMA_SEQ_DONE(&b), "interleaved download stopped at %d/%d", a.index, b.index);
+    CHECK(a.error == SIGMA_SUCCESS && b.error == SIGMA_SUCCESS, "interleaved errors %u/%u", a.error, b.error);
+    checkImage("I2C, interleaved", expected, g_dspA);
+    checkImage("SPI, interleaved", expected, g_dspB);
+    printf("interleaved: %llu ms\n", (unsigned long long)((SIGMA_HOST_TIME_US() - start) / 1000));
+
+    // 计划器按传输分开：SPI上合并时I2C照常直接写入
+    i2cBus.reset();
+    spiBus.reset();
+    byte gain[8] = {0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00};
+    SIGMA_DOWNLOAD_BEGIN<SpiBus>();
+    SIGMA_WRITE_REGISTER_BLOCK<SpiBus>(DEVICE_ADDR_IC_1, 0x0010, 4, (const uint8_t*)gain);
+    SIGMA_WRITE_REGISTER_BLOCK<SpiBus>(DEVICE_ADDR_IC_1, 0x0011, 4, (const uint8_t*)gain + 4);
+    SIGMA_WRITE_REGISTER_BLOCK<I2cBus>(DEVICE_ADDR_IC_1, 0x0010, 4, (const uint8_t*)gain);
+    CHECK(spiBus.transactions == 0, "SPI planner sent %zu transactions before END", spiBus.transactions);
+    CHECK(i2cBus.transactions == 1, "I2C write took %zu transactions", i2cBus.transactions);
+    CHECK(SIGMA_DOWNLOAD_END<SpiBus>() == SIGMA_SUCCESS, "SPI planner error");
+    CHECK(spiBus.transactions == 1, "SPI planner merged into %zu transactions", spiBus.transactions);
+    CHECK(SIGMA_READ_REGISTER_INTEGER<SpiBus>(0x0011, 4) == 0x00400000, "SPI readback 0x%08X",
+          (unsigned)SIGMA_READ_REGISTER_INTEGER<SpiBus>(0x0011, 4));
+    CHECK(SIGMA_READ_REGISTER_INTEGER<I2cBus>(0x0010, 4) == 0x00800000, "I2C readback 0x%08X",
+          (unsigned)SIGMA_READ_REGISTER_INTEGER<I2cBus>(0x0010, 4));
+
+    // 模型传输：没有总线流量，结果相同
+    i2cBus.reset();
+    spiBus.reset();
+    CHECK(SIGMA_RUN_SEQUENCE<EmuBus>(DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1) ==
+              SIGMA_SUCCESS, "emulator transport sequence failed");
+    CHECK(i2cBus.transactions == 0 && spiBus.transactions == 0, "emulator transport used the bus");
+    checkImage("emulator transport", expected, g_dspC);
+    CHECK(SIGMA_VERIFY_SECTIONS<EmuBus>(DEVICE_ADDR_IC_1, Sections_IC_1, SECTION_COUNT_IC_1) == SIGMA_SUCCESS,
+          "emulator transport verify failed");
+
+    // 记录型传输：每个写入条目一个操作，数据与序列数据块相同
+    SIGMA_RUN_SEQUENCE<RecBus>(DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1);
+    size_t op = 0;
+    for (int i = 0; i < SEQUENCE_SIZE_IC_1; i++) {
+        const SigmaSeqEntry& entry = Sequence_IC_1[i];
+        if (entry.opcode != SIGMA_SEQ_WRITE) {
+            continue;
+        }
+        while (op < RecBus::log().size() && RecBus::log()[op].read) {
+            op++;    // 状态轮询
+        }
+        bool same = op < RecBus::log().size() && RecBus::log()[op].address == entry.address &&
+                    RecBus::log()[op].data == std::vector<uint8_t>(Sequence_Blob_IC_1 + entry.offset,
+                                                                   Sequence_Blob_IC_1 + entry.offset + entry.length);
+        CHECK(same, "recorded operation %zu differs from sequence entry %d", op, i);
+        op++;
+    }
+    CHECK(SigmaRecordingTransport<2>::log().empty(), "recorders with different ids share a log");
+
+    return SIGMA_TEST_RESULT();
+}
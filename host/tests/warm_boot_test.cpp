@@ -0,0 +1,84 @@
+/*
+ * 热启动：在 ADAU1452 模型上模拟MCU复位而DSP保持运行，验证
+ *   - 冷启动时 SIGMA_BOOT_SEQUENCE() 完整下载并写入签名；
+ *   - 再次启动时只做几次读取就跳过下载，不产生写事务；
+ *   - 内核停止、签名字不符或抽样的程序字不同（换了镜像）时重新下载。
+ */
+#include "ADAU1452_EN_B_I2C_IC_1_SEQ.h"
+#include "SigmaDspEmulator.h"
+#include "SigmaTestCheck.h"
+
+struct BootResult {
+    uint8_t result;
+    bool warm;
+    size_t transactions;
+    uint64_t us;
+};
+
+static BootResult boot(SigmaBusCounter& bus) {
+    bus.reset();
+    uint64_t start = SIGMA_HOST_TIME_US();
+    BootResult r;
+    r.result = SIGMA_BOOT_SEQUENCE(DEVICE_ADDR_IC_1, Sequence_IC_1, SEQUENCE_SIZE_IC_1, Sequence_Blob_IC_1,
+                                   &Signature_IC_1);
+    r.warm = SIGMA_WAS_WARM_BOOT();
+    r.transactions = bus.transactions;
+    r.us = SIGMA_HOST_TIME_US() - start;
+    return r;
+}
+
+// 改动后应重新下载，且下载后镜像和签名都正确
+static void checkColdBoot(const char* label, SigmaBusCounter& bus) {
+    BootResult r = boot(bus);
+    CHECK(r.result == SIGMA_SUCCESS && !r.warm, "[%s] result %u, warm %d", label, r.result, r.warm);
+    CHECK(SIGMA_VERIFY_SECTIONS(DEVICE_ADDR_IC_1, Sections_IC_1, SECTION_COUNT_IC_1) == SIGMA_SUCCESS,
+          "[%s] image differs after download", label);
+    CHECK(SIGMA_WARM_BOOT_MATCH(DEVICE_ADDR_IC_1, &Signature_IC_1), "[%s] signature not written", label);
+}
+
+int main() {
+    SigmaDspEmulator dsp(DSP_I2C_ADDR);
+    SigmaBusCounter bus;
+    bus.target = &dsp;
+    SIGMA_HOST_SET_BUS(&bus);
+    SIGMA_I2C_INIT();
+
+    // 上电：数据内存为零，内核未运行
+    BootResult cold = boot(bus);
+    CHECK(cold.result == SIGMA_SUCCESS && !cold.warm, "cold boot result %u, warm %d", cold.result, cold.warm);
+    CHECK(dsp.readMemory(SIGNATURE_ADDR_IC_1, 4) ==
+              std::vector<uint8_t>({uint8_t(Signature_IC_1.value >> 24), uint8_t(Signature_IC_1.value >> 16),
+                                    uint8_t(Signature_IC_1.value >> 8), uint8_t(Signature_IC_1.value)}),
+          "signature word not written");
+
+    // MCU复位，DSP保持运行
+    size_t wordsBefore = dsp.wordsWritten;    // I2C读取的子地址阶段也计为写事务，这里只看写入的数据
+    BootResult warm = boot(bus);
+    CHECK(warm.result == SIGMA_SUCCESS && warm.warm, "warm boot result %u, warm %d", warm.result, warm.warm);
+    CHECK(dsp.wordsWritten == wordsBefore, "warm boot wrote %zu words", dsp.wordsWritten - wordsBefore);
+    CHECK(warm.us < cold.us / 100, "warm boot took %llu us", (unsigned long long)warm.us);
+    printf("cold boot: %zu transactions, %llu us; warm boot: %zu transactions, %llu us\n", cold.transactions,
+           (unsigned long long)cold.us, warm.transactions, (unsigned long long)warm.us);
+
+    // 内核停止
+    const uint8_t stop[2] = {0x00, 0x00};
+    dsp.poke(SIGMA_EMU_START_CORE, stop, 2);
+    checkColdBoot("core stopped", bus);
+
+    // 签名字被改写
+    const uint8_t zero[4] = {0, 0, 0, 0};
+    dsp.poke(SIGNATURE_ADDR_IC_1, zero, 4);
+    checkColdBoot("signature cleared", bus);
+
+    // 同一签名但程序不同（例如旧固件写入的签名值碰巧相同）
+    const uint8_t other[4] = {0x12, 0x34, 0x56, 0x78};
+    dsp.poke(Signature_IC_1.sampleAddress[SIGMA_SIGNATURE_SAMPLES / 2], other, 4);
+    checkColdBoot("program sample differs", bus);
+
+    // 掉电：内存清零
+    dsp.clear();
+    checkColdBoot("power cycle", bus);
+    CHECK(SIGMA_GET_LAST_ERROR() == SIGMA_SUCCESS, "last error %u", SIGMA_GET_LAST_ERROR());
+
+    return SIGMA_TEST_RESULT();
+}
@@ -0,0 +1,8 @@
+# 用 sigma_sequence_gen --image 生成二进制镜像
+# cmake -DGEN=<sigma_sequence_gen> -DEXPORT_DIR=<导出目录> -DOUT=<镜像文件> [-DFLAGS="--image --sparse"] -P write_image.cmake
+separate_arguments(flags UNIX_COMMAND "${FLAGS}")
+execute_process(COMMAND ${GEN} ${flags} ${EXPORT_DIR} 1 OUTPUT_FILE ${OUT} RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+  file(REMOVE ${OUT})
+  message(FATAL_ERROR "sigma_sequence_gen ${FLAGS} failed: ${result}")
+endif()